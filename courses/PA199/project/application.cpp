@@ -8,6 +8,7 @@
 #include "application.hpp"
 #include "glad/glad.h"
 #include "lodepng.h"
+#include <algorithm>
 #include <filesystem>
 #include <iostream>
 #include <iomanip>
@@ -58,6 +59,13 @@ static GLuint load_texture(std::filesystem::path const& path)
     return texture;
 }
 
+// Returns the value following the option on the command line, or an empty string.
+static std::string argument_value(std::vector<std::string> const& arguments, std::string const& option)
+{
+    auto it = std::find(arguments.begin(), arguments.end(), option);
+    return it != arguments.end() && std::next(it) != arguments.end() ? *std::next(it) : std::string();
+}
+
 static GLuint create_shader_program(GLuint const  vertex_shader, GLuint const fragment_shader) {
     GLuint const shader_program = glCreateProgram();
 
@@ -105,34 +113,79 @@ Application::Application(int initial_width, int initial_height, std::vector<std:
 	GLuint green_moss_texture = load_texture(lecture_folder_path / "data" / "textures" / "green_moss.png");
 	GLuint brown_moss_texture = load_texture(lecture_folder_path / "data" / "textures" / "brown_moss.png");
 	GLuint metal_texture = load_texture(lecture_folder_path / "data" / "textures" / "metal.png");
+	for (GLuint texture : { grass_texture, grey_moss_texture, black_moss_texture, green_moss_texture, brown_moss_texture, metal_texture }) {
+		mainScene.addTexture(texture);
+	}
+
+    // A baked scene file replaces the level built in code, which --export-scene writes out
+    const std::string scene_path = argument_value(this->arguments, "--scene");
+    if (!scene_path.empty()) {
+        load_level(scene_path);
+    } else {
+        build_level(grass_texture, black_moss_texture, green_moss_texture, brown_moss_texture, metal_texture);
+    }
+
+    const std::string export_path = argument_value(this->arguments, "--export-scene");
+    if (!export_path.empty()) {
+        gel::exportScene(mainScene, export_path);
+    }
+
+    // Components subscribe to actions by name, the keys behind them are chosen here
+    gel::InputSystem& input = mainScene.getInput();
+    input.bindKey(input.action("paddle_left"), GLFW_KEY_A);
+    input.bindKey(input.action("paddle_left"), GLFW_KEY_LEFT);
+    input.bindKey(input.action("paddle_right"), GLFW_KEY_D);
+    input.bindKey(input.action("paddle_right"), GLFW_KEY_RIGHT);
+    input.bindKey(input.action("reset_ball"), GLFW_KEY_R);
+    mainScene.bindInput();
+
+    mainScene.getMainCamera()->setAspectRatio(float(width) / float(height));
+    mainScene.setJobSystem(&jobs);
+}
+
+Application::~Application()
+{}
 
-    auto ball_sphere = new gel::SphereRendererComponent(0.5f, 9, 9, metal_texture);
-	auto platform_circle = new gel::CircleRendererComponent(1.75f, 32, grass_texture);
+void Application::build_level(GLuint grass_texture, GLuint black_moss_texture, GLuint green_moss_texture, GLuint brown_moss_texture, GLuint metal_texture) {
+    auto ball_sphere = mainScene.createComponent<gel::SphereRendererComponent>(0.5f, 9, 9, metal_texture);
+	auto platform_circle = mainScene.createComponent<gel::CircleRendererComponent>(1.75f, 32, grass_texture);
 
-    auto ball = new gel::GameEntity(
+    auto ball = mainScene.createEntity(
 		gem::Vector<float, 3> { 0.0f, -0.25f, 0.0f },
 		gem::Quaternion<float> { 1.0f, 0.0f, 0.0f, 0.0f },
 		gem::Vector<float, 3> { 1.0f, 1.0f, 1.0f } * 0.5f
     );
     ball->addComponent(ball_sphere);
-    auto ball_rigidbody = new gel::RigidbodyComponent(10.0f);
-	ball_rigidbody->applyImpulse(gem::Vector<float, 3> { 0.0f, 0.0f, 0.05f });
-    ball->addComponent(ball_rigidbody);
-	ball->addComponent(new gel::BallResetComponent(ball->getPosition()));
-
-    int layer = 2;
-	int blocks_per_layer = 6;
-	float offset = 0.5f;
-    float ringAngle = (float)(M_PI * 2.0f) / blocks_per_layer;
+    ball->bindRegistry(mainScene.getRegistry());
+    auto& ball_rigidbody = ball->emplaceComponent<gel::RigidbodyComponent>(10.0f);
+	ball_rigidbody.applyImpulse(gem::Vector<float, 3> { 0.0f, 0.0f, 0.05f });
+	ball->addComponent(mainScene.createComponent<gel::BallResetComponent>(ball->getPosition()));
+
+    constexpr int layer = 2;
+	constexpr int blocks_per_layer = 6;
+	constexpr float offset = 0.5f;
+    constexpr float ringAngle = (float)(M_PI * 2.0f) / blocks_per_layer;
+
+    // The brick layout is fixed, so its orientations are folded at compile time
+    constexpr auto blockOrientations = [] {
+        std::array<gem::Quaternion<float>, layer * blocks_per_layer> result{};
+        for (int i = 0; i < layer; i++) {
+            for (int j = 0; j < blocks_per_layer; j++) {
+                result[i * blocks_per_layer + j] = gem::AxisAngle{ (ringAngle * i) + (ringAngle * j), 0.0f, 1.0f, 0.0f }.toQuaternion();
+            }
+        }
+        return result;
+    }();
 
 	std::vector<gel::ArcRendererComponent*> arcReferences;
     for (int i = 0; i < layer; i++) {
         for (int j = 0; j < blocks_per_layer; j++) {
-            auto arcRC = new gel::ArcRendererComponent(1.0f, 1.5f, 16, 0.5f, ringAngle, (j % 2 == 0) ? green_moss_texture : black_moss_texture);
+            // Bricks are the most numerous meshes and small enough for half-float positions
+            auto arcRC = mainScene.createComponent<gel::ArcRendererComponent>(1.0f, 1.5f, 16, 0.5f, ringAngle, (j % 2 == 0) ? green_moss_texture : black_moss_texture, 3, gel::VertexLayout::Packed);
 
-            auto block = new gel::GameEntity(
+            auto block = mainScene.createEntity(
                 gem::Vector<float, 3> { 0.0f, -0.25f + (i * offset), 0.0f },
-                gem::AxisAngle{ (ringAngle * i) + (ringAngle * j), 0.0f, 1.0f, 0.0f }.toQuaternion(),
+                blockOrientations[i * blocks_per_layer + j],
                 gem::Vector<float, 3> { 1.0f, 1.0f, 1.0f }
             );
 			block->addComponent(arcRC);
@@ -142,71 +195,80 @@ Application::Application(int initial_width, int initial_height, std::vector<std:
 		}
     }
 
-    auto paddle_ring_a = new gel::ArcRendererComponent(4.25f, 5.0f, 16, 0.5f, (float)(M_PI * 2.0f) / 8.0f, brown_moss_texture);
-    auto paddle_ring_b = new gel::ArcRendererComponent(4.25f, 5.0f, 16, 0.5f, (float)(M_PI * 2.0f) / 8.0f, brown_moss_texture);
-    auto paddle_a = new gel::GameEntity(
+    constexpr float paddleArc = (float)(M_PI * 2.0f) / 8.0f;
+    constexpr gem::Quaternion<float> paddleAOrientation = gem::AxisAngle{ 1.0f, 0.0f, 0.0f, 0.0f }.toQuaternion();
+    constexpr gem::Quaternion<float> paddleBOrientation = gem::AxisAngle{ (float)(M_PI), 0.0f, 1.0f, 0.0f }.toQuaternion();
+
+    auto paddle_ring_a = mainScene.createComponent<gel::ArcRendererComponent>(4.25f, 5.0f, 16, 0.5f, paddleArc, brown_moss_texture);
+    auto paddle_ring_b = mainScene.createComponent<gel::ArcRendererComponent>(4.25f, 5.0f, 16, 0.5f, paddleArc, brown_moss_texture);
+    auto paddle_a = mainScene.createEntity(
         gem::Vector<float, 3> { 0.0f, -0.25f, 0.0f },
-        gem::AxisAngle{ 1.0f, 0.0f, 0.0f, 0.0f }.toQuaternion(),
+        paddleAOrientation,
         gem::Vector<float, 3> { 1.0f, 1.0f, 1.0f }
     );
 	paddle_a->addComponent(paddle_ring_a);
-	paddle_a->addComponent(new gel::PaddleControllerComponent());
+	paddle_a->addComponent(mainScene.createComponent<gel::PaddleControllerComponent>());
 
-    auto paddle_b = new gel::GameEntity(
+    auto paddle_b = mainScene.createEntity(
         gem::Vector<float, 3> { 0.0f, -0.25f, 0.0f },
-        gem::AxisAngle{ (float)(M_PI), 0.0f, 1.0f, 0.0f}.toQuaternion(),
+        paddleBOrientation,
         gem::Vector<float, 3> { 1.0f, 1.0f, 1.0f }
     );
     paddle_b->addComponent(paddle_ring_b);
-	paddle_b->addComponent(new gel::PaddleControllerComponent());
+	paddle_b->addComponent(mainScene.createComponent<gel::PaddleControllerComponent>());
 
-    auto platform = new gel::GameEntity(
+    auto platform = mainScene.createEntity(
         gem::Vector<float, 3> { 0.0f, -0.5f, 0.0f },
         gem::Quaternion<float> { 1.0f, 0.0f, 0.0f, 0.0f },
 		gem::Vector<float, 3> { 1.0f, 1.0f, 1.0f } * 3.0f
     );
     platform->addComponent(platform_circle);
 
-	firstCamera = new gel::GameEntity(
-        gem::Vector<float, 3> { 0.0f, 0.0f, -7.0f },
+    // Camera presets
+    constexpr gem::Vector<float, 3> firstCameraPosition = { 0.0f, 0.0f, -7.0f };
+    constexpr gem::Vector<float, 3> secondCameraPosition = { 0.0f, 7.0f, -7.0f };
+    constexpr gem::Vector<float, 3> thirdCameraPosition = { 0.0f, 7.0f, 0.0f };
+
+	firstCamera = mainScene.createEntity(
+        firstCameraPosition,
         gem::Quaternion<float> { 1.0f, 0.0f, 0.0f, 0.0f },
         gem::Vector<float, 3> { 1.0f, 1.0f, 1.0f }
     );
-	auto cc1 = new gel::CameraComponent(
+	auto cc1 = mainScene.createComponent<gel::CameraComponent>(
         90.0f, width / height, 0.1f, 1000.0f
     );
     cc1->targetEntity = platform;
     firstCamera->addComponent(cc1);
 
-    secondCamera = new gel::GameEntity(
-        gem::Vector<float, 3> { 0.0f, 7.0f, -7.0f },
+    secondCamera = mainScene.createEntity(
+        secondCameraPosition,
         gem::Quaternion<float> { 1.0f, 0.0f, 0.0f, 0.0f },
         gem::Vector<float, 3> { 1.0f, 1.0f, 1.0f }
     );
-    auto cc2 = new gel::CameraComponent(
+    auto cc2 = mainScene.createComponent<gel::CameraComponent>(
         90.0f, width / height, 0.1f, 1000.0f
     );
     cc2->targetEntity = platform;
     secondCamera->addComponent(cc2);
 
-    thirdCamera = new gel::GameEntity(
-        gem::Vector<float, 3> {0.0f, 7.0f, 0.0f },
+    thirdCamera = mainScene.createEntity(
+        thirdCameraPosition,
         gem::Quaternion<float> { 1.0f, 0.0f, 0.0f, 0.0f },
         gem::Vector<float, 3> {1.0f, 1.0f, 1.0f }
     );
-    auto cc3 = new gel::CameraComponent(
+    auto cc3 = mainScene.createComponent<gel::CameraComponent>(
         2.0f, width / height, 0.1f, 1000.0f, true
     );
     cc3->targetEntity = platform;
     thirdCamera->addComponent(cc3);
 
-    auto sunLight = new gel::DirectionalLightComponent(
+    auto sunLight = mainScene.createComponent<gel::DirectionalLightComponent>(
         gem::Vector<float, 3> {0.2f, 0.2f, 0.2f } *2.0f,
         gem::Vector<float, 3> {0.8f, 0.8f, 0.8f } *2.0f,
 		gem::Vector<float, 3> {1.0f, 1.0f, 1.0f } *2.0f
     );
 
-    auto directLight = new gel::GameEntity(
+    auto directLight = mainScene.createEntity(
         gem::Vector<float, 3> { 0.0f, 5.0f, -5.0f },
 		gem::AxisAngle{ (float)(-M_PI / 8.0f), 1.0f, 0.0f, 0.0f }.toQuaternion(),
         gem::Vector<float, 3> { 1.0f, 1.0f, 1.0f }
@@ -214,24 +276,24 @@ Application::Application(int initial_width, int initial_height, std::vector<std:
     directLight->addComponent(sunLight);
 	mainScene.addEntity(directLight);
 
-    auto l1 = new gel::PointLightComponent(
+    auto l1 = mainScene.createComponent<gel::PointLightComponent>(
         gem::Vector<float, 3> {0.4f, 0.4f, 0.4f },
         gem::Vector<float, 3> {0.8f, 0.8f, 0.8f },
         gem::Vector<float, 3> {1.0f, 1.0f, 1.0f },
         10.0f
     );
-    auto pointLight = new gel::GameEntity(
+    auto pointLight = mainScene.createEntity(
         gem::Vector<float, 3> {0.0f, 7.0f, 0.0f },
         gem::Quaternion<float> { 1.0f, 0.0f, 0.0f, 0.0f },
         gem::Vector<float, 3> {1.0f, 1.0f, 1.0f }
 	);
 	pointLight->addComponent(l1);
 
-    auto collisionManager = new gel::GameEntity();
-    collisionManager->addComponent(new gel::AdhocPaddleBroadphaseCollisionComponent(
+    auto collisionManager = mainScene.createEntity();
+    collisionManager->addComponent(mainScene.createComponent<gel::AdhocPaddleBroadphaseCollisionComponent>(
         ball, paddle_a, paddle_b
     ));
-    collisionManager->addComponent(new gel::AdhocBrickBroadphaseCollisionComponent(
+    collisionManager->addComponent(mainScene.createComponent<gel::AdhocBrickBroadphaseCollisionComponent>(
         ball, arcReferences,
         blocks_per_layer, layer
 	));
@@ -252,12 +314,22 @@ Application::Application(int initial_width, int initial_height, std::vector<std:
 
 	mainScene.setMainCamera(secondCamera);
 	mainScene.setMainLight(sunLight);
-
-    mainScene.getMainCamera()->setAspectRatio(float(width) / float(height));
 }
 
-Application::~Application()
-{}
+void Application::load_level(std::filesystem::path const& path) {
+    std::vector<gel::GameEntity*> entities = gel::loadScene(mainScene, path.string());
+
+    // The camera presets keep their order in the file
+    std::vector<gel::GameEntity*> cameras;
+    for (auto* entity : entities) {
+        if (entity->getComponent<gel::CameraComponent>()) cameras.push_back(entity);
+    }
+    if (cameras.size() < 3) throw std::runtime_error("Scene file " + path.string() + " needs three cameras.");
+    firstCamera = cameras[0];
+    secondCamera = cameras[1];
+    thirdCamera = cameras[2];
+    if (!mainScene.getMainCamera()) mainScene.setMainCamera(secondCamera);
+}
 
 // ----------------------------------------------------------------------------
 // Methods
@@ -278,7 +350,7 @@ void Application::render() {
     glDisable(GL_CULL_FACE);
 	//glCullFace(GL_BACK);h
     //glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
-    mainScene.render();
+    mainScene.render(interpolation_alpha);
 }
 
 void Application::render_ui() {}
@@ -297,7 +369,7 @@ void Application::on_mouse_button(int button, int action, int mods) {}
 
 void Application::on_key_pressed(int key, int scancode, int action, int mods) {
 
-	mainScene.handleKeyPressed(key, scancode, action, mods);
+	mainScene.getInput().pushKeyEvent(key, scancode, action, mods);
 
     if (action == GLFW_PRESS) {
         switch (key) {
@@ -59,8 +59,19 @@ class Application : public IApplication {
     /** @copydoc IApplication::on_key_pressed */
     void on_key_pressed(int key, int scancode, int action, int mods) override;
 
+  private:
+    /** Builds the level in code from the loaded textures. */
+    void build_level(GLuint grass_texture, GLuint black_moss_texture, GLuint green_moss_texture, GLuint brown_moss_texture, GLuint metal_texture);
+
+    /** Loads the level from a scene file exported with --export-scene and picks the camera presets from it. */
+    void load_level(std::filesystem::path const& path);
+
+  public:
+
 	// ----------------------------------------------------------------------------
 
+    // Outlives the scene that schedules on it
+    gel::JobSystem jobs;
     gel::GameScene mainScene;
 
     // Game Entity
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace bench {
+	// Keeps the compiler from optimizing away a value that is otherwise unused.
+	template<typename T>
+	inline void doNotOptimize(const T& value) {
+		static const volatile void* sink;
+		sink = &value;
+		std::atomic_signal_fence(std::memory_order_seq_cst);
+	}
+
+	struct Result {
+		std::string name;
+		uint64_t iterations = 0;
+		double ns_per_iteration = 0.0;
+		double items_per_second = 0.0;
+	};
+
+	class State {
+	public:
+		explicit State(std::string name) : name_(std::move(name)) {}
+
+		// Runs the body until it has taken at least min_seconds, and records the timing.
+		// items_per_iteration is how many elements one call of the body processes.
+		template<typename F>
+		void run(F&& body, uint64_t items_per_iteration = 1, double min_seconds = 0.25) {
+			using clock = std::chrono::steady_clock;
+
+			uint64_t iterations = 1;
+			while (true) {
+				auto start = clock::now();
+				for (uint64_t i = 0; i < iterations; ++i) {
+					body();
+				}
+				double elapsed = std::chrono::duration<double>(clock::now() - start).count();
+
+				if (elapsed >= min_seconds || iterations >= (uint64_t(1) << 40)) {
+					result_.name = name_;
+					result_.iterations = iterations;
+					result_.ns_per_iteration = elapsed * 1e9 / static_cast<double>(iterations);
+					result_.items_per_second = static_cast<double>(iterations * items_per_iteration) / elapsed;
+					ran_ = true;
+					return;
+				}
+
+				iterations *= (elapsed < min_seconds / 100.0) ? 10 : 2;
+			}
+		}
+
+		// Records a measurement taken by the benchmark itself (e.g. a one-shot load time).
+		void report(double seconds, uint64_t items = 1) {
+			result_.name = name_;
+			result_.iterations = 1;
+			result_.ns_per_iteration = seconds * 1e9;
+			result_.items_per_second = seconds > 0.0 ? static_cast<double>(items) / seconds : 0.0;
+			ran_ = true;
+		}
+
+		bool hasResult() const { return ran_; }
+		const Result& result() const { return result_; }
+
+	private:
+		std::string name_;
+		Result result_;
+		bool ran_ = false;
+	};
+
+	struct Case {
+		std::string name;
+		std::function<void(State&)> body;
+	};
+
+	inline std::vector<Case>& registry() {
+		static std::vector<Case> cases;
+		return cases;
+	}
+
+	struct Registrar {
+		Registrar(const char* name, std::function<void(State&)> body) {
+			registry().push_back(Case{ name, std::move(body) });
+		}
+	};
+}
+
+// Defines and registers a benchmark, in the same spirit as gtest's TEST(suite, name).
+#define BENCH(suite, name) \
+	static void suite##_##name(bench::State& state); \
+	static bench::Registrar suite##_##name##_registrar(#suite "." #name, &suite##_##name); \
+	static void suite##_##name(bench::State& state)
@@ -0,0 +1,48 @@
+#include "../bench.hpp"
+#include "gem.hpp"
+#include "game_entity.hpp"
+#include "game_scene.hpp"
+#include "ecs/command_buffer.hpp"
+#include "physics/rigidbody_component.hpp"
+
+#include <vector>
+
+// A wave of despawns in a scene of 10k root entities, every fourth root with a rigidbody is
+// destroyed: one destroyEntity each, erasing from the root list every time, against
+// recording them in the command buffer and applying it, which compacts the list once.
+// Both refill the scene to the same state afterwards. Items are destroyed entities.
+
+namespace {
+	const size_t ROOTS = 10000;
+	const size_t STRIDE = 4;
+
+	std::vector<gel::GameEntity*> fill(gel::GameScene& scene) {
+		std::vector<gel::GameEntity*> doomed;
+		for (size_t i = scene.getEntities().size(); i < ROOTS; ++i) {
+			auto* entity = scene.createEntity();
+			entity->addComponent(scene.createComponent<gel::RigidbodyComponent>(1.0f));
+			scene.addEntity(entity);
+		}
+		for (size_t i = 0; i < ROOTS; i += STRIDE) doomed.push_back(scene.getEntities()[i]);
+		return doomed;
+	}
+}
+
+BENCH(gel_command_buffer_bench, despawn_immediate) {
+	gel::GameScene scene;
+	std::vector<gel::GameEntity*> doomed = fill(scene);
+	state.run([&] {
+		for (auto* entity : doomed) scene.destroyEntity(entity);
+		doomed = fill(scene);
+	}, ROOTS / STRIDE);
+}
+
+BENCH(gel_command_buffer_bench, despawn_deferred) {
+	gel::GameScene scene;
+	std::vector<gel::GameEntity*> doomed = fill(scene);
+	state.run([&] {
+		for (auto* entity : doomed) scene.getCommands().destroy(entity);
+		scene.applyCommands();
+		doomed = fill(scene);
+	}, ROOTS / STRIDE);
+}
\ No newline at end of file
@@ -0,0 +1,88 @@
+#include "../bench.hpp"
+#include "gem.hpp"
+#include "game_entity.hpp"
+#include "camera/camera_component.hpp"
+#include "light/point_light_component.hpp"
+#include "physics/rigidbody_component.hpp"
+#include "renderer/renderer_component.hpp"
+
+#include <memory>
+#include <vector>
+
+// Component queries the render loop makes per entity and frame, over 1000 entities with a
+// rigidbody, a camera and a point light each: the old walk over the component list with
+// dynamic_cast against the type mask lookup. The hit asks for the base class LightComponent
+// and then narrows it to PointLightComponent, like the renderer and mesh renderer lookup in
+// GameScene; the miss asks for a RendererComponent nobody has. Items are entities.
+
+namespace {
+	const size_t ENTITIES = 1000;
+
+	struct Scene {
+		std::vector<std::unique_ptr<gel::GameEntity>> entities;
+		std::vector<std::unique_ptr<gel::GameComponent>> components;
+	};
+
+	Scene makeScene() {
+		Scene scene;
+		gem::Vector<float, 3> grey{ 0.5f, 0.5f, 0.5f };
+		for (size_t i = 0; i < ENTITIES; ++i) {
+			auto entity = std::make_unique<gel::GameEntity>();
+			scene.components.push_back(std::make_unique<gel::RigidbodyComponent>());
+			scene.components.push_back(std::make_unique<gel::CameraComponent>());
+			scene.components.push_back(std::make_unique<gel::PointLightComponent>(grey, grey, grey));
+			for (size_t k = scene.components.size() - 3; k < scene.components.size(); ++k) {
+				entity->addComponent(scene.components[k].get());
+			}
+			scene.entities.push_back(std::move(entity));
+		}
+		return scene;
+	}
+
+	// GameEntity::getComponent before the type masks
+	template<typename T>
+	T* findByDynamicCast(const gel::GameEntity& entity) {
+		for (auto* comp : entity.getComponents()) {
+			if (auto* casted = dynamic_cast<T*>(comp)) return casted;
+		}
+		return nullptr;
+	}
+}
+
+BENCH(gel_component_lookup_bench, hit_dynamic_cast) {
+	Scene scene = makeScene();
+	state.run([&] {
+		for (const auto& entity : scene.entities) {
+			auto* light = findByDynamicCast<gel::LightComponent>(*entity);
+			bench::doNotOptimize(dynamic_cast<gel::PointLightComponent*>(light));
+		}
+	}, ENTITIES);
+}
+
+BENCH(gel_component_lookup_bench, hit_type_mask) {
+	Scene scene = makeScene();
+	state.run([&] {
+		for (const auto& entity : scene.entities) {
+			auto* light = entity->getComponent<gel::LightComponent>();
+			bench::doNotOptimize(gel::componentCast<gel::PointLightComponent>(light));
+		}
+	}, ENTITIES);
+}
+
+BENCH(gel_component_lookup_bench, miss_dynamic_cast) {
+	Scene scene = makeScene();
+	state.run([&] {
+		for (const auto& entity : scene.entities) {
+			bench::doNotOptimize(findByDynamicCast<gel::RendererComponent>(*entity));
+		}
+	}, ENTITIES);
+}
+
+BENCH(gel_component_lookup_bench, miss_type_mask) {
+	Scene scene = makeScene();
+	state.run([&] {
+		for (const auto& entity : scene.entities) {
+			bench::doNotOptimize(entity->getComponent<gel::RendererComponent>());
+		}
+	}, ENTITIES);
+}
\ No newline at end of file
@@ -0,0 +1,72 @@
+#include "../bench.hpp"
+#include "gem.hpp"
+#include "game_entity.hpp"
+
+#include <memory>
+#include <vector>
+
+// World transforms of 10k entities in 100 chains of depth 100, the way a frame asks for them:
+// rebuilt from the parent chain on every call against the cached matrices, once with a static
+// scene and once with every root moving each frame. Items are entities.
+
+namespace {
+	const size_t CHAINS = 100;
+	const size_t DEPTH = 100;
+
+	struct Hierarchy {
+		std::vector<std::unique_ptr<gel::GameEntity>> entities;
+		std::vector<gel::GameEntity*> roots;
+	};
+
+	Hierarchy makeHierarchy() {
+		Hierarchy result;
+		for (size_t c = 0; c < CHAINS; ++c) {
+			gel::GameEntity* parent = nullptr;
+			for (size_t d = 0; d < DEPTH; ++d) {
+				float f = static_cast<float>(c * DEPTH + d);
+				auto entity = std::make_unique<gel::GameEntity>(
+					gem::Vector<float, 3>{ 0.1f, 0.2f * f, 0.01f },
+					gem::AxisAngle<float>(0.01f * f, 1.0f, 0.5f, 0.25f).toQuaternion(),
+					gem::Vector<float, 3>{ 1.0f, 1.0f, 1.0f });
+
+				if (parent) parent->addChild(entity.get());
+				else result.roots.push_back(entity.get());
+
+				parent = entity.get();
+				result.entities.push_back(std::move(entity));
+			}
+		}
+		return result;
+	}
+}
+
+BENCH(gel_game_entity_bench, world_transform_rebuilt) {
+	Hierarchy hierarchy = makeHierarchy();
+	state.run([&] {
+		for (const auto& entity : hierarchy.entities) {
+			gem::Matrix4<float> m = entity->getWorldTRS().toMatrix();
+			bench::doNotOptimize(m);
+		}
+	}, CHAINS * DEPTH);
+}
+
+BENCH(gel_game_entity_bench, world_transform_cached_static) {
+	Hierarchy hierarchy = makeHierarchy();
+	state.run([&] {
+		for (const auto& entity : hierarchy.entities) {
+			bench::doNotOptimize(entity->getWorldTransform());
+		}
+	}, CHAINS * DEPTH);
+}
+
+BENCH(gel_game_entity_bench, world_transform_cached_moving) {
+	Hierarchy hierarchy = makeHierarchy();
+	float x = 0.0f;
+	state.run([&] {
+		x += 0.001f;
+		for (auto* root : hierarchy.roots) root->setPosition({ x, 0.0f, 0.0f });
+		for (const auto& entity : hierarchy.entities) {
+			bench::doNotOptimize(entity->getWorldTransform());
+		}
+	}, CHAINS * DEPTH);
+}
\ No newline at end of file
@@ -0,0 +1,66 @@
+#include "../bench.hpp"
+#include "gem.hpp"
+#include "game_entity.hpp"
+#include "game_scene.hpp"
+#include "jobs/job_system.hpp"
+#include "physics/rigidbody_component.hpp"
+
+#include <memory>
+#include <vector>
+
+// GameScene::update over 256 root subtrees of 16 entities with a rigidbody each, on one
+// thread against the job system with three workers. The empty case updates the same
+// hierarchy without components, which leaves only the per-frame cost of scheduling the
+// parallel phase. Items are entities.
+
+namespace {
+	const size_t ROOTS = 256;
+	const size_t DEPTH = 16;
+	const float DT = 1.0f / 120.0f;
+
+	void buildScene(gel::GameScene& scene, bool with_components) {
+		for (size_t r = 0; r < ROOTS; ++r) {
+			gel::GameEntity* parent = nullptr;
+			for (size_t d = 0; d < DEPTH; ++d) {
+				gel::GameEntity* entity = scene.createEntity();
+				if (with_components) {
+					auto* rb = scene.createComponent<gel::RigidbodyComponent>(1.0f);
+					rb->setVelocity({ 1.0f, static_cast<float>(d), 0.0f });
+					entity->addComponent(rb);
+				}
+
+				if (parent) parent->addChild(entity);
+				else scene.addEntity(entity);
+				parent = entity;
+			}
+		}
+	}
+}
+
+BENCH(gel_job_system_bench, update_serial) {
+	gel::GameScene scene;
+	buildScene(scene, true);
+	state.run([&] {
+		scene.update(DT);
+	}, ROOTS * DEPTH);
+}
+
+BENCH(gel_job_system_bench, update_parallel) {
+	gel::JobSystem jobs(3);
+	gel::GameScene scene;
+	buildScene(scene, true);
+	scene.setJobSystem(&jobs);
+	state.run([&] {
+		scene.update(DT);
+	}, ROOTS * DEPTH);
+}
+
+BENCH(gel_job_system_bench, update_parallel_empty) {
+	gel::JobSystem jobs(3);
+	gel::GameScene scene;
+	buildScene(scene, false);
+	scene.setJobSystem(&jobs);
+	state.run([&] {
+		scene.update(DT);
+	}, ROOTS * DEPTH);
+}
\ No newline at end of file
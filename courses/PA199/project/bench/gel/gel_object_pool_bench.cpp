@@ -0,0 +1,75 @@
+#include "../bench.hpp"
+#include "gem.hpp"
+#include "game_entity.hpp"
+#include "game_scene.hpp"
+#include "physics/rigidbody_component.hpp"
+
+#include <memory>
+#include <vector>
+
+// Spawning and despawning 1000 entities with a rigidbody each, the way bricks or particles
+// come and go: one new and delete per object against the scene's object pools. The unload
+// cases build 10k entities and tear them all down, one delete per object against freeing
+// the scene's chunks. Items are entities.
+
+namespace {
+	const size_t SPAWNED = 1000;
+	const size_t LOADED = 10000;
+}
+
+BENCH(gel_object_pool_bench, spawn_despawn_new) {
+	std::vector<gel::GameEntity*> entities;
+	state.run([&] {
+		for (size_t i = 0; i < SPAWNED; ++i) {
+			auto* entity = new gel::GameEntity();
+			entity->addComponent(new gel::RigidbodyComponent(1.0f));
+			entities.push_back(entity);
+		}
+		for (auto* entity : entities) {
+			for (auto* comp : entity->getComponents()) delete comp;
+			delete entity;
+		}
+		entities.clear();
+	}, SPAWNED);
+}
+
+BENCH(gel_object_pool_bench, spawn_despawn_pool) {
+	gel::GameScene scene;
+	std::vector<gel::GameEntity*> entities;
+	state.run([&] {
+		for (size_t i = 0; i < SPAWNED; ++i) {
+			auto* entity = scene.createEntity();
+			entity->addComponent(scene.createComponent<gel::RigidbodyComponent>(1.0f));
+			entities.push_back(entity);
+		}
+		for (auto* entity : entities) scene.destroyEntity(entity);
+		entities.clear();
+	}, SPAWNED);
+}
+
+BENCH(gel_object_pool_bench, load_unload_new) {
+	state.run([&] {
+		std::vector<gel::GameEntity*> entities;
+		for (size_t i = 0; i < LOADED; ++i) {
+			auto* entity = new gel::GameEntity();
+			entity->addComponent(new gel::RigidbodyComponent(1.0f));
+			entities.push_back(entity);
+		}
+		for (auto* entity : entities) {
+			for (auto* comp : entity->getComponents()) delete comp;
+			delete entity;
+		}
+	}, LOADED);
+}
+
+BENCH(gel_object_pool_bench, load_unload_pool) {
+	state.run([&] {
+		auto scene = std::make_unique<gel::GameScene>();
+		for (size_t i = 0; i < LOADED; ++i) {
+			auto* entity = scene->createEntity();
+			entity->addComponent(scene->createComponent<gel::RigidbodyComponent>(1.0f));
+			scene->addEntity(entity);
+		}
+		scene.reset();
+	}, LOADED);
+}
\ No newline at end of file
@@ -0,0 +1,74 @@
+#include "../bench.hpp"
+#include "gem.hpp"
+#include "game_entity.hpp"
+#include "ecs/registry.hpp"
+#include "physics/rigidbody_component.hpp"
+
+#include <memory>
+#include <vector>
+
+// One physics step over 100k moving entities: rigidbodies allocated one by one and reached
+// through each entity's component list, the way GameScene::update walks them, against the
+// same components in a registry pool. The last case integrates a plain velocity component
+// without touching the entities, the cost of the pool loop itself. Items are entities.
+
+namespace {
+	const size_t ENTITIES = 100000;
+	const float DT = 1.0f / 120.0f;
+
+	struct Velocity {
+		gem::Vector<float, 3> linear;
+		gem::Vector<float, 3> position;
+	};
+
+	std::vector<std::unique_ptr<gel::GameEntity>> makeEntities(gel::Registry* registry) {
+		std::vector<std::unique_ptr<gel::GameEntity>> result;
+		for (size_t i = 0; i < ENTITIES; ++i) {
+			auto entity = std::make_unique<gel::GameEntity>();
+			float f = static_cast<float>(i);
+			if (registry) {
+				entity->bindRegistry(*registry);
+				entity->emplaceComponent<gel::RigidbodyComponent>(1.0f).setVelocity({ f, 1.0f, 0.0f });
+			} else {
+				auto* rb = new gel::RigidbodyComponent(1.0f);
+				rb->setVelocity({ f, 1.0f, 0.0f });
+				entity->addComponent(rb);
+			}
+			result.push_back(std::move(entity));
+		}
+		return result;
+	}
+}
+
+BENCH(gel_registry_bench, rigidbody_component_lists) {
+	auto entities = makeEntities(nullptr);
+	state.run([&] {
+		for (const auto& entity : entities) {
+			if (!entity->isEnabled()) continue;
+			for (auto* comp : entity->getComponents()) comp->update(DT);
+		}
+	}, ENTITIES);
+
+	for (const auto& entity : entities) {
+		for (auto* comp : entity->getComponents()) delete comp;
+	}
+}
+
+BENCH(gel_registry_bench, rigidbody_registry_pool) {
+	gel::Registry registry;
+	auto entities = makeEntities(&registry);
+	state.run([&] {
+		registry.update(DT);
+	}, ENTITIES);
+}
+
+BENCH(gel_registry_bench, velocity_registry_each) {
+	gel::Registry registry;
+	for (size_t i = 0; i < ENTITIES; ++i) {
+		float f = static_cast<float>(i);
+		registry.emplace<Velocity>(registry.create(), Velocity{ { f, 1.0f, 0.0f }, { 0.0f, 0.0f, 0.0f } });
+	}
+	state.run([&] {
+		registry.each<Velocity>([](Velocity& v) { v.position += v.linear * DT; });
+	}, ENTITIES);
+}
\ No newline at end of file
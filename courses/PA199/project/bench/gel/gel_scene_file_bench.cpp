@@ -0,0 +1,77 @@
+#include "../bench.hpp"
+#include "gem.hpp"
+#include "game_entity.hpp"
+#include "game_scene.hpp"
+#include "io/scene_file.hpp"
+#include "light/point_light_component.hpp"
+#include "physics/rigidbody_component.hpp"
+
+#include <filesystem>
+#include <memory>
+#include <string>
+
+// Startup cost of a level with 10k entities: building it in code the way Application does,
+// loading it from a scene file, and only opening the file, which maps and validates it.
+// Each entity has a rigidbody and every tenth a point light; meshes are left out since they
+// need a GL context. Items are entities.
+
+namespace {
+	const size_t ROOTS = 1000;
+	const size_t DEPTH = 10;
+
+	void buildLevel(gel::GameScene& scene) {
+		for (size_t r = 0; r < ROOTS; ++r) {
+			gel::GameEntity* parent = nullptr;
+			for (size_t d = 0; d < DEPTH; ++d) {
+				auto* entity = scene.createEntity(
+					gem::Vector<float, 3>{ static_cast<float>(r), static_cast<float>(d), 0.0f },
+					gem::AxisAngle<float>{ 0.1f * static_cast<float>(d), 0.0f, 1.0f, 0.0f }.toQuaternion(),
+					gem::Vector<float, 3>{ 1.0f, 1.0f, 1.0f }
+				);
+				entity->addComponent(scene.createComponent<gel::RigidbodyComponent>(1.0f));
+				if (d == 0) {
+					auto* light = scene.createComponent<gel::PointLightComponent>(
+						gem::Vector<float, 3>{ 0.1f, 0.1f, 0.1f }, gem::Vector<float, 3>{ 0.5f, 0.5f, 0.5f }, gem::Vector<float, 3>{ 1.0f, 1.0f, 1.0f }, 5.0f);
+					entity->addComponent(light);
+				}
+
+				if (parent) parent->addChild(entity);
+				else scene.addEntity(entity);
+				parent = entity;
+			}
+		}
+	}
+
+	const std::string& levelPath() {
+		static const std::string path = [] {
+			std::string path = (std::filesystem::temp_directory_path() / "gel_scene_file_bench.gels").string();
+			gel::GameScene scene;
+			buildLevel(scene);
+			gel::exportScene(scene, path);
+			return path;
+		}();
+		return path;
+	}
+}
+
+BENCH(gel_scene_file_bench, build_in_code) {
+	state.run([&] {
+		auto scene = std::make_unique<gel::GameScene>();
+		buildLevel(*scene);
+	}, ROOTS * DEPTH);
+}
+
+BENCH(gel_scene_file_bench, load_file) {
+	const std::string& path = levelPath();
+	state.run([&] {
+		auto scene = std::make_unique<gel::GameScene>();
+		gel::loadScene(*scene, path);
+	}, ROOTS * DEPTH);
+}
+
+BENCH(gel_scene_file_bench, open_file) {
+	const std::string& path = levelPath();
+	state.run([&] {
+		gel::SceneFile file(path);
+	}, ROOTS * DEPTH);
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "gem.hpp"
+
+#include <vector>
+
+// Inputs shared by the gem benchmarks. Element i is turned by 0.01 * i radians around an axis
+// that sweeps with i, and placed along a line leaving the origin.
+
+namespace bench {
+	inline std::vector<gem::Quaternion<float>> makeQuaternions(size_t count) {
+		std::vector<gem::Quaternion<float>> result;
+		result.reserve(count);
+		for (size_t i = 0; i < count; ++i) {
+			float f = static_cast<float>(i);
+			result.push_back(gem::AxisAngle<float>(0.01f * f, 1.0f, 0.5f * f, 0.25f).toQuaternion());
+		}
+		return result;
+	}
+
+	// Unit scale, or one growing differently along each axis for the general TRS paths
+	inline std::vector<gem::Transform<float>> makeTransforms(size_t count, bool uniform_scale = true) {
+		std::vector<gem::Quaternion<float>> rotations = makeQuaternions(count);
+		std::vector<gem::Transform<float>> result;
+		result.reserve(count);
+		for (size_t i = 0; i < count; ++i) {
+			float f = static_cast<float>(i);
+			result.push_back(gem::Transform<float>(
+				gem::Vector<float, 3>{ f * 0.1f, -f * 0.2f, 1.0f + f * 0.05f },
+				rotations[i],
+				uniform_scale ? gem::Vector<float, 3>{ 1.0f, 1.0f, 1.0f } : gem::Vector<float, 3>{ 1.0f + 0.001f * f, 2.0f, 0.5f }
+			));
+		}
+		return result;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,92 @@
+#include "../bench.hpp"
+#include "gem.hpp"
+
+#include <cmath>
+#include <vector>
+
+// Sampling one rotation track per entity for a frame: the scalar track sample in a loop
+// against gathering the segments and blending them with one batch kernel. Items are tracks.
+
+namespace {
+	const size_t COUNT = 4096;
+	const float TIME = 1.3f;
+
+	std::vector<gem::RotationTrack<float>> makeTracks(size_t count) {
+		std::vector<gem::RotationTrack<float>> result(count);
+		for (size_t i = 0; i < count; ++i) {
+			float f = static_cast<float>(i);
+			for (int key = 0; key < 8; ++key) {
+				float angle = std::sin(0.9f * f + key) * 3.0f;
+				result[i].addKey(0.5f * key, gem::AxisAngle<float>(angle, std::sin(f), 1.0f, std::cos(1.7f * f)).toQuaternion());
+			}
+		}
+		return result;
+	}
+
+	void gather(const std::vector<gem::RotationTrack<float>>& tracks, std::vector<gem::TrackCursor>& cursors,
+		gem::VectorArray<float, 4>& from, gem::VectorArray<float, 4>& to, std::vector<float>& t) {
+		from.resize(tracks.size());
+		to.resize(tracks.size());
+		t.resize(tracks.size());
+		auto from_streams = gem::detail::streams(from);
+		auto to_streams = gem::detail::streams(to);
+		for (size_t i = 0; i < tracks.size(); ++i) {
+			gem::TrackSegment<float> segment = tracks[i].locate(TIME, cursors[i]);
+			const auto& a = tracks[i].value(segment.from);
+			const auto& b = tracks[i].value(segment.to);
+			for (size_t k = 0; k < 4; ++k) {
+				from_streams[k][i] = a[k];
+				to_streams[k][i] = b[k];
+			}
+			t[i] = segment.t;
+		}
+	}
+}
+
+BENCH(gem_animation_bench, slerp_loop) {
+	auto tracks = makeTracks(COUNT);
+	std::vector<gem::TrackCursor> cursors(COUNT);
+	std::vector<gem::Quaternion<float>> out(COUNT);
+	state.run([&] {
+		for (size_t i = 0; i < COUNT; ++i) {
+			out[i] = tracks[i].sample(TIME, cursors[i], gem::RotationInterpolation::Slerp);
+		}
+		bench::doNotOptimize(out[0]);
+	}, COUNT);
+}
+
+BENCH(gem_animation_bench, slerp_batch) {
+	auto tracks = makeTracks(COUNT);
+	std::vector<gem::TrackCursor> cursors(COUNT);
+	gem::VectorArray<float, 4> from, to, out;
+	std::vector<float> t;
+	state.run([&] {
+		gather(tracks, cursors, from, to, t);
+		gem::slerp(from, to, t, out);
+		bench::doNotOptimize(out.component(0)[0]);
+	}, COUNT);
+}
+
+BENCH(gem_animation_bench, nlerp_loop) {
+	auto tracks = makeTracks(COUNT);
+	std::vector<gem::TrackCursor> cursors(COUNT);
+	std::vector<gem::Quaternion<float>> out(COUNT);
+	state.run([&] {
+		for (size_t i = 0; i < COUNT; ++i) {
+			out[i] = tracks[i].sample(TIME, cursors[i], gem::RotationInterpolation::Nlerp);
+		}
+		bench::doNotOptimize(out[0]);
+	}, COUNT);
+}
+
+BENCH(gem_animation_bench, nlerp_batch) {
+	auto tracks = makeTracks(COUNT);
+	std::vector<gem::TrackCursor> cursors(COUNT);
+	gem::VectorArray<float, 4> from, to, out;
+	std::vector<float> t;
+	state.run([&] {
+		gather(tracks, cursors, from, to, t);
+		gem::nlerp(from, to, t, out);
+		bench::doNotOptimize(out.component(0)[0]);
+	}, COUNT);
+}
\ No newline at end of file
@@ -0,0 +1,66 @@
+#include "../bench.hpp"
+#include "fixtures.hpp"
+#include "gem.hpp"
+
+#include <vector>
+
+// Chaining rigid transforms down a hierarchy: Matrix4 products against dual quaternion
+// products, and transforming points with the result. Items are chain links or points.
+
+namespace {
+	const size_t COUNT = 1024;
+
+	std::vector<gem::DualQuaternion<float>> makeDualQuaternions(size_t count) {
+		std::vector<gem::DualQuaternion<float>> result;
+		result.reserve(count);
+		for (const auto& t : bench::makeTransforms(count)) {
+			result.push_back(gem::DualQuaternion<float>::fromRotationTranslation(t.rotation, t.position));
+		}
+		return result;
+	}
+
+	std::vector<gem::Matrix4<float>> makeMatrices(const std::vector<gem::DualQuaternion<float>>& dqs) {
+		std::vector<gem::Matrix4<float>> result;
+		result.reserve(dqs.size());
+		for (const auto& dq : dqs) result.push_back(dq.toMatrix());
+		return result;
+	}
+}
+
+BENCH(gem_dual_quaternion_bench, chain_matrix) {
+	auto matrices = makeMatrices(makeDualQuaternions(COUNT));
+	std::vector<gem::Matrix4<float>> world(COUNT);
+	state.run([&] {
+		world[0] = matrices[0];
+		for (size_t i = 1; i < COUNT; ++i) world[i] = world[i - 1] * matrices[i];
+		bench::doNotOptimize(world[COUNT - 1]);
+	}, COUNT);
+}
+
+BENCH(gem_dual_quaternion_bench, chain_dual_quaternion) {
+	auto dqs = makeDualQuaternions(COUNT);
+	std::vector<gem::DualQuaternion<float>> world(COUNT);
+	state.run([&] {
+		world[0] = dqs[0];
+		for (size_t i = 1; i < COUNT; ++i) world[i] = world[i - 1] * dqs[i];
+		bench::doNotOptimize(world[COUNT - 1]);
+	}, COUNT);
+}
+
+BENCH(gem_dual_quaternion_bench, transform_point_matrix) {
+	auto matrices = makeMatrices(makeDualQuaternions(COUNT));
+	std::vector<gem::Vector<float, 4>> points(COUNT);
+	state.run([&] {
+		for (size_t i = 0; i < COUNT; ++i) points[i] = matrices[i] * gem::Vector<float, 4>{ 1.0f, 2.0f, 3.0f, 1.0f };
+		bench::doNotOptimize(points[0]);
+	}, COUNT);
+}
+
+BENCH(gem_dual_quaternion_bench, transform_point_dual_quaternion) {
+	auto dqs = makeDualQuaternions(COUNT);
+	std::vector<gem::Vector<float, 3>> points(COUNT);
+	state.run([&] {
+		for (size_t i = 0; i < COUNT; ++i) points[i] = dqs[i].transformPoint({ 1.0f, 2.0f, 3.0f });
+		bench::doNotOptimize(points[0]);
+	}, COUNT);
+}
\ No newline at end of file
@@ -0,0 +1,95 @@
+#include "../bench.hpp"
+#include "gem.hpp"
+
+#include <cmath>
+#include <vector>
+
+// <cmath> against the gem::fast scalar and SIMD forms. Items are evaluated values.
+
+namespace {
+	const size_t COUNT = 4096;
+
+	std::vector<float> makeInputs(float from, float to) {
+		std::vector<float> result(COUNT);
+		for (size_t i = 0; i < COUNT; ++i) {
+			result[i] = from + (to - from) * static_cast<float>(i) / static_cast<float>(COUNT - 1);
+		}
+		return result;
+	}
+
+	template<typename F>
+	void runScalar(bench::State& state, const std::vector<float>& in, F f) {
+		std::vector<float> out(COUNT);
+		state.run([&] {
+			for (size_t i = 0; i < COUNT; ++i) out[i] = f(in[i]);
+			bench::doNotOptimize(out[0]);
+		}, COUNT);
+	}
+
+	template<typename F>
+	void runPacket(bench::State& state, const std::vector<float>& in, F f) {
+		std::vector<float> out(COUNT);
+		state.run([&] {
+			for (size_t i = 0; i < COUNT; i += 4) gem::simd::store(&out[i], f(gem::simd::load(&in[i])));
+			bench::doNotOptimize(out[0]);
+		}, COUNT);
+	}
+}
+
+BENCH(gem_fast_math_bench, sin_std) {
+	runScalar(state, makeInputs(-10.0f, 10.0f), [](float x) { return std::sin(x); });
+}
+
+BENCH(gem_fast_math_bench, sin_fast) {
+	runScalar(state, makeInputs(-10.0f, 10.0f), [](float x) { return gem::fast::sin(x); });
+}
+
+BENCH(gem_fast_math_bench, sin_fast_simd) {
+	runPacket(state, makeInputs(-10.0f, 10.0f), [](gem::simd::f32x4 x) { return gem::fast::sin(x); });
+}
+
+BENCH(gem_fast_math_bench, atan2_std) {
+	runScalar(state, makeInputs(-10.0f, 10.0f), [](float x) { return std::atan2(x, 0.5f); });
+}
+
+BENCH(gem_fast_math_bench, atan2_fast) {
+	runScalar(state, makeInputs(-10.0f, 10.0f), [](float x) { return gem::fast::atan2(x, 0.5f); });
+}
+
+BENCH(gem_fast_math_bench, atan2_fast_simd) {
+	runPacket(state, makeInputs(-10.0f, 10.0f), [](gem::simd::f32x4 x) { return gem::fast::atan2(x, gem::simd::broadcast(0.5f)); });
+}
+
+BENCH(gem_fast_math_bench, acos_std) {
+	runScalar(state, makeInputs(-1.0f, 1.0f), [](float x) { return std::acos(x); });
+}
+
+BENCH(gem_fast_math_bench, acos_fast) {
+	runScalar(state, makeInputs(-1.0f, 1.0f), [](float x) { return gem::fast::acos(x); });
+}
+
+BENCH(gem_fast_math_bench, acos_fast_simd) {
+	runPacket(state, makeInputs(-1.0f, 1.0f), [](gem::simd::f32x4 x) { return gem::fast::acos(x); });
+}
+
+BENCH(gem_fast_math_bench, rsqrt_std) {
+	runScalar(state, makeInputs(0.1f, 100.0f), [](float x) { return 1.0f / std::sqrt(x); });
+}
+
+BENCH(gem_fast_math_bench, rsqrt_fast) {
+	runScalar(state, makeInputs(0.1f, 100.0f), [](float x) { return gem::fast::rsqrt(x); });
+}
+
+BENCH(gem_fast_math_bench, rsqrt_fast_simd) {
+	runPacket(state, makeInputs(0.1f, 100.0f), [](gem::simd::f32x4 x) { return gem::fast::rsqrt(x); });
+}
+
+// The brick collision path: cartesian offset to polar coordinates
+BENCH(gem_fast_math_bench, polar_from_cartesian) {
+	auto xs = makeInputs(-10.0f, 10.0f);
+	std::vector<gem::Polar<float>> out(COUNT);
+	state.run([&] {
+		for (size_t i = 0; i < COUNT; ++i) out[i] = gem::Polar<float>::fromCartesian(gem::Vector<float, 2>{ xs[i], 1.5f });
+		bench::doNotOptimize(out[0]);
+	}, COUNT);
+}
\ No newline at end of file
@@ -0,0 +1,131 @@
+#include "../bench.hpp"
+#include "gem.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+// One frustum or ray against many volumes: a loop over the scalar tests on std::vector of
+// primitives against the batch queries on VectorArray streams. Items are volumes.
+
+namespace {
+	const size_t COUNT = 4096;
+
+	std::vector<gem::Sphere<float>> makeSpheres(size_t count) {
+		std::vector<gem::Sphere<float>> result;
+		for (size_t i = 0; i < count; ++i) {
+			float f = static_cast<float>(i);
+			result.push_back({ { std::sin(0.9f * f) * 60.0f, std::sin(1.7f * f) * 20.0f, std::cos(0.6f * f) * 60.0f - 30.0f }, 0.5f + std::fabs(std::sin(2.3f * f)) * 2.0f });
+		}
+		return result;
+	}
+
+	gem::VectorArray<float, 4> makeSphereArray(size_t count) {
+		gem::VectorArray<float, 4> result;
+		for (const auto& s : makeSpheres(count)) {
+			result.push_back({ s.center[0], s.center[1], s.center[2], s.radius });
+		}
+		return result;
+	}
+
+	const gem::Frustum<float> FRUSTUM = gem::Frustum<float>::fromMatrix(
+		gem::Matrix4<float>::perspective(60.0f, 16.0f / 9.0f, 0.1f, 100.0f) *
+		gem::Matrix4<float>::lookAt({ 0.0f, 10.0f, 20.0f }, { 0.0f, 0.0f, -20.0f }, { 0.0f, 1.0f, 0.0f }));
+
+	const gem::Ray<float> RAY{ { -70.0f, 0.0f, -30.0f }, gem::Vector<float, 3>{ 1.0f, 0.02f, 0.1f }.normalize() };
+}
+
+BENCH(gem_geometry_bench, frustum_spheres_loop) {
+	auto spheres = makeSpheres(COUNT);
+	std::vector<uint8_t> visible(COUNT);
+	state.run([&] {
+		for (size_t i = 0; i < COUNT; ++i) {
+			visible[i] = FRUSTUM.intersects(spheres[i]) ? 1 : 0;
+		}
+		bench::doNotOptimize(visible[0]);
+	}, COUNT);
+}
+
+BENCH(gem_geometry_bench, frustum_spheres_batch) {
+	auto spheres = makeSphereArray(COUNT);
+	std::vector<uint8_t> visible;
+	state.run([&] {
+		gem::intersects(FRUSTUM, spheres, visible);
+		bench::doNotOptimize(visible[0]);
+	}, COUNT);
+}
+
+BENCH(gem_geometry_bench, frustum_boxes_loop) {
+	std::vector<gem::AABB<float>> boxes;
+	for (const auto& s : makeSpheres(COUNT)) boxes.push_back(s.boundingBox());
+	std::vector<uint8_t> visible(COUNT);
+	state.run([&] {
+		for (size_t i = 0; i < COUNT; ++i) {
+			visible[i] = FRUSTUM.intersects(boxes[i]) ? 1 : 0;
+		}
+		bench::doNotOptimize(visible[0]);
+	}, COUNT);
+}
+
+BENCH(gem_geometry_bench, frustum_boxes_batch) {
+	gem::VectorArray<float, 3> mins, maxs;
+	for (const auto& s : makeSpheres(COUNT)) {
+		auto box = s.boundingBox();
+		mins.push_back(box.min);
+		maxs.push_back(box.max);
+	}
+	std::vector<uint8_t> visible;
+	state.run([&] {
+		gem::intersects(FRUSTUM, mins, maxs, visible);
+		bench::doNotOptimize(visible[0]);
+	}, COUNT);
+}
+
+BENCH(gem_geometry_bench, ray_spheres_loop) {
+	auto spheres = makeSpheres(COUNT);
+	std::vector<float> hits(COUNT);
+	state.run([&] {
+		for (size_t i = 0; i < COUNT; ++i) {
+			float t = 0.0f;
+			hits[i] = RAY.intersect(spheres[i], t) ? t : std::numeric_limits<float>::infinity();
+		}
+		bench::doNotOptimize(hits[0]);
+	}, COUNT);
+}
+
+BENCH(gem_geometry_bench, ray_spheres_batch) {
+	auto spheres = makeSphereArray(COUNT);
+	std::vector<float> hits;
+	state.run([&] {
+		gem::intersect(RAY, spheres, hits);
+		bench::doNotOptimize(hits[0]);
+	}, COUNT);
+}
+
+BENCH(gem_geometry_bench, ray_boxes_loop) {
+	std::vector<gem::AABB<float>> boxes;
+	for (const auto& s : makeSpheres(COUNT)) boxes.push_back(s.boundingBox());
+	std::vector<float> hits(COUNT);
+	state.run([&] {
+		for (size_t i = 0; i < COUNT; ++i) {
+			float t = 0.0f;
+			hits[i] = RAY.intersect(boxes[i], t) ? t : std::numeric_limits<float>::infinity();
+		}
+		bench::doNotOptimize(hits[0]);
+	}, COUNT);
+}
+
+BENCH(gem_geometry_bench, ray_boxes_batch) {
+	gem::VectorArray<float, 3> mins, maxs;
+	for (const auto& s : makeSpheres(COUNT)) {
+		auto box = s.boundingBox();
+		mins.push_back(box.min);
+		maxs.push_back(box.max);
+	}
+	std::vector<float> hits;
+	state.run([&] {
+		gem::intersect(RAY, mins, maxs, hits);
+		bench::doNotOptimize(hits[0]);
+	}, COUNT);
+}
\ No newline at end of file
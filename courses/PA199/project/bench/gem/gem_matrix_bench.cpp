@@ -0,0 +1,128 @@
+#include "../bench.hpp"
+#include "fixtures.hpp"
+#include "gem.hpp"
+
+#include <vector>
+
+namespace {
+	std::vector<gem::Matrix4<float>> makeMatrices(const std::vector<gem::Transform<float>>& transforms) {
+		std::vector<gem::Matrix4<float>> result;
+		result.reserve(transforms.size());
+		for (const auto& t : transforms) {
+			result.push_back(
+				gem::Matrix4<float>::translation(t.position) *
+				gem::Matrix4<float>::rotation(t.rotation) *
+				gem::Matrix4<float>::scale(t.scale));
+		}
+		return result;
+	}
+
+	const size_t COUNT = 1024;
+}
+
+BENCH(gem_matrix_bench, m4_inverse_general) {
+	auto matrices = makeMatrices(bench::makeTransforms(COUNT, false));
+	state.run([&] {
+		for (const auto& m : matrices) {
+			gem::Matrix4<float> inv = m.inverse();
+			bench::doNotOptimize(inv);
+		}
+	}, COUNT);
+}
+
+BENCH(gem_matrix_bench, m4_inverse_affine) {
+	auto matrices = makeMatrices(bench::makeTransforms(COUNT, false));
+	state.run([&] {
+		for (const auto& m : matrices) {
+			gem::Matrix4<float> inv = m.affineInverse();
+			bench::doNotOptimize(inv);
+		}
+	}, COUNT);
+}
+
+BENCH(gem_matrix_bench, m4_inverse_trs) {
+	auto transforms = bench::makeTransforms(COUNT, false);
+	state.run([&] {
+		for (const auto& t : transforms) {
+			gem::Matrix4<float> inv = gem::Matrix4<float>::inverseTRS(t.position, t.rotation, t.scale);
+			bench::doNotOptimize(inv);
+		}
+	}, COUNT);
+}
+
+BENCH(gem_matrix_bench, m4_build_and_inverse_general) {
+	auto transforms = bench::makeTransforms(COUNT, false);
+	state.run([&] {
+		for (const auto& t : transforms) {
+			gem::Matrix4<float> inv = (
+				gem::Matrix4<float>::translation(t.position) *
+				gem::Matrix4<float>::rotation(t.rotation) *
+				gem::Matrix4<float>::scale(t.scale)).inverse();
+			bench::doNotOptimize(inv);
+		}
+	}, COUNT);
+}
+
+BENCH(gem_matrix_bench, m4_mul) {
+	auto matrices = makeMatrices(bench::makeTransforms(COUNT, false));
+	state.run([&] {
+		for (size_t i = 0; i + 1 < matrices.size(); ++i) {
+			gem::Matrix4<float> m = matrices[i] * matrices[i + 1];
+			bench::doNotOptimize(m);
+		}
+	}, COUNT - 1);
+}
+
+
+// World transforms as affine 3x4 matrices: 12 floats and 36 multiplies per product instead of 16 and 64
+BENCH(gem_matrix_bench, m3x4_mul) {
+	auto matrices = makeMatrices(bench::makeTransforms(COUNT, false));
+	std::vector<gem::Matrix3x4<float>> affine;
+	for (const auto& m : matrices) affine.push_back(m.toAffine());
+	state.run([&] {
+		for (size_t i = 0; i + 1 < affine.size(); ++i) {
+			gem::Matrix3x4<float> m = affine[i] * affine[i + 1];
+			bench::doNotOptimize(m);
+		}
+	}, COUNT - 1);
+}
+
+BENCH(gem_matrix_bench, m4_rotation_loop) {
+	std::vector<gem::Quaternion<float>> quaternions = bench::makeQuaternions(COUNT);
+	std::vector<gem::Matrix4<float>> out(COUNT);
+	state.run([&] {
+		for (size_t i = 0; i < COUNT; ++i) {
+			out[i] = gem::Matrix4<float>::rotation(quaternions[i]);
+		}
+		bench::doNotOptimize(out[0]);
+	}, COUNT);
+}
+
+BENCH(gem_matrix_bench, m4_rotation_batch) {
+	std::vector<gem::Quaternion<float>> quaternions = bench::makeQuaternions(COUNT);
+	std::vector<gem::Matrix4<float>> out;
+	state.run([&] {
+		gem::Matrix4<float>::rotation(quaternions, out);
+		bench::doNotOptimize(out[0]);
+	}, COUNT);
+}
+
+BENCH(gem_matrix_bench, m4_normal_matrix_inverse_transpose) {
+	auto matrices = makeMatrices(bench::makeTransforms(COUNT, false));
+	state.run([&] {
+		for (const auto& m : matrices) {
+			gem::Matrix4<float> n = m.inverse().transpose();
+			bench::doNotOptimize(n);
+		}
+	}, COUNT);
+}
+
+BENCH(gem_matrix_bench, m4_normal_matrix) {
+	auto matrices = makeMatrices(bench::makeTransforms(COUNT, false));
+	state.run([&] {
+		for (const auto& m : matrices) {
+			gem::Matrix3<float> n = m.normalMatrix();
+			bench::doNotOptimize(n);
+		}
+	}, COUNT);
+}
\ No newline at end of file
@@ -0,0 +1,56 @@
+#include "../bench.hpp"
+#include "fixtures.hpp"
+#include "gem.hpp"
+
+#include <vector>
+
+namespace {
+	const size_t COUNT = 1024;
+}
+
+BENCH(gem_quaternion_bench, q_rotate_sandwich) {
+	auto quaternions = bench::makeQuaternions(COUNT);
+	gem::Vector<float, 3> v = { 1.0f, 2.0f, 3.0f };
+	state.run([&] {
+		for (const auto& q : quaternions) {
+			gem::Quaternion<float> r = q * gem::Quaternion<float>(0.0f, v[0], v[1], v[2]) * q.conjugate();
+			bench::doNotOptimize(r);
+		}
+	}, COUNT);
+}
+
+BENCH(gem_quaternion_bench, q_rotate) {
+	auto quaternions = bench::makeQuaternions(COUNT);
+	gem::Vector<float, 3> v = { 1.0f, 2.0f, 3.0f };
+	state.run([&] {
+		for (const auto& q : quaternions) {
+			gem::Vector<float, 3> r = q.rotate(v);
+			bench::doNotOptimize(r);
+		}
+	}, COUNT);
+}
+
+// Right, up and forward the way GameEntity used to compute them
+BENCH(gem_quaternion_bench, q_axes_rotate_normalize) {
+	auto quaternions = bench::makeQuaternions(COUNT);
+	state.run([&] {
+		for (const auto& q : quaternions) {
+			gem::Vector<float, 3> right = q.rotate({ 1.0f, 0.0f, 0.0f }).normalize();
+			gem::Vector<float, 3> up = q.rotate({ 0.0f, 1.0f, 0.0f }).normalize();
+			gem::Vector<float, 3> forward = q.rotate({ 0.0f, 0.0f, 1.0f }).normalize();
+			bench::doNotOptimize(right);
+			bench::doNotOptimize(up);
+			bench::doNotOptimize(forward);
+		}
+	}, COUNT);
+}
+
+BENCH(gem_quaternion_bench, q_basis) {
+	auto quaternions = bench::makeQuaternions(COUNT);
+	state.run([&] {
+		for (const auto& q : quaternions) {
+			gem::Basis<float> basis = q.basis();
+			bench::doNotOptimize(basis);
+		}
+	}, COUNT);
+}
\ No newline at end of file
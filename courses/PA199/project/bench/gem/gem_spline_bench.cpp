@@ -0,0 +1,53 @@
+#include "../bench.hpp"
+#include "gem.hpp"
+
+#include <cmath>
+#include <vector>
+
+// Sampling a path at many uniform parameters: evaluating every point directly against
+// tessellating with forward differences. Items are points.
+
+namespace {
+	const size_t SEGMENTS = 64;
+	const size_t STEPS = 64;
+	const size_t COUNT = SEGMENTS * STEPS + 1;
+
+	gem::CubicSpline<float, 3> makeSpline() {
+		std::vector<gem::Vector<float, 3>> points;
+		for (size_t i = 0; i <= SEGMENTS; ++i) {
+			float f = static_cast<float>(i);
+			points.push_back({ std::sin(0.9f * f) * 20.0f, std::sin(1.7f * f) * 5.0f, f });
+		}
+		return gem::CubicSpline<float, 3>::catmullRom(points);
+	}
+}
+
+BENCH(gem_spline_bench, evaluate_loop) {
+	auto spline = makeSpline();
+	std::vector<gem::Vector<float, 3>> points(COUNT);
+	state.run([&] {
+		for (size_t i = 0; i < COUNT; ++i) {
+			points[i] = spline.evaluate(static_cast<float>(i) / (COUNT - 1));
+		}
+		bench::doNotOptimize(points[0]);
+	}, COUNT);
+}
+
+BENCH(gem_spline_bench, tessellate) {
+	auto spline = makeSpline();
+	std::vector<gem::Vector<float, 3>> points;
+	state.run([&] {
+		spline.tessellate(STEPS, points);
+		bench::doNotOptimize(points[0]);
+	}, COUNT);
+}
+
+BENCH(gem_spline_bench, arc_length_parameters) {
+	auto spline = makeSpline();
+	gem::ArcLengthTable<float> table(spline);
+	std::vector<float> parameters;
+	state.run([&] {
+		table.parameters(COUNT, parameters);
+		bench::doNotOptimize(parameters[0]);
+	}, COUNT);
+}
\ No newline at end of file
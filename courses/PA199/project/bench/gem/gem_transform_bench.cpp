@@ -0,0 +1,45 @@
+#include "../bench.hpp"
+#include "fixtures.hpp"
+#include "gem.hpp"
+
+#include <vector>
+
+namespace {
+	const size_t COUNT = 1024;
+}
+
+// One hierarchy step the way GameEntity::getWorldTransform used to do it
+BENCH(gem_transform_bench, compose_matrix) {
+	auto transforms = bench::makeTransforms(COUNT);
+	state.run([&] {
+		gem::Matrix4<float> world = gem::Matrix4<float>::identity();
+		for (const auto& t : transforms) {
+			world = world * (
+				gem::Matrix4<float>::translation(t.position) *
+				gem::Matrix4<float>::rotation(t.rotation) *
+				gem::Matrix4<float>::scale(t.scale));
+		}
+		bench::doNotOptimize(world);
+	}, COUNT);
+}
+
+BENCH(gem_transform_bench, compose_trs) {
+	auto transforms = bench::makeTransforms(COUNT);
+	state.run([&] {
+		gem::Transform<float> world;
+		for (const auto& t : transforms) {
+			world = world * t;
+		}
+		bench::doNotOptimize(world);
+	}, COUNT);
+}
+
+BENCH(gem_transform_bench, to_matrix) {
+	auto transforms = bench::makeTransforms(COUNT);
+	state.run([&] {
+		for (const auto& t : transforms) {
+			gem::Matrix4<float> m = t.toMatrix();
+			bench::doNotOptimize(m);
+		}
+	}, COUNT);
+}
\ No newline at end of file
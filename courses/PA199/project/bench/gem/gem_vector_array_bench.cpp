@@ -0,0 +1,159 @@
+#include "../bench.hpp"
+#include "gem.hpp"
+
+#include <cmath>
+#include <vector>
+
+// Each kernel is measured twice: as a loop over std::vector<gem::Vector> (array of structures)
+// and as the gem::VectorArray batch kernel (structure of arrays). Items are vectors.
+
+namespace {
+	const size_t COUNT = 4096;
+	const float DT = 0.016f;
+
+	template<size_t N>
+	std::vector<gem::Vector<float, N>> makeVectors(size_t count) {
+		std::vector<gem::Vector<float, N>> result;
+		for (size_t i = 0; i < count; ++i) {
+			gem::Vector<float, N> v;
+			for (size_t k = 0; k < N; ++k) {
+				v[k] = std::sin(0.1f * static_cast<float>(i) + static_cast<float>(k)) * 10.0f;
+			}
+			result.push_back(v);
+		}
+		return result;
+	}
+
+	template<size_t N>
+	gem::VectorArray<float, N> makeArray(size_t count) {
+		gem::VectorArray<float, N> result;
+		for (const auto& v : makeVectors<N>(count)) {
+			result.push_back(v);
+		}
+		return result;
+	}
+
+	const gem::Quaternion<float> ROTATION = gem::AxisAngle<float>(0.8f, 1.0f, 2.0f, 3.0f).toQuaternion().normalize();
+
+	const gem::Matrix4<float> MODEL = gem::Matrix4<float>::translation({ 1.0f, 2.0f, 3.0f }) * gem::Matrix4<float>::rotation(ROTATION);
+}
+
+BENCH(gem_vector_array_bench, integrate_aos) {
+	auto position = makeVectors<3>(COUNT);
+	auto velocity = makeVectors<3>(COUNT);
+	state.run([&] {
+		for (size_t i = 0; i < COUNT; ++i) {
+			position[i] += velocity[i] * DT;
+		}
+		bench::doNotOptimize(position[0]);
+	}, COUNT);
+}
+
+BENCH(gem_vector_array_bench, integrate_soa) {
+	auto position = makeArray<3>(COUNT);
+	auto velocity = makeArray<3>(COUNT);
+	state.run([&] {
+		gem::fma(velocity, DT, position, position);
+		bench::doNotOptimize(position.component(0)[0]);
+	}, COUNT);
+}
+
+BENCH(gem_vector_array_bench, normalize_aos) {
+	auto in = makeVectors<3>(COUNT);
+	std::vector<gem::Vector<float, 3>> out(COUNT);
+	state.run([&] {
+		for (size_t i = 0; i < COUNT; ++i) {
+			out[i] = in[i].normalize();
+		}
+		bench::doNotOptimize(out[0]);
+	}, COUNT);
+}
+
+BENCH(gem_vector_array_bench, normalize_soa) {
+	auto in = makeArray<3>(COUNT);
+	gem::VectorArray<float, 3> out;
+	state.run([&] {
+		gem::normalize(in, out);
+		bench::doNotOptimize(out.component(0)[0]);
+	}, COUNT);
+}
+
+BENCH(gem_vector_array_bench, transform_points_aos) {
+	auto in = makeVectors<3>(COUNT);
+	std::vector<gem::Vector<float, 4>> out(COUNT);
+	state.run([&] {
+		for (size_t i = 0; i < COUNT; ++i) {
+			out[i] = MODEL * gem::Vector<float, 4>{ in[i][0], in[i][1], in[i][2], 1.0f };
+		}
+		bench::doNotOptimize(out[0]);
+	}, COUNT);
+}
+
+BENCH(gem_vector_array_bench, transform_points_soa) {
+	auto in = makeArray<3>(COUNT);
+	gem::VectorArray<float, 3> out;
+	state.run([&] {
+		gem::transformPoints(MODEL, in, out);
+		bench::doNotOptimize(out.component(0)[0]);
+	}, COUNT);
+}
+
+BENCH(gem_vector_array_bench, rotate_aos) {
+	auto in = makeVectors<3>(COUNT);
+	std::vector<gem::Vector<float, 3>> out(COUNT);
+	state.run([&] {
+		for (size_t i = 0; i < COUNT; ++i) {
+			out[i] = ROTATION.rotate(in[i]);
+		}
+		bench::doNotOptimize(out[0]);
+	}, COUNT);
+}
+
+BENCH(gem_vector_array_bench, rotate_soa) {
+	auto in = makeArray<3>(COUNT);
+	gem::VectorArray<float, 3> out;
+	state.run([&] {
+		gem::rotate(ROTATION, in, out);
+		bench::doNotOptimize(out.component(0)[0]);
+	}, COUNT);
+}
+
+BENCH(gem_vector_array_bench, to_polar_aos) {
+	auto in = makeVectors<2>(COUNT);
+	std::vector<gem::Polar<float>> out(COUNT);
+	state.run([&] {
+		for (size_t i = 0; i < COUNT; ++i) {
+			out[i] = gem::Polar<float>::fromCartesian(in[i]);
+		}
+		bench::doNotOptimize(out[0]);
+	}, COUNT);
+}
+
+BENCH(gem_vector_array_bench, to_polar_soa) {
+	auto in = makeArray<2>(COUNT);
+	gem::VectorArray<float, 2> out;
+	state.run([&] {
+		gem::toPolar(in, out);
+		bench::doNotOptimize(out.component(0)[0]);
+	}, COUNT);
+}
+
+BENCH(gem_vector_array_bench, to_cartesian_aos) {
+	auto in = makeVectors<2>(COUNT);
+	std::vector<gem::Vector<float, 2>> out(COUNT);
+	state.run([&] {
+		for (size_t i = 0; i < COUNT; ++i) {
+			out[i] = gem::Polar<float>(in[i][0], in[i][1]).toCartesian();
+		}
+		bench::doNotOptimize(out[0]);
+	}, COUNT);
+}
+
+BENCH(gem_vector_array_bench, to_cartesian_soa) {
+	auto in = makeArray<2>(COUNT);
+	gem::VectorArray<float, 2> out;
+	state.run([&] {
+		gem::toCartesian(in, out);
+		bench::doNotOptimize(out.component(0)[0]);
+	}, COUNT);
+}
\ No newline at end of file
@@ -0,0 +1,96 @@
+#include "../bench.hpp"
+#include "gem.hpp"
+
+#include <vector>
+
+namespace {
+	template<size_t N>
+	struct Particles {
+		std::vector<gem::Vector<float, N>> position;
+		std::vector<gem::Vector<float, N>> velocity;
+		std::vector<gem::Vector<float, N>> force;
+	};
+
+	template<size_t N>
+	Particles<N> makeParticles(size_t count) {
+		Particles<N> result;
+		for (size_t i = 0; i < count; ++i) {
+			gem::Vector<float, N> p, v, f;
+			for (size_t k = 0; k < N; ++k) {
+				p[k] = static_cast<float>(i + k);
+				v[k] = 0.5f * static_cast<float>(k) - 1.0f;
+				f[k] = 0.01f * static_cast<float>(i % 7);
+			}
+			result.position.push_back(p);
+			result.velocity.push_back(v);
+			result.force.push_back(f);
+		}
+		return result;
+	}
+
+	const size_t COUNT = 1024;
+	const float DT = 0.016f;
+	const float INV_MASS = 0.1f;
+
+	// Semi-implicit Euler step written with the gem operators
+	template<size_t N>
+	void integrateExpressions(Particles<N>& p) {
+		for (size_t i = 0; i < p.position.size(); ++i) {
+			p.velocity[i] += p.force[i] * INV_MASS * DT;
+			p.position[i] += p.velocity[i] * DT;
+		}
+	}
+
+	// Same step written out by hand, the lower bound for the expression version
+	template<size_t N>
+	void integrateHandWritten(Particles<N>& p) {
+		for (size_t i = 0; i < p.position.size(); ++i) {
+			for (size_t k = 0; k < N; ++k) {
+				p.velocity[i][k] += p.force[i][k] * INV_MASS * DT;
+				p.position[i][k] += p.velocity[i][k] * DT;
+			}
+		}
+	}
+}
+
+BENCH(gem_vector_bench, v3_integrate_expressions) {
+	auto particles = makeParticles<3>(COUNT);
+	state.run([&] {
+		integrateExpressions(particles);
+		bench::doNotOptimize(particles.position[0]);
+	}, COUNT);
+}
+
+BENCH(gem_vector_bench, v3_integrate_hand_written) {
+	auto particles = makeParticles<3>(COUNT);
+	state.run([&] {
+		integrateHandWritten(particles);
+		bench::doNotOptimize(particles.position[0]);
+	}, COUNT);
+}
+
+BENCH(gem_vector_bench, v4_integrate_expressions) {
+	auto particles = makeParticles<4>(COUNT);
+	state.run([&] {
+		integrateExpressions(particles);
+		bench::doNotOptimize(particles.position[0]);
+	}, COUNT);
+}
+
+BENCH(gem_vector_bench, v4_integrate_hand_written) {
+	auto particles = makeParticles<4>(COUNT);
+	state.run([&] {
+		integrateHandWritten(particles);
+		bench::doNotOptimize(particles.position[0]);
+	}, COUNT);
+}
+
+BENCH(gem_vector_bench, v3_lerp) {
+	auto particles = makeParticles<3>(COUNT);
+	state.run([&] {
+		for (size_t i = 0; i + 1 < COUNT; ++i) {
+			gem::Vector<float, 3> v = gem::lerp(particles.position[i], particles.position[i + 1], 0.25f);
+			bench::doNotOptimize(v);
+		}
+	}, COUNT - 1);
+}
\ No newline at end of file
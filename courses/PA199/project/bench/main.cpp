@@ -0,0 +1,24 @@
+#include "bench.hpp"
+
+#include <cstdio>
+#include <string>
+
+// Runs every registered benchmark, or only those whose name contains argv[1].
+int main(int argc, char** argv) {
+	std::string filter = argc > 1 ? argv[1] : "";
+
+	std::printf("%-56s %14s %16s\n", "benchmark", "ns/iter", "items/s");
+	for (auto& c : bench::registry()) {
+		if (!filter.empty() && c.name.find(filter) == std::string::npos) continue;
+
+		bench::State state(c.name);
+		c.body(state);
+
+		if (state.hasResult()) {
+			const bench::Result& r = state.result();
+			std::printf("%-56s %14.2f %16.4g\n", r.name.c_str(), r.ns_per_iteration, r.items_per_second);
+		}
+	}
+
+	return 0;
+}
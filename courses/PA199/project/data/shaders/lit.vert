@@ -1,20 +1,31 @@
 #version 430 core
 
 layout(location = 0) in vec3 inPos;
-layout(location = 1) in vec3 inNormal;
+layout(location = 1) in vec3 inNormal; // xy holds an octahedral normal when packed_normals is set
 layout(location = 2) in vec2 inUV;
 
 uniform mat4 model;
+uniform mat3 normal_matrix; // transpose(inverse(mat3(model))), computed once per object on the CPU
 uniform mat4 view;
 uniform mat4 proj;
+uniform bool packed_normals;
 
 out vec3 FragPos;
 out vec3 Normal;
 out vec2 TexCoord;
 
+// Inverse of gem::octEncode
+vec3 octDecode(vec2 e) {
+	vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+	if (n.z < 0.0) n.xy = (1.0 - abs(n.yx)) * vec2(n.x >= 0.0 ? 1.0 : -1.0, n.y >= 0.0 ? 1.0 : -1.0);
+	return normalize(n);
+}
+
 void main() {
+	vec3 normal = packed_normals ? octDecode(inNormal.xy) : inNormal;
+
 	FragPos = vec3(model * vec4(inPos, 1.0));
-	Normal = mat3(transpose(inverse(model))) * inNormal;
+	Normal = normal_matrix * normal;
 	TexCoord = inUV;
 
 	gl_Position = proj * view * vec4(FragPos, 1.0);
@@ -0,0 +1 @@
+#include "animator_component.hpp"
\ No newline at end of file
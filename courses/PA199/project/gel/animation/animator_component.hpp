@@ -0,0 +1,141 @@
+#pragma once
+
+#include "gem.hpp"
+#include "game_entity.hpp"
+#include "game_component.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace gel {
+	class GameEntity; // Forward declaration
+
+	// Plays animation clips on any number of entities. All bindings are sampled together each
+	// update: the track cursors collect every entity's surrounding keys, one batch kernel per
+	// channel blends them and the results are written back to the entities. Nlerp rotations
+	// are the exception, they are cheaper to sample per track than to gather for a kernel.
+	class AnimatorComponent : public GameComponent {
+		GEL_COMPONENT(AnimatorComponent, GameComponent)
+
+	public:
+		using Clip = gem::AnimationClip<float>;
+
+		AnimatorComponent(gem::RotationInterpolation rotation_interpolation = gem::RotationInterpolation::Nlerp)
+			: rotation_interpolation_(rotation_interpolation) {};
+
+		// Starts playing `clip` on `target` from `offset` seconds. The clip must outlive the binding.
+		void play(GameEntity* target, const Clip* clip, bool loop = true, float offset = 0.0f) {
+			bindings_.push_back({ target, clip, offset, loop, {}, {}, {} });
+		}
+
+		void stop(GameEntity* target) {
+			bindings_.erase(std::remove_if(bindings_.begin(), bindings_.end(),
+				[target](const Binding& binding) { return binding.target == target; }), bindings_.end());
+		}
+
+		bool isPlaying(GameEntity* target) const {
+			return std::any_of(bindings_.begin(), bindings_.end(),
+				[target](const Binding& binding) { return binding.target == target; });
+		}
+
+		// delta_time is in milliseconds like every update, clips are keyed in seconds
+		void update(float delta_time) override {
+			for (auto& binding : bindings_) {
+				binding.time += delta_time * 0.001f;
+
+				float duration = binding.clip->duration();
+				if (binding.loop && duration > 0.0f && binding.time >= duration) {
+					binding.time = std::fmod(binding.time, duration);
+				}
+			}
+
+			if (gather(&Clip::position, &Binding::position, from3_, to3_)) {
+				gem::lerp(from3_, to3_, t_, out3_);
+				for (size_t i = 0; i < targets_.size(); ++i) targets_[i]->setPosition(out3_.get(i));
+			}
+
+			if (gather(&Clip::scale, &Binding::scale, from3_, to3_)) {
+				gem::lerp(from3_, to3_, t_, out3_);
+				for (size_t i = 0; i < targets_.size(); ++i) targets_[i]->setScale(out3_.get(i));
+			}
+
+			if (rotation_interpolation_ == gem::RotationInterpolation::Nlerp) {
+				for (auto& binding : bindings_) {
+					const auto& keys = binding.clip->rotation;
+					if (!keys.empty()) binding.target->setOrientation(keys.sample(binding.time, binding.rotation));
+				}
+			}
+			else if (gather(&Clip::rotation, &Binding::rotation, from4_, to4_)) {
+				gem::slerp(from4_, to4_, t_, out4_);
+				for (size_t i = 0; i < targets_.size(); ++i) targets_[i]->setOrientation(gem::Quaternion<float>(out4_.get(i)));
+			}
+		};
+
+		void render() override {};
+
+	private:
+		struct Binding {
+			GameEntity* target;
+			const Clip* clip;
+			float time;
+			bool loop;
+			gem::TrackCursor position;
+			gem::TrackCursor rotation;
+			gem::TrackCursor scale;
+		};
+
+		// Collects the segment of every binding whose clip has keys on the given track, writing
+		// the keys straight into the component streams. Returns false when there is nothing to blend.
+		template<typename Keys, size_t N>
+		bool gather(Keys Clip::* track, gem::TrackCursor Binding::* cursor, gem::VectorArray<float, N>& from, gem::VectorArray<float, N>& to) {
+			resizeScratch(from, to);
+			auto from_streams = gem::detail::streams(from);
+			auto to_streams = gem::detail::streams(to);
+
+			size_t count = 0;
+			for (auto& binding : bindings_) {
+				const auto& keys = binding.clip->*track;
+				if (keys.empty()) continue;
+
+				gem::TrackSegment<float> segment = keys.locate(binding.time, binding.*cursor);
+				const auto& a = keys.value(segment.from);
+				const auto& b = keys.value(segment.to);
+				for (size_t k = 0; k < N; ++k) {
+					from_streams[k][count] = a[k];
+					to_streams[k][count] = b[k];
+				}
+				t_[count] = segment.t;
+				targets_[count++] = binding.target;
+			}
+
+			return shrinkScratch(from, to, count);
+		}
+
+		template<size_t N>
+		void resizeScratch(gem::VectorArray<float, N>& from, gem::VectorArray<float, N>& to) {
+			from.resize(bindings_.size());
+			to.resize(bindings_.size());
+			t_.resize(bindings_.size());
+			targets_.resize(bindings_.size());
+		}
+
+		template<size_t N>
+		bool shrinkScratch(gem::VectorArray<float, N>& from, gem::VectorArray<float, N>& to, size_t count) {
+			from.resize(count);
+			to.resize(count);
+			t_.resize(count);
+			targets_.resize(count);
+			return count > 0;
+		}
+
+		gem::RotationInterpolation rotation_interpolation_;
+		std::vector<Binding> bindings_;
+
+		// Scratch reused across updates so sampling does not allocate once it reached its size
+		gem::VectorArray<float, 3> from3_, to3_, out3_;
+		gem::VectorArray<float, 4> from4_, to4_, out4_;
+		std::vector<float> t_;
+		std::vector<GameEntity*> targets_;
+	};
+}
\ No newline at end of file
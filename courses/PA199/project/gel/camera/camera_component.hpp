@@ -6,6 +6,8 @@
 
 namespace gel {
 	class CameraComponent : public GameComponent {
+		GEL_COMPONENT(CameraComponent, GameComponent)
+
 	public:
 		CameraComponent(float fov = 60.0f, float aspect_ratio = 16.0f / 9.0f, float near_plane = 0.1f, float far_plane = 1000.0f, bool use_ortho = false)
 			: fov_(fov), aspect_ratio_(aspect_ratio), near_plane_(near_plane), far_plane_(far_plane), use_ortho_(use_ortho) {
@@ -15,14 +17,16 @@ namespace gel {
 		float aspect_ratio() const { return aspect_ratio_; }
 		float near() const { return near_plane_; }
 		float far() const { return far_plane_; }
+		bool isOrthographic() const { return use_ortho_; }
 		void useOrthographic(bool use_ortho) { use_ortho_ = use_ortho; }
 
 		void update(float delta_time) override {
 			if (getEntity() != nullptr) {
+				gem::Basis<float> basis = getEntity()->getBasis();
 				viewMatrix = gem::Matrix4<float>::lookAt(
 					getEntity()->getPosition(), // Eye
-					targetEntity ? targetEntity->getPosition() : getEntity()->getPosition() + getEntity()->getForwardVector(), // Center
-					getEntity()->getUpVector() // Up
+					targetEntity ? targetEntity->getPosition() : getEntity()->getPosition() + basis.forward, // Center
+					basis.up // Up
 				);
 			}
 
@@ -40,6 +44,9 @@ namespace gel {
 			projectionMatrix = gem::Matrix4<float>::perspective(fov_, aspect_ratio_, near_plane_, far_plane_);
 		}
 
+		// Reads the target entity, writes only its own matrices
+		uint8_t getAccess() const override { return ACCESS_OWN_READ | ACCESS_SCENE_READ; }
+
 		void render() override {}
 
 		void setAspectRatio(float aspect_ratio) { aspect_ratio_ = aspect_ratio; }
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+// Declares the type ID and mask of a component class. Place it first in the class body, with
+// the direct base class, which must be GameComponent or itself declared with this macro.
+#define GEL_COMPONENT(TYPE, BASE) \
+	public: \
+		using ComponentSelf = TYPE; \
+		static constexpr ::gel::ComponentType TYPE_ID = ::gel::ComponentType::TYPE; \
+		static constexpr ::gel::ComponentMask TYPE_MASK = ::gel::componentBit(TYPE_ID) | BASE::TYPE_MASK; \
+		::gel::ComponentMask getTypeMask() const override { return TYPE_MASK; } \
+	private:
+
+namespace gel {
+	// Compile-time identity of the engine's component types. Every type owns one bit and its
+	// mask also carries the bits of its base classes, so "is a RendererComponent" is a single
+	// AND instead of a dynamic_cast. Add new component types at the end.
+	enum class ComponentType : uint8_t {
+		CameraComponent,
+		RendererComponent,
+		MeshRendererComponent,
+		SphereRendererComponent,
+		CubeRendererComponent,
+		PlaneRendererComponent,
+		CircleRendererComponent,
+		CylinderRendererComponent,
+		ArcRendererComponent,
+		SplineRendererComponent,
+		LightComponent,
+		DirectionalLightComponent,
+		PointLightComponent,
+		PaddleControllerComponent,
+		BallResetComponent,
+		RigidbodyComponent,
+		AdhocPaddleBroadphaseCollisionComponent,
+		AdhocBrickBroadphaseCollisionComponent,
+		AnimatorComponent,
+		TestComponent,
+		COUNT
+	};
+
+	using ComponentMask = uint64_t;
+
+	static_assert(static_cast<size_t>(ComponentType::COUNT) <= 64, "ComponentMask has one bit per component type.");
+
+	constexpr ComponentMask componentBit(ComponentType type) {
+		return ComponentMask(1) << static_cast<uint8_t>(type);
+	}
+
+	// Position of a type among the set bits of a mask: the index of its slot in a compact array
+	// holding one entry per set bit
+	constexpr size_t componentRank(ComponentMask mask, ComponentType type) {
+		return static_cast<size_t>(std::popcount(mask & (componentBit(type) - 1)));
+	}
+
+	// Declared with GEL_COMPONENT itself, not just derived from a class that was
+	template<typename T>
+	concept TypedComponent = requires {
+		{ T::TYPE_ID } -> std::convertible_to<ComponentType>;
+		requires std::is_same_v<typename T::ComponentSelf, T>;
+	};
+}
\ No newline at end of file
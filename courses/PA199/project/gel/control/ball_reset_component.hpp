@@ -3,6 +3,7 @@
 #include "gem.hpp"
 #include "game_entity.hpp"
 #include "game_component.hpp"
+#include "input/input_system.hpp"
 
 #include <iostream>
 #include "glad/glad.h"
@@ -10,21 +11,25 @@
 
 namespace gel {
 	class BallResetComponent : public GameComponent {
+		GEL_COMPONENT(BallResetComponent, GameComponent)
+
 	public:
 		BallResetComponent(gem::Vector<float, 3> initial_position) : initial_position_(initial_position) {}
 
+		const gem::Vector<float, 3>& initialPosition() const { return initial_position_; }
+
 		void update(float delta_time) override {}
+		uint8_t getAccess() const override { return ACCESS_NONE; }
 		void render() override {}
 
+		void subscribeInput(InputSystem& input) override {
+			input.subscribeAction(input.action("reset_ball"), this);
+		}
+
 		void handleKeyPressed(int key, int scancode, int action, int mods) override {
 			if (action == GLFW_PRESS || action == GLFW_REPEAT) {
-				switch (key) {
-				case GLFW_KEY_R:
-					getEntity()->setPosition(initial_position_);
-					break;
-				default:
-					break;
-				}
+				getEntity()->setPosition(initial_position_);
+				getEntity()->storePreviousTransform();
 			}
 		}
 
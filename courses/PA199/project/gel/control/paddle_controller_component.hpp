@@ -3,6 +3,7 @@
 #include "gem.hpp"
 #include "game_component.hpp"
 #include "game_entity.hpp"
+#include "input/input_system.hpp"
 
 #include <iostream>
 #include "glad/glad.h"
@@ -12,36 +13,38 @@ namespace gel {
 	class GameEntity;
 
 	class PaddleControllerComponent : public GameComponent {
+		GEL_COMPONENT(PaddleControllerComponent, GameComponent)
+
 	public:
-		PaddleControllerComponent(float speed = 0.1f) : speed_(speed) {};
-		void update(float delta_time) override {};
-		void render() override {};
-		void handleKeyPressed(int key, int scancode, int action, int mods) override {
-			bool pressed = false;
-			gem::AxisAngle<float> rotateBy;
-
-			if (action == GLFW_PRESS || action == GLFW_REPEAT) {
-				switch (key) {
-				case GLFW_KEY_A:
-				case GLFW_KEY_LEFT:
-					rotateBy = gem::AxisAngle<float>{ -speed_, 0.0f, 1.0f, 0.0f };
-					pressed = true;
-					break;
-				case GLFW_KEY_D:
-				case GLFW_KEY_RIGHT:
-					rotateBy = gem::AxisAngle<float>{ speed_, 0.0f, 1.0f, 0.0f };
-					pressed = true;
-					break;
-				default:
-					break;
-				}
-
-				if (pressed) {
-					getEntity()->rotate(rotateBy);
-				}
+		// Speed in radians per second
+		PaddleControllerComponent(float speed = 3.0f) : speed_(speed) {};
+		float speed() const { return speed_; }
+
+		// Turns while "paddle_left" or "paddle_right" is held, by the step's share of the speed
+		void update(float delta_time) override {
+			if (!input_) return;
+
+			float direction = 0.0f;
+			if (input_->isActionDown(left_)) direction -= 1.0f;
+			if (input_->isActionDown(right_)) direction += 1.0f;
+
+			if (direction != 0.0f) {
+				getEntity()->rotate(gem::AxisAngle<float>{ direction * speed_ * delta_time * 0.001f, 0.0f, 1.0f, 0.0f });
 			}
 		};
+		uint8_t getAccess() const override { return ACCESS_OWN_READ | ACCESS_OWN_WRITE; }
+		void render() override {};
+
+		void subscribeInput(InputSystem& input) override {
+			input_ = &input;
+			left_ = input.action("paddle_left");
+			right_ = input.action("paddle_right");
+		}
 	private:
 		float speed_;
+
+		InputSystem* input_ = nullptr;
+		InputSystem::ActionId left_ = 0;
+		InputSystem::ActionId right_ = 0;
 	};
 }
\ No newline at end of file
@@ -0,0 +1,24 @@
+#include "command_buffer.hpp"
+
+namespace gel {
+	bool CommandBuffer::empty() const {
+		std::lock_guard<std::mutex> lock(mutex_);
+		return commands_.empty();
+	}
+
+	size_t CommandBuffer::size() const {
+		std::lock_guard<std::mutex> lock(mutex_);
+		return commands_.size();
+	}
+
+	void CommandBuffer::take(std::vector<SceneCommand>& commands) {
+		commands.clear();
+		std::lock_guard<std::mutex> lock(mutex_);
+		commands_.swap(commands);
+	}
+
+	void CommandBuffer::record(const SceneCommand& command) {
+		std::lock_guard<std::mutex> lock(mutex_);
+		commands_.push_back(command);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace gel {
+	class GameComponent;
+	class GameEntity;
+
+	// Apply order of the commands, which GameScene::applyCommands sorts by
+	enum class SceneCommandType : uint8_t {
+		Spawn,
+		Reparent,
+		Enable,
+		AddComponent,
+		RemoveComponent,
+		Destroy
+	};
+
+	struct SceneCommand {
+		SceneCommandType type;
+		bool enabled;
+		GameEntity* entity;
+		GameEntity* parent;         // Spawn and Reparent, null for a root
+		GameComponent* component;   // AddComponent and RemoveComponent
+	};
+
+	// Structural changes to a scene recorded while it updates and applied together by
+	// GameScene::applyCommands once nothing iterates the hierarchy. Recording is thread safe,
+	// so updates running on the job system may record as well. The buffer only keeps
+	// pointers: entities and components to spawn or add are made beforehand with
+	// GameScene::createEntity and createComponent.
+	class CommandBuffer {
+	public:
+		// Adds a new entity under the parent, or as a root when it is null
+		void spawn(GameEntity* entity, GameEntity* parent = nullptr) {
+			record(SceneCommand{ SceneCommandType::Spawn, false, entity, parent, nullptr });
+		}
+
+		// Moves the entity under the parent, or to the roots when it is null. The local
+		// transform is kept.
+		void reparent(GameEntity* entity, GameEntity* parent) {
+			record(SceneCommand{ SceneCommandType::Reparent, false, entity, parent, nullptr });
+		}
+
+		void setEnabled(GameEntity* entity, bool enabled) {
+			record(SceneCommand{ SceneCommandType::Enable, enabled, entity, nullptr, nullptr });
+		}
+
+		void addComponent(GameEntity* entity, GameComponent* comp) {
+			record(SceneCommand{ SceneCommandType::AddComponent, false, entity, nullptr, comp });
+		}
+
+		// Detaches the component, and destroys it when the scene made it
+		void removeComponent(GameEntity* entity, GameComponent* comp) {
+			record(SceneCommand{ SceneCommandType::RemoveComponent, false, entity, nullptr, comp });
+		}
+
+		// Same as GameScene::destroyEntity
+		void destroy(GameEntity* entity) {
+			record(SceneCommand{ SceneCommandType::Destroy, false, entity, nullptr, nullptr });
+		}
+
+		bool empty() const;
+		size_t size() const;
+
+		// Hands the recorded commands over and leaves the buffer empty. The vector passed in
+		// is cleared and its storage reused for the next recording.
+		void take(std::vector<SceneCommand>& commands);
+
+	private:
+		mutable std::mutex mutex_;
+		std::vector<SceneCommand> commands_;
+
+		void record(const SceneCommand& command);
+	};
+}
\ No newline at end of file
@@ -0,0 +1,43 @@
+#include "registry.hpp"
+
+namespace gel {
+	EntityId Registry::create() {
+		uint32_t index;
+		if (!free_.empty()) {
+			index = free_.back();
+			free_.pop_back();
+		} else {
+			// The all-ones index is reserved for NULL_ENTITY
+			if (versions_.size() >= ENTITY_INDEX_MASK) throw std::runtime_error("Registry is out of entity handles.");
+			index = static_cast<uint32_t>(versions_.size());
+			versions_.push_back(0);
+		}
+		return (versions_[index] << ENTITY_INDEX_BITS) | index;
+	}
+
+	size_t Registry::componentCount(EntityId id) const {
+		size_t count = 0;
+		for (const auto& pool : pools_) {
+			if (pool && pool->contains(id)) ++count;
+		}
+		return count;
+	}
+
+	void Registry::destroy(EntityId id) {
+		if (!valid(id)) return;
+
+		for (auto& pool : pools_) {
+			if (pool) pool->remove(id);
+		}
+
+		uint32_t index = entityIndex(id);
+		versions_[index] = (versions_[index] + 1) & (0xffffffffu >> ENTITY_INDEX_BITS);
+		free_.push_back(index);
+	}
+
+	void Registry::update(float delta_time) {
+		for (auto& pool : pools_) {
+			if (pool && pool->size() > 0) pool->update(delta_time);
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,234 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../game_component.hpp"
+
+namespace gel {
+	// Entity handle of a registry: the low bits index the entity slot, the high bits count how
+	// often the slot was reused, so handles of destroyed entities never match a new entity.
+	using EntityId = uint32_t;
+
+	constexpr uint32_t ENTITY_INDEX_BITS = 20;
+	constexpr uint32_t ENTITY_INDEX_MASK = (1u << ENTITY_INDEX_BITS) - 1u;
+	constexpr EntityId NULL_ENTITY = 0xffffffffu;
+
+	constexpr uint32_t entityIndex(EntityId id) { return id & ENTITY_INDEX_MASK; }
+	constexpr uint32_t entityVersion(EntityId id) { return id >> ENTITY_INDEX_BITS; }
+
+	namespace detail {
+		class PoolBase {
+		public:
+			virtual ~PoolBase() = default;
+
+			virtual bool contains(EntityId id) const = 0;
+			virtual void remove(EntityId id) = 0;
+			virtual void update(float delta_time) = 0;
+			virtual size_t size() const = 0;
+		};
+
+		inline size_t nextPoolIndex() {
+			static size_t next = 0;
+			return next++;
+		}
+
+		// Dense, process-wide index of a component type, assigned on first use
+		template<typename T>
+		size_t poolIndex() {
+			static const size_t index = nextPoolIndex();
+			return index;
+		}
+	}
+
+	// Sparse set of one component type. Components are stored densely in fixed-size pages, so
+	// iterating a pool walks contiguous memory and growing it never moves existing components.
+	// Removing a component moves the last one into the hole: pointers stay valid except for
+	// the component that was last, which is why callers should keep entities, not components.
+	template<typename T>
+	class ComponentPool final : public detail::PoolBase {
+	public:
+		static constexpr size_t PAGE_SIZE = 1024;
+
+		ComponentPool() = default;
+		ComponentPool(const ComponentPool&) = delete;
+		ComponentPool& operator=(const ComponentPool&) = delete;
+
+		~ComponentPool() override {
+			for (size_t i = 0; i < dense_.size(); ++i) std::destroy_at(at(i));
+		}
+
+		template<typename... Args>
+		T& emplace(EntityId id, Args&&... args) {
+			if (contains(id)) throw std::runtime_error("Entity already has a component of this type.");
+
+			uint32_t index = entityIndex(id);
+			if (index >= sparse_.size()) sparse_.resize(index + 1, NONE);
+			// The spare page kept by remove may already be there
+			size_t page = dense_.size() / PAGE_SIZE;
+			if (page >= pages_.size()) pages_.push_back(std::make_unique<Page>());
+
+			T* component = std::construct_at(reinterpret_cast<T*>(pages_[page]->bytes) + dense_.size() % PAGE_SIZE, std::forward<Args>(args)...);
+			sparse_[index] = static_cast<uint32_t>(dense_.size());
+			dense_.push_back(id);
+			return *component;
+		}
+
+		bool contains(EntityId id) const override {
+			uint32_t index = entityIndex(id);
+			return index < sparse_.size() && sparse_[index] != NONE && dense_[sparse_[index]] == id;
+		}
+
+		void remove(EntityId id) override {
+			if (!contains(id)) return;
+
+			uint32_t slot = sparse_[entityIndex(id)];
+			uint32_t last = static_cast<uint32_t>(dense_.size() - 1);
+			if (slot != last) {
+				*at(slot) = std::move(*at(last));
+				dense_[slot] = dense_[last];
+				sparse_[entityIndex(dense_[slot])] = slot;
+			}
+			std::destroy_at(at(last));
+			dense_.pop_back();
+			sparse_[entityIndex(id)] = NONE;
+
+			// Keep one spare page so add/remove at a page boundary does not thrash the allocator
+			if (pages_.size() * PAGE_SIZE >= dense_.size() + 2 * PAGE_SIZE) pages_.pop_back();
+		}
+
+		T* tryGet(EntityId id) {
+			return contains(id) ? at(sparse_[entityIndex(id)]) : nullptr;
+		}
+
+		const T* tryGet(EntityId id) const {
+			return contains(id) ? at(sparse_[entityIndex(id)]) : nullptr;
+		}
+
+		size_t size() const override { return dense_.size(); }
+
+		// Entity of each component, in storage order
+		const std::vector<EntityId>& entities() const { return dense_; }
+
+		// Calls fn(T&) or fn(EntityId, T&) for every component in storage order, page by page
+		template<typename F>
+		void each(F&& fn) {
+			for (size_t begin = 0; begin < dense_.size(); begin += PAGE_SIZE) {
+				T* page = at(begin);
+				size_t count = std::min(PAGE_SIZE, dense_.size() - begin);
+				for (size_t i = 0; i < count; ++i) {
+					if constexpr (std::is_invocable_v<F&, EntityId, T&>) fn(dense_[begin + i], page[i]);
+					else fn(page[i]);
+				}
+			}
+		}
+
+		// Game components of enabled entities are updated in storage order
+		void update(float delta_time) override {
+			if constexpr (std::is_base_of_v<GameComponent, T>) {
+				each([delta_time](T& component) {
+					auto* entity = component.getEntity();
+					if (!entity || entity->isActiveInHierarchy()) component.update(delta_time);
+				});
+			}
+		}
+
+	private:
+		static constexpr uint32_t NONE = 0xffffffffu;
+
+		struct Page {
+			alignas(T) std::byte bytes[sizeof(T) * PAGE_SIZE];
+		};
+
+		std::vector<uint32_t> sparse_;
+		std::vector<EntityId> dense_;
+		std::vector<std::unique_ptr<Page>> pages_;
+
+		T* at(size_t slot) const {
+			return std::launder(reinterpret_cast<T*>(pages_[slot / PAGE_SIZE]->bytes) + slot % PAGE_SIZE);
+		}
+	};
+
+	// Owns the entity handles and one component pool per type. Per-type work is a loop over a
+	// dense pool instead of a walk over every entity and its list of components.
+	class Registry {
+	public:
+		Registry() = default;
+		Registry(const Registry&) = delete;
+		Registry& operator=(const Registry&) = delete;
+
+		EntityId create();
+
+		// Removes every component of the entity; destroying a stale handle does nothing
+		void destroy(EntityId id);
+
+		bool valid(EntityId id) const {
+			uint32_t index = entityIndex(id);
+			return id != NULL_ENTITY && index < versions_.size() && versions_[index] == entityVersion(id);
+		}
+
+		// Number of live entities
+		size_t size() const { return versions_.size() - free_.size(); }
+
+		// Number of pools holding a component of the entity
+		size_t componentCount(EntityId id) const;
+
+		template<typename T, typename... Args>
+		T& emplace(EntityId id, Args&&... args) {
+			if (!valid(id)) throw std::runtime_error("Cannot add a component to an invalid entity.");
+			return pool<T>().emplace(id, std::forward<Args>(args)...);
+		}
+
+		template<typename T>
+		void remove(EntityId id) {
+			if (auto* p = findPool<T>()) p->remove(id);
+		}
+
+		template<typename T>
+		bool has(EntityId id) const {
+			auto* p = findPool<T>();
+			return p && p->contains(id);
+		}
+
+		// Exact type only, never creates a pool
+		template<typename T>
+		T* tryGet(EntityId id) const {
+			auto* p = findPool<T>();
+			return p ? p->tryGet(id) : nullptr;
+		}
+
+		template<typename T>
+		ComponentPool<T>& pool() {
+			size_t index = detail::poolIndex<T>();
+			if (index >= pools_.size()) pools_.resize(index + 1);
+			if (!pools_[index]) pools_[index] = std::make_unique<ComponentPool<T>>();
+			return static_cast<ComponentPool<T>&>(*pools_[index]);
+		}
+
+		template<typename T, typename F>
+		void each(F&& fn) {
+			if (auto* p = findPool<T>()) p->each(std::forward<F>(fn));
+		}
+
+		// Updates the game components of every pool
+		void update(float delta_time);
+
+	private:
+		std::vector<uint32_t> versions_;
+		std::vector<uint32_t> free_;
+		std::vector<std::unique_ptr<detail::PoolBase>> pools_;
+
+		template<typename T>
+		ComponentPool<T>* findPool() const {
+			size_t index = detail::poolIndex<T>();
+			return index < pools_.size() ? static_cast<ComponentPool<T>*>(pools_[index].get()) : nullptr;
+		}
+	};
+}
\ No newline at end of file
@@ -2,18 +2,49 @@
 
 #include <vector>
 #include "gem.hpp"
+#include "component_type.hpp"
 
 namespace gel {
 	class GameEntity;
+	class GameScene;
+	class InputSystem;
+
+	namespace detail {
+		class ObjectPoolBase;
+	}
+
+	// What update() may touch, declared per component type so GameScene can run updates
+	// that cannot conflict on several threads. "Own" is the component's entity: reading also
+	// covers the entity's ancestors, writing also its descendants.
+	enum ComponentAccess : uint8_t {
+		ACCESS_NONE = 0,
+		ACCESS_OWN_READ = 1 << 0,
+		ACCESS_OWN_WRITE = 1 << 1,
+		ACCESS_SCENE_READ = 1 << 2,
+		ACCESS_SCENE_WRITE = 1 << 3,
+		ACCESS_ALL = ACCESS_OWN_READ | ACCESS_OWN_WRITE | ACCESS_SCENE_READ | ACCESS_SCENE_WRITE
+	};
 
 	class GameComponent {
 	public:
+		static constexpr ComponentMask TYPE_MASK = 0;
+
 		GameComponent() = default;
 
 		virtual ~GameComponent() = default;
 		virtual void update(float delta_time) = 0;
 		virtual void render() = 0;
+		// Called by the scene's InputSystem for the keys and actions the component subscribed to
 		virtual void handleKeyPressed(int key, int scancode, int action, int mods) {}
+		// Subscribes to keys or actions, or keeps the system to poll. Called by
+		// GameScene::bindInput; components that never read input leave it empty.
+		virtual void subscribeInput(InputSystem& input) {}
+
+		// Bits of the component's type and all its bases, see GEL_COMPONENT
+		virtual ComponentMask getTypeMask() const { return TYPE_MASK; }
+
+		// Components that do not say otherwise may touch anything and update alone
+		virtual uint8_t getAccess() const { return ACCESS_ALL; }
 
 		void linkEntity(GameEntity* entity) {
 			this->entity = entity;
@@ -28,5 +59,19 @@ namespace gel {
 		}
 	private:
 		GameEntity* entity = nullptr;
+
+		// Set when the component was made by GameScene::createComponent
+		friend class GameScene;
+		detail::ObjectPoolBase* pool_ = nullptr;
 	};
+
+	// A mask test for component types declared with GEL_COMPONENT, dynamic_cast otherwise
+	template<typename T>
+	T* componentCast(GameComponent* comp) {
+		if constexpr (TypedComponent<T>) {
+			return comp && (comp->getTypeMask() & componentBit(T::TYPE_ID)) ? static_cast<T*>(comp) : nullptr;
+		} else {
+			return dynamic_cast<T*>(comp);
+		}
+	}
 }
\ No newline at end of file
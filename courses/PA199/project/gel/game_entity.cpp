@@ -1,77 +1,186 @@
 #include "game_entity.hpp"
 #include "game_component.hpp"
+#include <algorithm>
+#include <bit>
 #include <vector>
 
 namespace gel {
+	GameEntity::~GameEntity() {
+		if (registry_) registry_->destroy(id_);
+	}
+
+	void GameEntity::bindRegistry(Registry& registry) {
+		if (registry_) throw std::runtime_error("Entity is already bound to a registry.");
+		registry_ = &registry;
+		id_ = registry.create();
+	}
+
 	void GameEntity::addChild(GameEntity* child) {
 		children_.push_back(child);
 		child->parent_ = this;
+		child->markWorldDirty();
 	}
 
 	void GameEntity::removeChild(GameEntity* child) {
 		children_.erase(std::remove(children_.begin(), children_.end(), child), children_.end());
 		child->parent_ = nullptr;
+		child->markWorldDirty();
 	}
 
 	void GameEntity::addComponent(GameComponent* comp) {
 		component_.push_back(comp);
 		comp->linkEntity(this);
+		indexComponent(comp);
 	}
 
 	void GameEntity::removeComponent(GameComponent* comp) {
 		component_.erase(std::remove(component_.begin(), component_.end(), comp), component_.end());
 		comp->unlinkEntity();
+
+		component_mask_ = 0;
+		typed_.clear();
+		for (auto* listed : component_) {
+			indexComponent(listed);
+		}
 	}
 
-	gem::Matrix4<float> GameEntity::getLocalTransform() const {
-		gem::Matrix4<float> t = gem::Matrix4<float>::translation(position_);
-		/*gem::Matrix4<float> r = \
-			gem::Matrix4<float>::rotationZ(orientation_[2]) *
-			gem::Matrix4<float>::rotationY(orientation_[1]) *
-			gem::Matrix4<float>::rotationX(orientation_[0]);*/
-		gem::Matrix4<float> r = gem::Matrix4<float>::rotation(orientation_);
-		gem::Matrix4<float> s = gem::Matrix4<float>::scale(scale_);
+	void GameEntity::removeChildren(std::span<GameEntity* const> children) {
+		std::erase_if(children_, [&](GameEntity* child) {
+			if (!std::binary_search(children.begin(), children.end(), child)) return false;
+			child->parent_ = nullptr;
+			child->markWorldDirty();
+			return true;
+		});
+	}
+
+	void GameEntity::removeComponents(std::span<GameComponent* const> comps) {
+		size_t removed = std::erase_if(component_, [&](GameComponent* comp) {
+			if (!std::binary_search(comps.begin(), comps.end(), comp)) return false;
+			comp->unlinkEntity();
+			return true;
+		});
+		if (removed == 0) return;
 
-		return t * r * s;
+		component_mask_ = 0;
+		typed_.clear();
+		for (auto* listed : component_) {
+			indexComponent(listed);
+		}
 	}
 
-	gem::Matrix4<float> GameEntity::getInverseLocalTransform() const {
-		return getLocalTransform().inverse();
+	std::vector<GameEntity*> GameEntity::releaseChildren() {
+		std::vector<GameEntity*> children;
+		children.swap(children_);
+		for (auto* child : children) {
+			child->parent_ = nullptr;
+			child->markWorldDirty();
+		}
+		return children;
 	}
 
-	gem::Matrix4<float> GameEntity::getWorldTransform() const {
+	std::vector<GameComponent*> GameEntity::releaseComponents() {
+		std::vector<GameComponent*> comps;
+		comps.swap(component_);
+		for (auto* comp : comps) {
+			comp->unlinkEntity();
+		}
+		component_mask_ = 0;
+		typed_.clear();
+		return comps;
+	}
+
+	void GameEntity::indexComponent(GameComponent* comp) {
+		// Types already present keep their earlier component
+		ComponentMask added = comp->getTypeMask() & ~component_mask_;
+		while (added) {
+			ComponentType type = static_cast<ComponentType>(std::countr_zero(added));
+			component_mask_ |= componentBit(type);
+			typed_.insert(typed_.begin() + componentRank(component_mask_, type), comp);
+			added &= added - 1;
+		}
+	}
+
+	bool GameEntity::isActiveInHierarchy() const {
+		for (const GameEntity* entity = this; entity; entity = entity->parent_) {
+			if (!entity->enabled_) return false;
+		}
+		return true;
+	}
+
+	gem::Transform<float> GameEntity::getWorldTRS() const {
 		if (parent_) {
-			return parent_->getWorldTransform() * getLocalTransform();
+			return parent_->getWorldTRS() * getLocalTRS();
 		} else {
-			return getLocalTransform();
+			return getLocalTRS();
 		}
 	}
 
-	gem::Matrix4<float> GameEntity::getInverseWorldTransform() const {
-		return getWorldTransform().inverse();
+	const gem::Matrix4<float>& GameEntity::getLocalTransform() const {
+		if (dirty_ & LOCAL_DIRTY) {
+			local_ = getLocalTRS().toMatrix();
+			dirty_ &= ~LOCAL_DIRTY;
+		}
+		return local_;
 	}
 
-	gem::Vector<float, 3> GameEntity::getRightVector() const {
-		/*gem::Matrix4<float> worldTransform = getWorldTransform();
-		return gem::Vector<float, 3>{ worldTransform[0][0], worldTransform[1][0], worldTransform[2][0] }.normalize();*/
+	const gem::Matrix4<float>& GameEntity::getInverseLocalTransform() const {
+		if (dirty_ & INVERSE_LOCAL_DIRTY) {
+			inverse_local_ = gem::Matrix4<float>::inverseTRS(position_, orientation_, scale_);
+			dirty_ &= ~INVERSE_LOCAL_DIRTY;
+		}
+		return inverse_local_;
+	}
 
-		gem::Vector<float, 3> right = orientation_.rotate({ 1.0f, 0.0f, 0.0f });
-		return right.normalize();
+	const gem::Matrix4<float>& GameEntity::getWorldTransform() const {
+		if (dirty_ & WORLD_DIRTY) {
+			world_ = parent_ ? parent_->getWorldTransform() * getLocalTransform() : getLocalTransform();
+			dirty_ &= ~WORLD_DIRTY;
+		}
+		return world_;
 	}
 
-	gem::Vector<float, 3> GameEntity::getUpVector() const {
-		/*gem::Matrix4<float> worldTransform = getWorldTransform();
-		return gem::Vector<float, 3>{ worldTransform[0][1], worldTransform[1][1], worldTransform[2][1] }.normalize(); */
+	const gem::Matrix4<float>& GameEntity::getInverseWorldTransform() const {
+		if (dirty_ & INVERSE_WORLD_DIRTY) {
+			inverse_world_ = parent_ ? getInverseLocalTransform() * parent_->getInverseWorldTransform() : getInverseLocalTransform();
+			dirty_ &= ~INVERSE_WORLD_DIRTY;
+		}
+		return inverse_world_;
+	}
+
+	gem::Matrix4<float> GameEntity::getInterpolatedLocalTransform(float alpha) const {
+		if (!moved_ || alpha >= 1.0f) return getLocalTransform();
+		return gem::interpolate(previous_, getLocalTRS(), alpha).toMatrix();
+	}
+
+	gem::Vector<float, 3> GameEntity::getWorldPosition() const {
+		const gem::Matrix4<float>& world = getWorldTransform();
+		return gem::Vector<float, 3>{ world(0, 3), world(1, 3), world(2, 3) };
+	}
 
-		gem::Vector<float, 3> up = orientation_.rotate({ 0.0f, 1.0f, 0.0f });
-		return up.normalize();
+	void GameEntity::markLocalDirty() {
+		dirty_ |= LOCAL_DIRTY | INVERSE_LOCAL_DIRTY;
+		moved_ = true;
+		markWorldDirty();
+	}
+
+	void GameEntity::markWorldDirty() {
+		if ((dirty_ & (WORLD_DIRTY | INVERSE_WORLD_DIRTY)) == (WORLD_DIRTY | INVERSE_WORLD_DIRTY)) return;
+
+		dirty_ |= WORLD_DIRTY | INVERSE_WORLD_DIRTY;
+		for (auto* child : children_) {
+			child->markWorldDirty();
+		}
+	}
+
+	gem::Vector<float, 3> GameEntity::getRightVector() const {
+		return orientation_.basis().right;
+	}
+
+	gem::Vector<float, 3> GameEntity::getUpVector() const {
+		return orientation_.basis().up;
 	}
 
 	gem::Vector<float, 3> GameEntity::getForwardVector() const {
-		/*gem::Matrix4<float> worldTransform = getWorldTransform();
-		return gem::Vector<float, 3>{ worldTransform[0][2], worldTransform[1][2], worldTransform[2][2] }.normalize(); */
-		
-		gem::Vector<float, 3> forward = orientation_.rotate({ 0.0f, 0.0f, 1.0f });
-		return forward.normalize();
+		return orientation_.basis().forward;
 	}
 }
\ No newline at end of file
@@ -1,12 +1,19 @@
 #pragma once
 
+#include <cstdint>
+#include <span>
 #include <vector>
 
 #include "gem.hpp"
-
+#include "ecs/registry.hpp"
 
 namespace gel {
 	class GameComponent;
+	class GameScene;
+
+	namespace detail {
+		class ObjectPoolBase;
+	}
 
 	class GameEntity {
 	public:
@@ -16,10 +23,10 @@ namespace gel {
 			const gem::Quaternion<float>& orientation,
 			const gem::Vector<float, 3>& scale,
 			bool enabled = true)
-			: position_(position), orientation_(orientation), scale_(scale), enabled_(enabled) {
+			: position_(position), orientation_(orientation), scale_(scale), previous_(position, orientation, scale), enabled_(enabled) {
 		}
 
-		virtual ~GameEntity() = default;
+		virtual ~GameEntity();
 
 		void addChild(GameEntity* child);
 		void removeChild(GameEntity* child);
@@ -27,59 +34,179 @@ namespace gel {
 		void addComponent(GameComponent* comp);
 		void removeComponent(GameComponent* comp);
 
+		// Batched removal: the lists are compacted once and the type slots rebuilt once.
+		// The arguments have to be sorted by address; entries not listed are ignored.
+		void removeChildren(std::span<GameEntity* const> children);
+		void removeComponents(std::span<GameComponent* const> comps);
+
+		// Detach every child or component and return them in list order
+		std::vector<GameEntity*> releaseChildren();
+		std::vector<GameComponent*> releaseComponents();
+
+		// First component that is a T, base classes included. Types declared with GEL_COMPONENT
+		// are a mask test and an index into the typed slots, others are searched with
+		// dynamic_cast. Components pooled in the registry are found by their exact type.
 		template<typename T>
 		T* getComponent() const {
-			for (auto* comp : component_) {
-				if (auto* casted = dynamic_cast<T*>(comp)) {
-					return casted;
+			if constexpr (TypedComponent<T>) {
+				if (component_mask_ & componentBit(T::TYPE_ID)) {
+					return static_cast<T*>(typed_[componentRank(component_mask_, T::TYPE_ID)]);
 				}
+			} else {
+				for (auto* comp : component_) {
+					if (auto* casted = dynamic_cast<T*>(comp)) {
+						return casted;
+					}
+				}
+			}
+			if constexpr (!std::is_abstract_v<T>) {
+				if (registry_) return registry_->tryGet<T>(id_);
 			}
 			return nullptr;
 		}
 
+		// Union of the type masks of the listed components
+		ComponentMask getComponentMask() const { return component_mask_; }
+
+		// REGISTRY FUNCTIONS
+		// -------------------------------
+		// An entity bound to a registry can keep components in the registry's dense pools
+		// instead of its own list. The registry has to outlive the entity.
+
+		void bindRegistry(Registry& registry);
+		Registry* getRegistry() const { return registry_; }
+		EntityId getId() const { return id_; }
+
+		template<typename T, typename... Args>
+		T& emplaceComponent(Args&&... args) {
+			if (!registry_) throw std::runtime_error("Entity is not bound to a registry.");
+			T& comp = registry_->emplace<T>(id_, std::forward<Args>(args)...);
+			if constexpr (std::is_base_of_v<GameComponent, T>) comp.linkEntity(this);
+			return comp;
+		}
+
+		template<typename T>
+		void eraseComponent() {
+			if (registry_) registry_->remove<T>(id_);
+		}
+
 		const gem::Vector<float, 3>& getPosition() const { return position_; }
-		void setPosition(const gem::Vector<float, 3>& position) { position_ = position; }
+		void setPosition(const gem::Vector<float, 3>& position) { position_ = position; markLocalDirty(); }
 
 		const gem::Quaternion<float>& getOrientation() const { return orientation_; }
-		void setOrientation(const gem::Quaternion<float>& orientation) { orientation_ = orientation; }
+		void setOrientation(const gem::Quaternion<float>& orientation) { orientation_ = orientation; markLocalDirty(); }
 
 		const gem::Vector<float, 3>& getScale() const { return scale_; }
-		void setScale(const gem::Vector<float, 3>& scale) { scale_ = scale; }
+		void setScale(const gem::Vector<float, 3>& scale) { scale_ = scale; markLocalDirty(); }
 
 		GameEntity* getParent() const { return parent_; }
 		const std::vector<GameEntity*>& getChildren() const { return children_; }
 		const std::vector<GameComponent*>& getComponents() const { return component_; }
 
-		gem::Matrix4<float> getLocalTransform() const;
-		gem::Matrix4<float> getInverseLocalTransform() const;
-		gem::Matrix4<float> getWorldTransform() const;
-		gem::Matrix4<float> getInverseWorldTransform() const;
+		gem::Transform<float> getLocalTRS() const { return gem::Transform<float>(position_, orientation_, scale_); }
+		gem::Transform<float> getWorldTRS() const;
+
+		// The matrices are cached and only rebuilt after the entity or one of its ancestors
+		// moved, world = parent world * local. The references stay valid until the next change.
+		const gem::Matrix4<float>& getLocalTransform() const;
+		const gem::Matrix4<float>& getInverseLocalTransform() const;
+		const gem::Matrix4<float>& getWorldTransform() const;
+		const gem::Matrix4<float>& getInverseWorldTransform() const;
+
+		// Translation of the cached world matrix
+		gem::Vector<float, 3> getWorldPosition() const;
 
 		gem::Vector<float, 3> getUpVector() const;
 		gem::Vector<float, 3> getRightVector() const;
 		gem::Vector<float, 3> getForwardVector() const;
 
+		// Right, up and forward vectors from a single quaternion-to-basis conversion
+		gem::Basis<float> getBasis() const { return orientation_.basis(); }
+
 		void rotate(const gem::AxisAngle<float> rotateBy) {
 			gem::AxisAngle<float> aa(rotateBy.angle(), rotateBy.axis()[0], rotateBy.axis()[1], rotateBy.axis()[2]);
 			gem::Quaternion<float> q = aa.toQuaternion();
 
 			orientation_ = orientation_ * q;
 			orientation_ = orientation_.normalize();
+			markLocalDirty();
 		}
 
+		// INTERPOLATION FUNCTIONS
+		// -------------------------------
+		// GameScene::update stores every local transform before it steps the simulation, so a
+		// frame rendered between two steps can blend the stored state toward the current one.
+
+		// Also call it after a teleport, which should not be blended across
+		void storePreviousTransform() {
+			previous_ = getLocalTRS();
+			moved_ = false;
+		}
+
+		const gem::Transform<float>& getPreviousTRS() const { return previous_; }
+
+		// Whether the local transform changed since it was last stored
+		bool hasMoved() const { return moved_; }
+
+		// Local matrix alpha of the way from the stored transform to the current one, the
+		// cached local matrix when the entity did not move
+		gem::Matrix4<float> getInterpolatedLocalTransform(float alpha) const;
+
 		bool isEnabled() const { return enabled_; }
 		void setEnabled(bool enabled) { enabled_ = enabled; }
 
+		// Enabled together with every ancestor
+		bool isActiveInHierarchy() const;
+
 	private:
 		gem::Vector<float, 3> position_{ 0.0f, 0.0f, 0.0f };
 		gem::Quaternion<float> orientation_{ 1.0f, 0.0f, 0.0f, 0.0f };
 		gem::Vector<float, 3> scale_{ 1.0f, 1.0f, 1.0f };
 
+		gem::Transform<float> previous_;
+		bool moved_ = false;
+
 		GameEntity* parent_ = nullptr;
 		std::vector<GameEntity*> children_;
 
 		std::vector<GameComponent*> component_;
 
+		// One slot per bit of the mask, in bit order, holding the first listed component of
+		// that type. Rebuilt from the list when a component is removed.
+		ComponentMask component_mask_ = 0;
+		std::vector<GameComponent*> typed_;
+
+		void indexComponent(GameComponent* comp);
+
 		bool enabled_ = true;
+
+		Registry* registry_ = nullptr;
+		EntityId id_ = NULL_ENTITY;
+
+		// Set when the entity was made by GameScene::createEntity
+		friend class GameScene;
+		detail::ObjectPoolBase* pool_ = nullptr;
+
+		// TRANSFORM CACHE
+		// -------------------------------
+		// A dirty world flag implies dirty world flags on every descendant, so marking can stop
+		// at the first entity that is already dirty and each matrix is rebuilt at most once.
+
+		enum DirtyFlags : uint8_t {
+			LOCAL_DIRTY = 1 << 0,
+			INVERSE_LOCAL_DIRTY = 1 << 1,
+			WORLD_DIRTY = 1 << 2,
+			INVERSE_WORLD_DIRTY = 1 << 3,
+			ALL_DIRTY = LOCAL_DIRTY | INVERSE_LOCAL_DIRTY | WORLD_DIRTY | INVERSE_WORLD_DIRTY
+		};
+
+		mutable uint8_t dirty_ = ALL_DIRTY;
+		mutable gem::Matrix4<float> local_;
+		mutable gem::Matrix4<float> inverse_local_;
+		mutable gem::Matrix4<float> world_;
+		mutable gem::Matrix4<float> inverse_world_;
+
+		void markLocalDirty();
+		void markWorldDirty();
 	};
 }
\ No newline at end of file
@@ -3,10 +3,29 @@
 #include "light/point_light_component.hpp"
 #include "renderer/renderer_component.hpp"
 #include "renderer/mesh_renderer_component.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <iostream>
 #include <string>
+#include <unordered_map>
 
 namespace gel {
+	namespace {
+		enum class UpdatePhase { Local, Exclusive, Query };
+
+		// Updates confined to their own subtree run beside other subtrees, read-only scene
+		// queries beside each other once nothing writes, everything else alone
+		UpdatePhase updatePhase(uint8_t access) {
+			if (access & ACCESS_SCENE_WRITE) return UpdatePhase::Exclusive;
+			if (access & ACCESS_SCENE_READ) return (access & ACCESS_OWN_WRITE) ? UpdatePhase::Exclusive : UpdatePhase::Query;
+			return UpdatePhase::Local;
+		}
+
+		double millisecondsSince(std::chrono::steady_clock::time_point start) {
+			return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		}
+	}
 
 	void GameScene::setupLights() {
 		// Setup Main Light
@@ -22,12 +41,12 @@ namespace gel {
 
 		int num_point_light = 0;
 		for (auto* el : extraLights_) {
-			PointLightComponent* plc = dynamic_cast<PointLightComponent*>(el);
+			PointLightComponent* plc = componentCast<PointLightComponent>(el);
 			if (plc && num_point_light < MAX_POINT_LIGHTS) {
 				std::string indexStr = std::to_string(num_point_light);
-				gem::Matrix4<float> lightPos = plc->getEntity()->getWorldTransform();
+				gem::Vector<float, 3> lightPos = plc->getEntity()->getWorldPosition();
 				float safeRange = std::max(plc->getRange(), 0.001f);
-				glUniform3f(glGetUniformLocation(shader_program_, ("pointLights[" + indexStr + "].position").c_str()), lightPos[0][3], lightPos[1][3], lightPos[2][3]);
+				glUniform3f(glGetUniformLocation(shader_program_, ("pointLights[" + indexStr + "].position").c_str()), lightPos[0], lightPos[1], lightPos[2]);
 				glUniform3f(glGetUniformLocation(shader_program_, ("pointLights[" + indexStr + "].ambient").c_str()), plc->getAmbient()[0], plc->getAmbient()[1], plc->getAmbient()[2]);
 				glUniform3f(glGetUniformLocation(shader_program_, ("pointLights[" + indexStr + "].diffuse").c_str()), plc->getDiffuse()[0], plc->getDiffuse()[1], plc->getDiffuse()[2]);
 				glUniform3f(glGetUniformLocation(shader_program_, ("pointLights[" + indexStr + "].specular").c_str()), plc->getSpecular()[0], plc->getSpecular()[1], plc->getSpecular()[2]);
@@ -40,8 +59,8 @@ namespace gel {
 		}
 
 		if (isUsingLight || num_point_light > 0) {
-			gem::Matrix4<float> viewPos = mainCamera_->getEntity()->getWorldTransform();
-			glUniform3f(glGetUniformLocation(shader_program_, "view_pos"), viewPos[0][3], viewPos[1][3], viewPos[2][3]);
+			gem::Vector<float, 3> viewPos = mainCamera_->getEntity()->getWorldPosition();
+			glUniform3f(glGetUniformLocation(shader_program_, "view_pos"), viewPos[0], viewPos[1], viewPos[2]);
 			glUniform1i(glGetUniformLocation(shader_program_, "num_point_lights"), num_point_light);
 		}
 	}
@@ -56,21 +75,35 @@ namespace gel {
 		}
 	}
 
-	void GameScene::recursiveRender(GameEntity* entity) {
+	void GameScene::recursiveRender(GameEntity* entity, float alpha, const gem::Matrix4<float>* parent_model) {
 		glUseProgram(shader_program_);
 
+		gem::Matrix4<float> blended;
+		const gem::Matrix4<float>* model = nullptr;
+		if (alpha < 1.0f && (parent_model || entity->hasMoved())) {
+			blended = entity->getInterpolatedLocalTransform(alpha);
+			if (parent_model) blended = *parent_model * blended;
+			else if (entity->getParent()) blended = entity->getParent()->getWorldTransform() * blended;
+			model = &blended;
+		}
+
 		RendererComponent* rc = entity->getComponent<RendererComponent>();
 		if (rc) {
-			gem::Matrix4<float> m = entity->getWorldTransform();
+			const gem::Matrix4<float>& m = model ? *model : entity->getWorldTransform();
+			gem::Matrix3<float> n = m.normalMatrix();
 			gem::Matrix4<float> v = mainCamera_->getViewMatrix();
 			gem::Matrix4<float> p = mainCamera_->getProjectionMatrix();
 
-			glUniformMatrix4fv(glGetUniformLocation(shader_program_, "model"), 1, GL_TRUE, &m[0][0]);
-			glUniformMatrix4fv(glGetUniformLocation(shader_program_, "view"), 1, GL_TRUE, &v[0][0]);
-			glUniformMatrix4fv(glGetUniformLocation(shader_program_, "proj"), 1, GL_TRUE, &p[0][0]);
+			// Column-major matrices already match GLSL and are uploaded as they are
+			const GLboolean transpose = gem::Matrix4<float>::COLUMN_MAJOR ? GL_FALSE : GL_TRUE;
+
+			glUniformMatrix4fv(glGetUniformLocation(shader_program_, "model"), 1, transpose, m.values());
+			glUniformMatrix3fv(glGetUniformLocation(shader_program_, "normal_matrix"), 1, GL_TRUE, &n[0][0]);
+			glUniformMatrix4fv(glGetUniformLocation(shader_program_, "view"), 1, transpose, v.values());
+			glUniformMatrix4fv(glGetUniformLocation(shader_program_, "proj"), 1, transpose, p.values());
 
 			// Render Meshes
-			MeshRendererComponent* mrc = dynamic_cast<MeshRendererComponent*>(rc);
+			MeshRendererComponent* mrc = componentCast<MeshRendererComponent>(rc);
 			if (mrc) {
 				GLuint texture = mrc->getTexture();
 				if (texture) {
@@ -86,6 +119,7 @@ namespace gel {
 				}
 
 				glUniform1f(glGetUniformLocation(shader_program_, "breakpoint"), mrc->mesh_current_strength_ / mrc->mesh_initial_strength_);
+				glUniform1i(glGetUniformLocation(shader_program_, "packed_normals"), mrc->getVertexLayout() == VertexLayout::Packed ? 1 : 0);
 			}
 			
 			setupLights();
@@ -93,27 +127,125 @@ namespace gel {
 		}
 
 		for (auto* child : entity->getChildren()) {
-			if (child->isEnabled()) recursiveRender(child);
+			if (child->isEnabled()) recursiveRender(child, alpha, model);
 		}
 	}
 
-	void GameScene::recursiveHandleKeyPressed(GameEntity* entity, int key, int scancode, int action, int mods) {
+	void GameScene::recursiveBindInput(GameEntity* entity) {
 		for (auto* comp : entity->getComponents()) {
-			comp->handleKeyPressed(key, scancode, action, mods);
+			input_.unsubscribe(comp);
+			comp->subscribeInput(input_);
 		}
 
 		for (auto* child : entity->getChildren()) {
-			if (child->isEnabled()) recursiveHandleKeyPressed(child, key, scancode, action, mods);
+			recursiveBindInput(child);
 		}
 	}
 
 	void GameScene::update(float delta_time) {
+		auto start = std::chrono::steady_clock::now();
+		input_.dispatch();
+		for (auto* entity : entities_) {
+			recursiveStorePreviousTransforms(entity);
+		}
+		registry_.update(delta_time);
+
+		if (jobs_) {
+			updateParallel(delta_time);
+		} else {
+			for (auto* entity : entities_) {
+				if (entity->isEnabled()) recursiveUpdate(entity, delta_time);
+			}
+		}
+		applyCommands();
+		update_stats_.update_ms = millisecondsSince(start);
+	}
+
+	void GameScene::updateParallel(float delta_time) {
+		update_roots_.clear();
 		for (auto* entity : entities_) {
-			if (entity->isEnabled()) recursiveUpdate(entity, delta_time);
+			if (entity->isEnabled()) update_roots_.push_back(entity);
+		}
+
+		JobStats before = jobs_->stats();
+		std::atomic<uint64_t> busy_ns{ 0 };
+		double parallel_ms = 0.0;
+
+		// Runs fn over [0, count) on all threads, timing the work itself apart from the wall time
+		auto parallelFor = [&](size_t count, size_t grain, auto&& fn) {
+			auto start = std::chrono::steady_clock::now();
+			jobs_->parallelFor(count, grain, [&](size_t begin, size_t end) {
+				auto work_start = std::chrono::steady_clock::now();
+				for (size_t i = begin; i < end; ++i) fn(i);
+				busy_ns += static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - work_start).count());
+			});
+			parallel_ms += millisecondsSince(start);
+		};
+
+		// The local pass notes which subtrees hold anything else, the others are not walked again
+		update_shared_.assign(update_roots_.size(), 0);
+		parallelFor(update_roots_.size(), 0, [&](size_t i) {
+			update_shared_[i] = recursiveUpdateAccess(update_roots_[i], delta_time, false);
+		});
+
+		update_queries_.clear();
+		for (size_t i = 0; i < update_roots_.size(); ++i) {
+			if (update_shared_[i]) recursiveUpdateAccess(update_roots_[i], delta_time, true);
+		}
+
+		if (!update_queries_.empty()) {
+			// Queries may read any world transform or its inverse, also of disabled subtrees, so
+			// no cache is left to fill lazily
+			parallelFor(entities_.size(), 0, [&](size_t i) {
+				recursiveRefreshTransforms(entities_[i]);
+			});
+			parallelFor(update_queries_.size(), 0, [&](size_t i) {
+				update_queries_[i]->update(delta_time);
+			});
+		}
+
+		JobStats after = jobs_->stats();
+		double busy_ms = static_cast<double>(busy_ns.load()) * 1e-6;
+		update_stats_.parallel_ms = parallel_ms;
+		update_stats_.scheduling_ms = std::max(0.0, parallel_ms - busy_ms / static_cast<double>(jobs_->threadCount()));
+		update_stats_.jobs = after.jobs - before.jobs;
+		update_stats_.steals = after.steals - before.steals;
+	}
+
+	bool GameScene::recursiveUpdateAccess(GameEntity* entity, float delta_time, bool exclusive) {
+		bool shared = false;
+		for (auto* comp : entity->getComponents()) {
+			UpdatePhase phase = updatePhase(comp->getAccess());
+			shared |= phase != UpdatePhase::Local;
+			if (!exclusive && phase == UpdatePhase::Local) comp->update(delta_time);
+			if (exclusive && phase == UpdatePhase::Exclusive) comp->update(delta_time);
+			if (exclusive && phase == UpdatePhase::Query) update_queries_.push_back(comp);
+		}
+
+		for (auto* child : entity->getChildren()) {
+			if (child->isEnabled()) shared |= recursiveUpdateAccess(child, delta_time, exclusive);
+		}
+		return shared;
+	}
+
+	void GameScene::recursiveRefreshTransforms(GameEntity* entity) {
+		// Parents come first, so each entity only fills its own caches
+		entity->getWorldTransform();
+		entity->getInverseWorldTransform();
+		for (auto* child : entity->getChildren()) {
+			recursiveRefreshTransforms(child);
+		}
+	}
+
+	void GameScene::recursiveStorePreviousTransforms(GameEntity* entity) {
+		// Disabled entities are stored too, they can still be moved from outside
+		entity->storePreviousTransform();
+		for (auto* child : entity->getChildren()) {
+			recursiveStorePreviousTransforms(child);
 		}
 	}
 
-	void GameScene::render() {
+	void GameScene::render(float alpha) {
 		if (!mainCamera_) {
 			std::cerr << "Error: No main camera set for the scene." << std::endl;
 			return;
@@ -125,13 +257,208 @@ namespace gel {
 		}
 
 		for (auto* entity : entities_) {
-			if (entity->isEnabled()) recursiveRender(entity);
+			if (entity->isEnabled()) recursiveRender(entity, alpha, nullptr);
 		}
 	}
 
-	void GameScene::handleKeyPressed(int key, int scancode, int action, int mods) {
-		for (auto* entity : entities_) {
-			if (entity->isEnabled()) recursiveHandleKeyPressed(entity, key, scancode, action, mods);
+	void GameScene::bindInput(GameEntity* entity) {
+		if (entity) {
+			recursiveBindInput(entity);
+			return;
+		}
+
+		for (auto* root : entities_) {
+			recursiveBindInput(root);
+		}
+	}
+
+	void GameScene::destroyEntity(GameEntity* entity) {
+		if (entity->getParent()) entity->getParent()->removeChild(entity);
+		else removeEntity(entity);
+
+		destroyDetached(entity);
+	}
+
+	void GameScene::destroyDetached(GameEntity* entity) {
+		// The lists are released whole, nothing is erased from them one by one
+		for (auto* child : entity->releaseChildren()) {
+			destroyDetached(child);
+		}
+
+		for (auto* comp : entity->releaseComponents()) {
+			forgetComponent(comp);
+			if (comp->pool_) comp->pool_->destroy(dynamic_cast<void*>(comp));
+		}
+
+		if (entity->pool_) entity->pool_->destroy(dynamic_cast<void*>(entity));
+	}
+
+	void GameScene::detachEntities(std::vector<GameEntity*>& entities) {
+		std::sort(entities.begin(), entities.end(), [](GameEntity* a, GameEntity* b) {
+			return a->getParent() != b->getParent() ? std::less<GameEntity*>()(a->getParent(), b->getParent()) : std::less<GameEntity*>()(a, b);
+		});
+
+		for (auto first = entities.begin(); first != entities.end();) {
+			GameEntity* parent = (*first)->getParent();
+			auto last = std::find_if(first, entities.end(), [parent](GameEntity* entity) { return entity->getParent() != parent; });
+			std::span<GameEntity* const> siblings(&*first, static_cast<size_t>(last - first));
+
+			if (parent) {
+				parent->removeChildren(siblings);
+			} else {
+				std::erase_if(entities_, [&](GameEntity* root) { return std::binary_search(siblings.begin(), siblings.end(), root); });
+			}
+			first = last;
+		}
+	}
+
+	GameEntity* GameScene::findPlacementCycle(const std::unordered_map<GameEntity*, const SceneCommand*>& placement) const {
+		auto finalParent = [&](GameEntity* entity) {
+			auto it = placement.find(entity);
+			return it != placement.end() ? it->second->parent : entity->getParent();
+		};
+
+		// Only placed entities can close a cycle, the hierarchy was a forest before
+		std::vector<GameEntity*> path;
+		for (const auto& [entity, command] : placement) {
+			path.clear();
+			for (GameEntity* ancestor = entity; ancestor; ancestor = finalParent(ancestor)) {
+				auto placed = placement.find(ancestor);
+				if (placed == placement.end()) continue;
+
+				auto seen = std::find(path.begin(), path.end(), ancestor);
+				if (seen != path.end()) {
+					// Prefer a reparent on the cycle, a spawn only closes one through old children
+					for (auto it = seen; it != path.end(); ++it) {
+						if (placement.at(*it)->type == SceneCommandType::Reparent) return *it;
+					}
+					return *seen;
+				}
+				path.push_back(ancestor);
+			}
+		}
+		return nullptr;
+	}
+
+	void GameScene::applyCommands() {
+		commands_.take(applying_);
+		if (applying_.empty()) return;
+
+		std::stable_sort(applying_.begin(), applying_.end(), [](const SceneCommand& a, const SceneCommand& b) {
+			return a.type < b.type;
+		});
+		auto commandsOf = [&](SceneCommandType type) {
+			auto range = std::ranges::equal_range(applying_, type, {}, &SceneCommand::type);
+			return std::span<SceneCommand>(range.begin(), range.end());
+		};
+
+		// Only the last spawn or reparent of an entity places it
+		std::unordered_map<GameEntity*, const SceneCommand*> placement;
+		std::unordered_map<GameEntity*, const SceneCommand*> spawns;
+		for (const SceneCommand& command : commandsOf(SceneCommandType::Spawn)) {
+			placement[command.entity] = &command;
+			spawns[command.entity] = &command;
+		}
+		for (const SceneCommand& command : commandsOf(SceneCommandType::Reparent)) {
+			placement[command.entity] = &command;
+		}
+
+		// Placements that close a cycle are dropped one at a time, a reparent of a spawned
+		// entity falls back to its spawn
+		while (GameEntity* entity = findPlacementCycle(placement)) {
+			std::cerr << "Error: Reparenting would make an entity its own ancestor, the command is dropped." << std::endl;
+			auto spawn = spawns.find(entity);
+			if (spawn != spawns.end() && placement[entity] != spawn->second) placement[entity] = spawn->second;
+			else placement.erase(entity);
+		}
+
+		std::vector<GameEntity*> moved;
+		for (const SceneCommand& command : commandsOf(SceneCommandType::Reparent)) {
+			auto it = placement.find(command.entity);
+			if (it != placement.end() && it->second == &command) moved.push_back(command.entity);
+		}
+		detachEntities(moved);
+
+		for (auto type : { SceneCommandType::Spawn, SceneCommandType::Reparent }) {
+			for (const SceneCommand& command : commandsOf(type)) {
+				auto it = placement.find(command.entity);
+				if (it == placement.end() || it->second != &command) continue;
+				if (command.parent) command.parent->addChild(command.entity);
+				else entities_.push_back(command.entity);
+			}
+		}
+
+		// Whichever command placed them
+		for (const auto& [entity, command] : spawns) {
+			if (placement.count(entity)) recursiveBindInput(entity);
+		}
+
+		for (const SceneCommand& command : commandsOf(SceneCommandType::Enable)) {
+			command.entity->setEnabled(command.enabled);
+		}
+
+		for (const SceneCommand& command : commandsOf(SceneCommandType::AddComponent)) {
+			command.entity->addComponent(command.component);
+			input_.unsubscribe(command.component);
+			command.component->subscribeInput(input_);
+		}
+
+		// Grouped by entity, so each entity compacts its list and rebuilds its slots once
+		auto removals = commandsOf(SceneCommandType::RemoveComponent);
+		std::sort(removals.begin(), removals.end(), [](const SceneCommand& a, const SceneCommand& b) {
+			return a.entity != b.entity ? std::less<GameEntity*>()(a.entity, b.entity) : std::less<GameComponent*>()(a.component, b.component);
+		});
+		std::vector<GameComponent*> comps;
+		for (auto first = removals.begin(); first != removals.end();) {
+			GameEntity* entity = first->entity;
+			comps.clear();
+			for (; first != removals.end() && first->entity == entity; ++first) {
+				if (first->component->getEntity() == entity && (comps.empty() || comps.back() != first->component)) comps.push_back(first->component);
+			}
+
+			entity->removeComponents(comps);
+			for (auto* comp : comps) {
+				forgetComponent(comp);
+				if (comp->pool_) comp->pool_->destroy(dynamic_cast<void*>(comp));
+			}
+		}
+
+		// Entities under another destroyed entity go with its subtree
+
+		std::vector<GameEntity*> destroyed;
+		for (const SceneCommand& command : commandsOf(SceneCommandType::Destroy)) destroyed.push_back(command.entity);
+		std::sort(destroyed.begin(), destroyed.end());
+		destroyed.erase(std::unique(destroyed.begin(), destroyed.end()), destroyed.end());
+
+		std::vector<GameEntity*> tops;
+		for (auto* entity : destroyed) {
+			bool covered = false;
+			for (GameEntity* ancestor = entity->getParent(); ancestor && !covered; ancestor = ancestor->getParent()) {
+				covered = std::binary_search(destroyed.begin(), destroyed.end(), ancestor);
+			}
+			if (!covered) tops.push_back(entity);
+		}
+
+		detachEntities(tops);
+		for (auto* entity : tops) {
+			destroyDetached(entity);
+		}
+
+		applying_.clear();
+	}
+
+	void GameScene::forgetComponent(GameComponent* comp) {
+		if (comp == mainCamera_) mainCamera_ = nullptr;
+		if (comp == mainLight_) mainLight_ = nullptr;
+		input_.unsubscribe(comp);
+		extraLights_.erase(std::remove(extraLights_.begin(), extraLights_.end(), comp), extraLights_.end());
+	}
+
+	PoolStats GameScene::getMemoryStats() const {
+		PoolStats total;
+		for (const auto& pool : object_pools_) {
+			if (pool) total += pool->stats();
 		}
+		return total;
 	}
 }
\ No newline at end of file
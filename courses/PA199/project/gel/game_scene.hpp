@@ -3,21 +3,36 @@
 #include "camera/camera_component.hpp"
 #include "light/directional_light_component.hpp"
 #include "util/shader_resource.hpp"
+#include "ecs/registry.hpp"
+#include "memory/object_pool.hpp"
+#include "jobs/job_system.hpp"
+#include "input/input_system.hpp"
+#include "ecs/command_buffer.hpp"
 
 #include <vector>
 #include <map>
+#include <mutex>
+#include <unordered_map>
 #include <glad/glad.h>
 
 namespace gel {
 	class GameEntity; // Forward declaration
 
+	// Timing of the last GameScene::update
+	struct UpdateStats {
+		double update_ms = 0.0;
+		double parallel_ms = 0.0;    // wall time of the parallel phases
+		double scheduling_ms = 0.0;  // part of parallel_ms not spent in updates, per thread
+		uint64_t jobs = 0;
+		uint64_t steals = 0;
+	};
+
 	class GameScene {
 	public:
 		GameScene() = default;
+		// Entities and components made by the scene are freed with their pools, a block per
+		// chunk. Entities added with addEntity but made elsewhere stay with their owner.
 		virtual ~GameScene() {
-			for (auto entity : entities_) {
-				delete entity;
-			}
 			entities_.clear();
 
 			for (auto& [name, val] : shader_resources_) {
@@ -26,12 +41,94 @@ namespace gel {
 				glDeleteProgram(val.program);
 			}
 			shader_resources_.clear();
+
+			if (!textures_.empty()) glDeleteTextures(static_cast<GLsizei>(textures_.size()), textures_.data());
+			textures_.clear();
 		}
 
+		// One simulation step. Buffered input is dispatched and local transforms are stored
+		// first for render to blend from, the commands recorded meanwhile are applied last.
 		void update(float delta_time);
 		void setupLights();
-		void render();
-		void handleKeyPressed(int key, int scancode, int action, int mods);
+		// Draws entities that moved during the last step alpha of the way from where the step
+		// began, so frames between fixed steps do not stutter. 1 draws the current state.
+		void render(float alpha = 1.0f);
+
+		// Key events go here and reach only the components that subscribed
+		InputSystem& getInput() {
+			return input_;
+		}
+
+		// Lets the components of the entity and its subtree, or of the whole scene when null,
+		// subscribe to input. Their old subscriptions are dropped first, so it may run again
+		// after the hierarchy changed.
+		void bindInput(GameEntity* entity = nullptr);
+
+		// OWNERSHIP FUNCTIONS
+		// -------------------------------
+		// The scene owns what it creates: objects live in one pool per type and are destroyed
+		// with destroyEntity or with the scene. createEntity does not add the entity to the
+		// scene, addEntity or addChild still place it. Creating is thread safe, so updates on
+		// the job system can make objects for the command buffer.
+
+		template<typename... Args>
+		GameEntity* createEntity(Args&&... args) {
+			std::lock_guard<std::mutex> lock(create_mutex_);
+			auto& pool = objectPool<GameEntity>();
+			GameEntity* entity = pool.create(std::forward<Args>(args)...);
+			entity->pool_ = &pool;
+			return entity;
+		}
+
+		template<typename T, typename... Args>
+		T* createComponent(Args&&... args) {
+			std::lock_guard<std::mutex> lock(create_mutex_);
+			auto& pool = objectPool<T>();
+			T* comp = pool.create(std::forward<Args>(args)...);
+			comp->pool_ = &pool;
+			return comp;
+		}
+
+		// Destroys the entity, its children and the components the scene owns, and detaches
+		// the components it does not
+		void destroyEntity(GameEntity* entity);
+
+		// COMMAND FUNCTIONS
+		// -------------------------------
+		// addEntity, destroyEntity and the hierarchy functions of GameEntity change the lists
+		// update and render walk, so code running inside update records its changes here
+		// instead. They take effect together at the end of update, or on applyCommands.
+
+		CommandBuffer& getCommands() {
+			return commands_;
+		}
+
+		// Applies the recorded commands in the order of SceneCommandType, each type in
+		// recording order: an entity reparented twice ends under the last parent, and a
+		// component added and removed is gone. Every list loses its removed entries in one
+		// pass. Added components and spawned subtrees are bound to input. A reparent that would
+		// make an entity its own ancestor is dropped with an error on std::cerr, the rest of the
+		// commands still apply.
+		void applyCommands();
+
+		// GL texture deleted with the scene
+		void addTexture(GLuint texture) {
+			textures_.push_back(texture);
+		}
+
+		// In the order they were added, which is how scene files refer to them
+		const std::vector<GLuint>& getTextures() const {
+			return textures_;
+		}
+
+		// Totals over all object pools of the scene
+		PoolStats getMemoryStats() const;
+
+		template<typename T>
+		PoolStats getMemoryStats() const {
+			size_t index = detail::poolIndex<T>();
+			return index < object_pools_.size() && object_pools_[index] ? object_pools_[index]->stats() : PoolStats{};
+		}
 
 		void addEntity(GameEntity* entity) {
 			entities_.push_back(entity);
@@ -41,6 +138,23 @@ namespace gel {
 			entities_.erase(std::remove(entities_.begin(), entities_.end(), entity), entities_.end());
 		}
 
+		// Pooled components of entities bound to it, updated before the entity hierarchy
+		Registry& getRegistry() {
+			return registry_;
+		}
+
+		// Updates run on the job system when one is set. Components declaring only their own
+		// entity update first, one job per root subtree; components that may touch anything
+		// follow on this thread in tree order; read-only scene queries run last, spread over
+		// all threads. Null restores the serial update.
+		void setJobSystem(JobSystem* jobs) {
+			jobs_ = jobs;
+		}
+
+		const UpdateStats& getUpdateStats() const {
+			return update_stats_;
+		}
+
 		const std::vector<GameEntity*>& getEntities() const {
 			return entities_;
 		}
@@ -103,6 +217,25 @@ namespace gel {
 		}
 
 	private:
+		// Declared first so it outlives the pooled entities that unregister from it
+		Registry registry_;
+
+		// Indexed like the registry pools, by detail::poolIndex
+		std::vector<std::unique_ptr<detail::ObjectPoolBase>> object_pools_;
+		std::vector<GLuint> textures_;
+
+		InputSystem input_;
+
+		CommandBuffer commands_;
+		std::vector<SceneCommand> applying_;
+		std::mutex create_mutex_;
+
+		JobSystem* jobs_ = nullptr;
+		UpdateStats update_stats_;
+		std::vector<GameEntity*> update_roots_;
+		std::vector<GameComponent*> update_queries_;
+		std::vector<uint8_t> update_shared_;
+
 		std::vector<GameEntity*> entities_;
 
 		CameraComponent* mainCamera_ = nullptr;
@@ -113,8 +246,32 @@ namespace gel {
 		GLuint shader_program_ = 0;
 		std::map<std::string, ShaderResource> shader_resources_;
 
+		template<typename T>
+		ObjectPool<T>& objectPool() {
+			size_t index = detail::poolIndex<T>();
+			if (index >= object_pools_.size()) object_pools_.resize(index + 1);
+			if (!object_pools_[index]) object_pools_[index] = std::make_unique<ObjectPool<T>>();
+			return static_cast<ObjectPool<T>&>(*object_pools_[index]);
+		}
+
+		void forgetComponent(GameComponent* comp);
+
+		// Removes the entities from their parents or from the roots, one pass per list. Sorts
+		// the vector.
+		void detachEntities(std::vector<GameEntity*>& entities);
+		// An entity whose placement closes a cycle in the final hierarchy, or null
+		GameEntity* findPlacementCycle(const std::unordered_map<GameEntity*, const SceneCommand*>& placement) const;
+		// Destroys an entity that is no longer in the hierarchy, with its subtree
+		void destroyDetached(GameEntity* entity);
+
 		void recursiveUpdate(GameEntity* entity, float delta_time);
-		void recursiveRender(GameEntity* entity);
-		void recursiveHandleKeyPressed(GameEntity* entity, int key, int scancode, int action, int mods);
+		void updateParallel(float delta_time);
+		// Returns whether the subtree has components that are not entity-local
+		bool recursiveUpdateAccess(GameEntity* entity, float delta_time, bool exclusive);
+		void recursiveRefreshTransforms(GameEntity* entity);
+		void recursiveStorePreviousTransforms(GameEntity* entity);
+		// Null parent_model means no ancestor is blended and the cached world matrix still holds
+		void recursiveRender(GameEntity* entity, float alpha, const gem::Matrix4<float>* parent_model);
+		void recursiveBindInput(GameEntity* entity);
 	};
 }
\ No newline at end of file
@@ -1,5 +1,11 @@
 #pragma once
 
+#include "component_type.hpp"
+#include "ecs/registry.hpp"
+#include "ecs/command_buffer.hpp"
+#include "memory/object_pool.hpp"
+#include "jobs/job_system.hpp"
+#include "input/input_system.hpp"
 #include "game_entity.hpp"
 #include "game_component.hpp"
 #include "test_component.hpp"
@@ -12,6 +18,7 @@
 #include "renderer/circle_renderer_component.hpp"
 #include "renderer/cylinder_renderer_component.hpp"
 #include "renderer/arc_renderer_component.hpp"
+#include "renderer/spline_renderer_component.hpp"
 #include "light/light_component.hpp"
 #include "light/directional_light_component.hpp"
 #include "light/point_light_component.hpp"
@@ -20,4 +27,6 @@
 #include "physics/rigidbody_component.hpp"
 #include "physics/adhoc_brick_broadphase_collision_component.hpp"
 #include "control/ball_reset_component.hpp"
-#include "game_scene.hpp"
\ No newline at end of file
+#include "animation/animator_component.hpp"
+#include "game_scene.hpp"
+#include "io/scene_file.hpp"
\ No newline at end of file
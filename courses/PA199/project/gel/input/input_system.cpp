@@ -0,0 +1,130 @@
+#include "input_system.hpp"
+#include "game_component.hpp"
+#include "game_entity.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace gel {
+	namespace {
+		bool listening(GameComponent* listener) {
+			if (!listener) return false;
+			GameEntity* entity = listener->getEntity();
+			return !entity || entity->isActiveInHierarchy();
+		}
+	}
+
+	void InputSystem::pushKeyEvent(int key, int scancode, int action, int mods) {
+		if (validKey(key)) events_.push_back(KeyEvent{ key, scancode, action, mods });
+	}
+
+	void InputSystem::dispatch() {
+		pressed_.reset();
+
+		// Listeners may subscribe or unsubscribe while handling an event. The lists are walked
+		// by index and looked up again for every listener, since subscribing may grow them;
+		// unsubscribing leaves a null behind until the dispatch is over, so no listener moves
+		// into a slot that was already passed. New events wait for the next dispatch.
+		std::vector<KeyEvent> events;
+		events.swap(events_);
+		dispatching_ = true;
+
+		for (const KeyEvent& event : events) {
+			if (event.action == GLFW_PRESS) {
+				held_.set(event.key);
+				pressed_.set(event.key);
+			} else if (event.action == GLFW_RELEASE) {
+				held_.reset(event.key);
+			}
+
+			for (size_t i = 0; i < key_listeners_[event.key].size(); ++i) {
+				GameComponent* listener = key_listeners_[event.key][i];
+				if (listening(listener)) listener->handleKeyPressed(event.key, event.scancode, event.action, event.mods);
+			}
+
+			for (size_t a = 0; a < key_actions_[event.key].size(); ++a) {
+				ActionId action = key_actions_[event.key][a];
+				for (size_t i = 0; i < action_listeners_[action].size(); ++i) {
+					GameComponent* listener = action_listeners_[action][i];
+					if (listening(listener)) listener->handleKeyPressed(event.key, event.scancode, event.action, event.mods);
+				}
+			}
+		}
+
+		dispatching_ = false;
+		if (unsubscribed_) {
+			for (auto& listeners : key_listeners_) std::erase(listeners, nullptr);
+			for (auto& listeners : action_listeners_) std::erase(listeners, nullptr);
+			unsubscribed_ = false;
+		}
+
+		// Keeps the capacity for the next frame
+		events.clear();
+		if (events_.empty()) events_.swap(events);
+	}
+
+	InputSystem::ActionId InputSystem::action(const std::string& name) {
+		auto [it, inserted] = action_ids_.emplace(name, static_cast<ActionId>(action_keys_.size()));
+		if (inserted) {
+			action_keys_.emplace_back();
+			action_listeners_.emplace_back();
+		}
+		return it->second;
+	}
+
+	void InputSystem::bindKey(ActionId action, int key) {
+		checkAction(action);
+		if (!validKey(key)) throw std::runtime_error("gel: cannot bind key " + std::to_string(key) + ".");
+
+		auto& actions = key_actions_[key];
+		if (std::find(actions.begin(), actions.end(), action) != actions.end()) return;
+		actions.push_back(action);
+		action_keys_[action].push_back(key);
+	}
+
+	void InputSystem::subscribeKey(int key, GameComponent* listener) {
+		if (!validKey(key)) throw std::runtime_error("gel: cannot subscribe to key " + std::to_string(key) + ".");
+		key_listeners_[key].push_back(listener);
+		++subscriptions_[listener];
+	}
+
+	void InputSystem::subscribeAction(ActionId action, GameComponent* listener) {
+		checkAction(action);
+		action_listeners_[action].push_back(listener);
+		++subscriptions_[listener];
+	}
+
+	void InputSystem::unsubscribe(GameComponent* listener) {
+		if (subscriptions_.erase(listener) == 0) return;
+
+		auto unlist = [&](std::vector<GameComponent*>& listeners) {
+			if (dispatching_) std::replace(listeners.begin(), listeners.end(), listener, static_cast<GameComponent*>(nullptr));
+			else std::erase(listeners, listener);
+		};
+		for (auto& listeners : key_listeners_) unlist(listeners);
+		for (auto& listeners : action_listeners_) unlist(listeners);
+		unsubscribed_ = unsubscribed_ || dispatching_;
+	}
+
+	bool InputSystem::isKeyDown(int key) const {
+		return validKey(key) && (held_.test(key) || pressed_.test(key));
+	}
+
+	bool InputSystem::isActionDown(ActionId action) const {
+		checkAction(action);
+		for (int key : action_keys_[action]) {
+			if (isKeyDown(key)) return true;
+		}
+		return false;
+	}
+
+	size_t InputSystem::listenerCount() const {
+		size_t count = 0;
+		for (const auto& [listener, subscriptions] : subscriptions_) count += subscriptions;
+		return count;
+	}
+
+	void InputSystem::checkAction(ActionId action) const {
+		if (action >= action_keys_.size()) throw std::runtime_error("gel: unknown input action " + std::to_string(action) + ".");
+	}
+}
\ No newline at end of file
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <GLFW/glfw3.h>
+
+namespace gel {
+	class GameComponent;
+
+	struct KeyEvent {
+		int key;
+		int scancode;
+		int action;   // GLFW_PRESS, GLFW_RELEASE or GLFW_REPEAT
+		int mods;
+	};
+
+	// Key events are buffered as the window reports them and handled in one go by dispatch,
+	// which GameScene::update calls before anything updates. Dispatching indexes a table by
+	// key, so an event only costs its own listeners. Actions name a group of keys: listening
+	// to an action hears every key bound to it, and polling it checks all of them.
+	// Everything runs on the main thread; the key state stays fixed while updates read it.
+	class InputSystem {
+	public:
+		using ActionId = uint32_t;
+
+		static constexpr int KEY_COUNT = GLFW_KEY_LAST + 1;
+
+		// Called from the window's key callback. Keys GLFW does not know are dropped.
+		void pushKeyEvent(int key, int scancode, int action, int mods);
+
+		// Updates the key state from the buffered events and hands each to the components
+		// listening to its key or to one of its actions, in the order they subscribed.
+		// Listeners whose entity is not active in the hierarchy are skipped.
+		void dispatch();
+
+		// The id of the named action, created on first use
+		ActionId action(const std::string& name);
+		void bindKey(ActionId action, int key);
+
+		void subscribeKey(int key, GameComponent* listener);
+		void subscribeAction(ActionId action, GameComponent* listener);
+		// Removes every subscription of the listener
+		void unsubscribe(GameComponent* listener);
+
+		// Held after the last dispatch, or pressed during it so a tap shorter than a step
+		// still counts once
+		bool isKeyDown(int key) const;
+		bool isActionDown(ActionId action) const;
+
+		size_t listenerCount() const;
+
+	private:
+		std::vector<KeyEvent> events_;
+
+		std::bitset<KEY_COUNT> held_;
+		std::bitset<KEY_COUNT> pressed_;
+
+		std::unordered_map<std::string, ActionId> action_ids_;
+		std::vector<std::vector<int>> action_keys_;
+		std::vector<std::vector<GameComponent*>> action_listeners_;
+
+		// Per key: the actions it is bound to and the components listening to the key itself
+		std::array<std::vector<ActionId>, KEY_COUNT> key_actions_;
+		std::array<std::vector<GameComponent*>, KEY_COUNT> key_listeners_;
+		// Subscriptions per listener, so unsubscribing components that never listened is cheap
+		std::unordered_map<GameComponent*, uint32_t> subscriptions_;
+
+		// Unsubscribing during dispatch nulls entries, which are erased once it returns
+		bool dispatching_ = false;
+		bool unsubscribed_ = false;
+
+		static bool validKey(int key) { return key >= 0 && key < KEY_COUNT; }
+		void checkAction(ActionId action) const;
+	};
+}
\ No newline at end of file
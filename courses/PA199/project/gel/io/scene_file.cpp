@@ -0,0 +1,619 @@
+#include "scene_file.hpp"
+#include "game_entity.hpp"
+#include "game_scene.hpp"
+#include "camera/camera_component.hpp"
+#include "control/ball_reset_component.hpp"
+#include "control/paddle_controller_component.hpp"
+#include "light/directional_light_component.hpp"
+#include "light/point_light_component.hpp"
+#include "physics/adhoc_brick_broadphase_collision_component.hpp"
+#include "physics/adhoc_paddle_broadphase_collision_component.hpp"
+#include "physics/rigidbody_component.hpp"
+#include "renderer/arc_renderer_component.hpp"
+#include "renderer/sphere_renderer_component.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string_view>
+#include <typeinfo>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+// minwindef.h defines these as empty, which would break CameraComponent::near and far
+#undef near
+#undef far
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace gel {
+	static_assert(std::endian::native == std::endian::little, "gel: scene files are read in place and assume a little-endian host.");
+
+	namespace {
+		constexpr uint64_t SCENE_FILE_ALIGNMENT = 16;
+
+		uint64_t alignUp(uint64_t offset) {
+			return (offset + SCENE_FILE_ALIGNMENT - 1) & ~(SCENE_FILE_ALIGNMENT - 1);
+		}
+
+		// Whether count records of size bytes fit at offset in a region of size limit
+		bool fits(uint64_t offset, uint64_t count, uint64_t size, uint64_t limit) {
+			return offset <= limit && count <= (limit - offset) / size;
+		}
+
+		bool fitsAligned(uint64_t offset, uint64_t count, uint64_t size, uint64_t limit) {
+			return offset % SCENE_FILE_ALIGNMENT == 0 && fits(offset, count, size, limit);
+		}
+
+		[[noreturn]] void malformed(const std::string& what) {
+			throw std::runtime_error("Malformed scene file: " + what + ".");
+		}
+	}
+
+	// SCENE FILE
+	// -------------------------------
+
+	SceneFile::SceneFile(const std::string& path) {
+#ifdef _WIN32
+		file_ = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (file_ == INVALID_HANDLE_VALUE) {
+			file_ = nullptr;
+			throw std::runtime_error("Failed to open scene file " + path + ".");
+		}
+
+		LARGE_INTEGER size;
+		if (!GetFileSizeEx(file_, &size)) {
+			unmap();
+			throw std::runtime_error("Failed to read the size of scene file " + path + ".");
+		}
+		size_ = static_cast<size_t>(size.QuadPart);
+		if (size_ < sizeof(SceneFileHeader)) {
+			unmap();
+			malformed("shorter than its header");
+		}
+
+		mapping_ = CreateFileMappingA(file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (mapping_) data_ = static_cast<const uint8_t*>(MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0));
+		if (!data_) {
+			unmap();
+			throw std::runtime_error("Failed to map scene file " + path + ".");
+		}
+#else
+		int fd = open(path.c_str(), O_RDONLY);
+		if (fd < 0) throw std::runtime_error("Failed to open scene file " + path + ".");
+
+		struct stat info;
+		if (fstat(fd, &info) != 0) {
+			close(fd);
+			throw std::runtime_error("Failed to read the size of scene file " + path + ".");
+		}
+		size_ = static_cast<size_t>(info.st_size);
+		if (size_ < sizeof(SceneFileHeader)) {
+			close(fd);
+			malformed("shorter than its header");
+		}
+
+		// The mapping keeps its own reference to the file
+		void* mapped = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+		close(fd);
+		if (mapped == MAP_FAILED) throw std::runtime_error("Failed to map scene file " + path + ".");
+		data_ = static_cast<const uint8_t*>(mapped);
+#endif
+
+		try {
+			validate();
+		} catch (...) {
+			unmap();
+			throw;
+		}
+	}
+
+	SceneFile::~SceneFile() {
+		unmap();
+	}
+
+	void SceneFile::unmap() {
+#ifdef _WIN32
+		if (data_) UnmapViewOfFile(data_);
+		if (mapping_) CloseHandle(mapping_);
+		if (file_) CloseHandle(file_);
+		mapping_ = nullptr;
+		file_ = nullptr;
+#else
+		if (data_) munmap(const_cast<uint8_t*>(data_), size_);
+#endif
+		data_ = nullptr;
+	}
+
+	void SceneFile::validate() const {
+		const SceneFileHeader& h = header();
+		if (std::memcmp(h.magic, SCENE_FILE_MAGIC, sizeof(SCENE_FILE_MAGIC)) != 0) malformed("not a scene file");
+		if (h.version != SCENE_FILE_VERSION) {
+			throw std::runtime_error("Scene file version " + std::to_string(h.version) + " is not supported, expected " + std::to_string(SCENE_FILE_VERSION) + ".");
+		}
+
+		if (!fitsAligned(h.entities, h.entity_count, sizeof(SceneFileEntity), size_)) malformed("entity table out of bounds");
+		if (!fitsAligned(h.components, h.component_count, sizeof(SceneFileComponent), size_)) malformed("component table out of bounds");
+		if (!fitsAligned(h.meshes, h.mesh_count, sizeof(SceneFileMesh), size_)) malformed("mesh table out of bounds");
+		if (!fitsAligned(h.references, h.reference_count, sizeof(uint32_t), size_)) malformed("reference table out of bounds");
+		if (!fitsAligned(h.data, h.data_size, 1, size_)) malformed("data out of bounds");
+
+		if (h.main_camera != SCENE_FILE_NONE && h.main_camera >= h.component_count) malformed("main camera out of range");
+		if (h.main_light != SCENE_FILE_NONE && h.main_light >= h.component_count) malformed("main light out of range");
+
+		// The component runs of the entities tile the component table in order
+		uint32_t next_component = 0;
+		auto entity_records = entities();
+		for (uint32_t i = 0; i < entity_records.size(); ++i) {
+			const SceneFileEntity& entity = entity_records[i];
+			if (entity.parent != SCENE_FILE_NONE && entity.parent >= i) malformed("entity " + std::to_string(i) + " comes before its parent");
+			if (entity.first_component != next_component || !fits(entity.first_component, entity.component_count, 1, h.component_count)) {
+				malformed("components of entity " + std::to_string(i) + " out of order");
+			}
+			next_component += entity.component_count;
+		}
+		if (next_component != h.component_count) malformed("components without an entity");
+
+		for (const SceneFileComponent& component : components()) {
+			if (component.type >= static_cast<uint32_t>(ComponentType::COUNT)) malformed("unknown component type");
+			if (component.mesh != SCENE_FILE_NONE && component.mesh >= h.mesh_count) malformed("mesh index out of range");
+			if (!fits(component.first_reference, component.reference_count, 1, h.reference_count)) malformed("references out of range");
+		}
+
+		for (const SceneFileMesh& mesh : meshes()) {
+			if (mesh.layout > static_cast<uint32_t>(VertexLayout::Packed)) malformed("unknown vertex layout");
+			if (!fitsAligned(mesh.vertices, mesh.vertex_count, vertexSize(static_cast<VertexLayout>(mesh.layout)), h.data_size)) malformed("vertices out of bounds");
+			if (!fitsAligned(mesh.indices, mesh.index_count, sizeof(unsigned int), h.data_size)) malformed("indices out of bounds");
+		}
+	}
+
+	MeshView SceneFile::mesh(uint32_t index) const {
+		const SceneFileMesh& mesh = meshes()[index];
+		const uint8_t* data = data_ + header().data;
+		return MeshView{
+			data + mesh.vertices, mesh.vertex_count,
+			reinterpret_cast<const unsigned int*>(data + mesh.indices), mesh.index_count,
+			static_cast<VertexLayout>(mesh.layout)
+		};
+	}
+
+	// SCENE WRITER
+	// -------------------------------
+
+	uint32_t SceneWriter::addEntity(const SceneFileEntity& entity) {
+		SceneFileEntity& added = entities_.emplace_back(entity);
+		added.first_component = static_cast<uint32_t>(components_.size());
+		added.component_count = 0;
+		return static_cast<uint32_t>(entities_.size() - 1);
+	}
+
+	uint32_t SceneWriter::addComponent(const SceneFileComponent& component, std::span<const uint32_t> references) {
+		if (entities_.empty()) throw std::runtime_error("Scene file components need an entity added first.");
+
+		SceneFileComponent& added = components_.emplace_back(component);
+		added.first_reference = static_cast<uint32_t>(references_.size());
+		added.reference_count = static_cast<uint32_t>(references.size());
+		references_.insert(references_.end(), references.begin(), references.end());
+
+		entities_.back().component_count++;
+		return static_cast<uint32_t>(components_.size() - 1);
+	}
+
+	uint32_t SceneWriter::addMesh(const void* vertices, uint32_t vertex_count, const unsigned int* indices, uint32_t index_count, VertexLayout layout) {
+		std::string_view vertex_bytes(static_cast<const char*>(vertices), vertex_count * vertexSize(layout));
+		std::string_view index_bytes(reinterpret_cast<const char*>(indices), index_count * sizeof(unsigned int));
+		size_t hash = std::hash<std::string_view>{}(vertex_bytes) ^ (std::hash<std::string_view>{}(index_bytes) * 31) ^ static_cast<size_t>(layout);
+
+		auto [first, last] = mesh_hashes_.equal_range(hash);
+		for (auto it = first; it != last; ++it) {
+			const SceneFileMesh& mesh = meshes_[it->second];
+			if (mesh.layout == static_cast<uint32_t>(layout) && mesh.vertex_count == vertex_count && mesh.index_count == index_count &&
+				std::memcmp(data_.data() + mesh.vertices, vertex_bytes.data(), vertex_bytes.size()) == 0 &&
+				std::memcmp(data_.data() + mesh.indices, index_bytes.data(), index_bytes.size()) == 0) {
+				return it->second;
+			}
+		}
+
+		SceneFileMesh mesh{ static_cast<uint32_t>(layout), vertex_count, index_count, 0, 0, 0 };
+		mesh.vertices = alignUp(data_.size());
+		data_.resize(mesh.vertices);
+		data_.insert(data_.end(), vertex_bytes.begin(), vertex_bytes.end());
+		mesh.indices = alignUp(data_.size());
+		data_.resize(mesh.indices);
+		data_.insert(data_.end(), index_bytes.begin(), index_bytes.end());
+
+		meshes_.push_back(mesh);
+		uint32_t index = static_cast<uint32_t>(meshes_.size() - 1);
+		mesh_hashes_.emplace(hash, index);
+		return index;
+	}
+
+	std::vector<uint8_t> SceneWriter::serialize() const {
+		SceneFileHeader header{};
+		std::memcpy(header.magic, SCENE_FILE_MAGIC, sizeof(SCENE_FILE_MAGIC));
+		header.version = SCENE_FILE_VERSION;
+		header.entity_count = static_cast<uint32_t>(entities_.size());
+		header.component_count = static_cast<uint32_t>(components_.size());
+		header.mesh_count = static_cast<uint32_t>(meshes_.size());
+		header.reference_count = static_cast<uint32_t>(references_.size());
+		header.main_camera = main_camera_;
+		header.main_light = main_light_;
+
+		header.entities = alignUp(sizeof(SceneFileHeader));
+		header.components = alignUp(header.entities + entities_.size() * sizeof(SceneFileEntity));
+		header.meshes = alignUp(header.components + components_.size() * sizeof(SceneFileComponent));
+		header.references = alignUp(header.meshes + meshes_.size() * sizeof(SceneFileMesh));
+		header.data = alignUp(header.references + references_.size() * sizeof(uint32_t));
+		header.data_size = data_.size();
+
+		std::vector<uint8_t> bytes(header.data + header.data_size, 0);
+		auto place = [&](uint64_t offset, const void* source, size_t size) {
+			if (size) std::memcpy(bytes.data() + offset, source, size);
+		};
+		place(0, &header, sizeof(header));
+		place(header.entities, entities_.data(), entities_.size() * sizeof(SceneFileEntity));
+		place(header.components, components_.data(), components_.size() * sizeof(SceneFileComponent));
+		place(header.meshes, meshes_.data(), meshes_.size() * sizeof(SceneFileMesh));
+		place(header.references, references_.data(), references_.size() * sizeof(uint32_t));
+		place(header.data, data_.data(), data_.size());
+		return bytes;
+	}
+
+	void SceneWriter::write(const std::string& path) const {
+		std::vector<uint8_t> bytes = serialize();
+		std::ofstream out(path, std::ios::binary | std::ios::trunc);
+		if (!out) throw std::runtime_error("Failed to open " + path + " for writing.");
+		out.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+		if (!out) throw std::runtime_error("Failed to write scene file " + path + ".");
+	}
+
+	// EXPORT
+	// -------------------------------
+
+	namespace {
+		struct SceneExporter {
+			explicit SceneExporter(GameScene& scene) : scene(scene) {}
+
+			GameScene& scene;
+			SceneWriter writer;
+
+			std::vector<const GameEntity*> entities;
+			std::vector<uint32_t> parents;
+			std::unordered_map<const GameEntity*, uint32_t> entity_index;
+			std::unordered_map<const GameComponent*, uint32_t> component_index;
+			// Components of each entity in file order, pooled ones flagged
+			std::vector<std::vector<std::pair<GameComponent*, bool>>> components;
+
+			std::vector<uint8_t> vertex_bytes;
+			std::vector<unsigned int> indices;
+
+			void collect(const GameEntity* entity, uint32_t parent) {
+				uint32_t index = static_cast<uint32_t>(entities.size());
+				entities.push_back(entity);
+				parents.push_back(parent);
+				entity_index[entity] = index;
+
+				auto& listed = components.emplace_back();
+				for (auto* comp : entity->getComponents()) listed.emplace_back(comp, false);
+				if (Registry* registry = entity->getRegistry()) {
+					// Rigidbodies are the only pooled type the format covers
+					size_t covered = 0;
+					if (auto* body = registry->tryGet<RigidbodyComponent>(entity->getId())) {
+						listed.emplace_back(body, true);
+						++covered;
+					}
+					if (registry->componentCount(entity->getId()) > covered) {
+						throw std::runtime_error("Scene files cannot store pooled components other than RigidbodyComponent.");
+					}
+				}
+				for (auto& [comp, pooled] : listed) {
+					uint32_t next = static_cast<uint32_t>(component_index.size());
+					component_index[comp] = next;
+				}
+
+				for (auto* child : entity->getChildren()) collect(child, index);
+			}
+
+			uint32_t entityRef(const GameEntity* entity) const {
+				auto it = entity_index.find(entity);
+				if (it == entity_index.end()) throw std::runtime_error("A component refers to an entity outside the exported scene.");
+				return it->second;
+			}
+
+			uint32_t textureRef(GLuint texture) const {
+				if (!texture) return SCENE_FILE_NONE;
+				const auto& textures = scene.getTextures();
+				auto it = std::find(textures.begin(), textures.end(), texture);
+				if (it == textures.end()) throw std::runtime_error("Texture " + std::to_string(texture) + " is not owned by the exported scene.");
+				return static_cast<uint32_t>(it - textures.begin());
+			}
+
+			void setMesh(SceneFileComponent& record, const MeshRendererComponent* mesh) {
+				mesh->readMesh(vertex_bytes, indices);
+				record.mesh = writer.addMesh(vertex_bytes.data(), static_cast<uint32_t>(mesh->getVertexCount()),
+					indices.data(), static_cast<uint32_t>(indices.size()), mesh->getVertexLayout());
+				record.texture = textureRef(mesh->getTexture());
+				record.ints[0] = mesh->mesh_initial_strength_;
+			}
+
+			static void setVector(float* values, const gem::Vector<float, 3>& vector) {
+				for (int i = 0; i < 3; ++i) values[i] = vector[i];
+			}
+
+			void addComponent(GameComponent* comp, bool pooled) {
+				SceneFileComponent record{};
+				record.flags = pooled ? static_cast<uint32_t>(SCENE_COMPONENT_POOLED) : 0u;
+				record.mesh = SCENE_FILE_NONE;
+				record.texture = SCENE_FILE_NONE;
+				std::vector<uint32_t> references;
+
+				const auto& extra_lights = scene.getExtraLights();
+				if (std::find(extra_lights.begin(), extra_lights.end(), comp) != extra_lights.end()) record.flags |= SCENE_COMPONENT_EXTRA_LIGHT;
+
+				if (auto* sphere = componentCast<SphereRendererComponent>(comp)) {
+					record.type = static_cast<uint32_t>(ComponentType::SphereRendererComponent);
+					setMesh(record, sphere);
+					record.ints[1] = static_cast<int32_t>(sphere->sector());
+					record.ints[2] = static_cast<int32_t>(sphere->stack());
+					record.values[0] = sphere->radius();
+				} else if (auto* arc = componentCast<ArcRendererComponent>(comp)) {
+					record.type = static_cast<uint32_t>(ComponentType::ArcRendererComponent);
+					setMesh(record, arc);
+					record.ints[1] = arc->segments();
+					record.values[0] = arc->innerRadius();
+					record.values[1] = arc->outerRadius();
+					record.values[2] = arc->height();
+					record.values[3] = arc->angle();
+				} else if (auto* mesh = componentCast<MeshRendererComponent>(comp)) {
+					record.type = static_cast<uint32_t>(ComponentType::MeshRendererComponent);
+					setMesh(record, mesh);
+				} else if (auto* camera = componentCast<CameraComponent>(comp)) {
+					record.type = static_cast<uint32_t>(ComponentType::CameraComponent);
+					record.ints[0] = camera->isOrthographic() ? 1 : 0;
+					record.values[0] = camera->fov();
+					record.values[1] = camera->aspect_ratio();
+					record.values[2] = camera->near();
+					record.values[3] = camera->far();
+					if (camera->targetEntity) references.push_back(entityRef(camera->targetEntity));
+				} else if (auto* light = componentCast<LightComponent>(comp)) {
+					setVector(record.values + 0, light->getAmbient());
+					setVector(record.values + 3, light->getDiffuse());
+					setVector(record.values + 6, light->getSpecular());
+					if (auto* point = componentCast<PointLightComponent>(comp)) {
+						record.type = static_cast<uint32_t>(ComponentType::PointLightComponent);
+						record.values[9] = point->getRange();
+						record.values[10] = point->getConstant();
+						record.values[11] = point->getLinear();
+						record.values[12] = point->getQuadratic();
+					} else if (componentCast<DirectionalLightComponent>(comp)) {
+						record.type = static_cast<uint32_t>(ComponentType::DirectionalLightComponent);
+					} else {
+						throw std::runtime_error("Scene files do not cover plain LightComponent.");
+					}
+				} else if (auto* body = componentCast<RigidbodyComponent>(comp)) {
+					record.type = static_cast<uint32_t>(ComponentType::RigidbodyComponent);
+					record.values[0] = body->mass();
+					setVector(record.values + 1, body->velocity());
+				} else if (auto* paddle = componentCast<PaddleControllerComponent>(comp)) {
+					record.type = static_cast<uint32_t>(ComponentType::PaddleControllerComponent);
+					record.values[0] = paddle->speed();
+				} else if (auto* reset = componentCast<BallResetComponent>(comp)) {
+					record.type = static_cast<uint32_t>(ComponentType::BallResetComponent);
+					setVector(record.values, reset->initialPosition());
+				} else if (auto* paddles = componentCast<AdhocPaddleBroadphaseCollisionComponent>(comp)) {
+					record.type = static_cast<uint32_t>(ComponentType::AdhocPaddleBroadphaseCollisionComponent);
+					references = { entityRef(paddles->getBallEntity()), entityRef(paddles->getPaddleEntityA()), entityRef(paddles->getPaddleEntityB()) };
+				} else if (auto* bricks = componentCast<AdhocBrickBroadphaseCollisionComponent>(comp)) {
+					record.type = static_cast<uint32_t>(ComponentType::AdhocBrickBroadphaseCollisionComponent);
+					record.ints[0] = bricks->getTowerBase();
+					record.ints[1] = bricks->getTowerStack();
+					record.values[0] = bricks->getTowerBaseY();
+					references.push_back(entityRef(bricks->getBallEntity()));
+					for (auto* brick : bricks->getArcRenderers()) {
+						auto it = component_index.find(brick);
+						if (it == component_index.end()) throw std::runtime_error("A brick collision refers to an arc outside the exported scene.");
+						references.push_back(it->second);
+					}
+				} else {
+					throw std::runtime_error(std::string("Scene files do not cover component ") + typeid(*comp).name() + ".");
+				}
+
+				writer.addComponent(record, references);
+			}
+
+			void run(const std::string& path) {
+				for (auto* root : scene.getEntities()) collect(root, SCENE_FILE_NONE);
+
+				for (size_t i = 0; i < entities.size(); ++i) {
+					const GameEntity* entity = entities[i];
+					const gem::Vector<float, 3>& position = entity->getPosition();
+					const gem::Quaternion<float>& orientation = entity->getOrientation();
+					const gem::Vector<float, 3>& scale = entity->getScale();
+
+					SceneFileEntity record{
+						{ position[0], position[1], position[2] },
+						{ orientation.w(), orientation.x(), orientation.y(), orientation.z() },
+						{ scale[0], scale[1], scale[2] },
+						parents[i],
+						entity->isEnabled() ? static_cast<uint32_t>(SCENE_ENTITY_ENABLED) : 0u,
+						0, 0
+					};
+					writer.addEntity(record);
+					for (auto& [comp, pooled] : components[i]) addComponent(comp, pooled);
+				}
+
+				auto componentRef = [&](const GameComponent* comp) {
+					auto it = component_index.find(comp);
+					return it == component_index.end() ? SCENE_FILE_NONE : it->second;
+				};
+				writer.setMainCamera(componentRef(scene.getMainCamera()));
+				writer.setMainLight(componentRef(scene.getMainLight()));
+				writer.write(path);
+			}
+		};
+	}
+
+	void exportScene(GameScene& scene, const std::string& path) {
+		SceneExporter(scene).run(path);
+	}
+
+	// LOAD
+	// -------------------------------
+
+	namespace {
+		gem::Vector<float, 3> readVector(const float* values) {
+			return gem::Vector<float, 3>{ values[0], values[1], values[2] };
+		}
+
+		// Components that look up other components when they are made, created once all the
+		// others are attached
+		bool refersToComponents(ComponentType type) {
+			return type == ComponentType::AdhocPaddleBroadphaseCollisionComponent || type == ComponentType::AdhocBrickBroadphaseCollisionComponent;
+		}
+
+		struct SceneLoader {
+			SceneLoader(GameScene& scene, const SceneFile& file) : scene(scene), file(file) {}
+
+			GameScene& scene;
+			const SceneFile& file;
+			std::vector<GameEntity*> entities;
+			std::vector<GameComponent*> components;
+
+			GLuint texture(const SceneFileComponent& record) const {
+				if (record.texture == SCENE_FILE_NONE) return 0;
+				const auto& textures = scene.getTextures();
+				if (record.texture >= textures.size()) {
+					throw std::runtime_error("Scene file uses texture " + std::to_string(record.texture) + " but the scene has " + std::to_string(textures.size()) + ".");
+				}
+				return textures[record.texture];
+			}
+
+			MeshView mesh(const SceneFileComponent& record) const {
+				if (record.mesh == SCENE_FILE_NONE) malformed("mesh renderer without a mesh");
+				return file.mesh(record.mesh);
+			}
+
+			GameEntity* entityRef(const SceneFileComponent& record, size_t i) const {
+				auto references = file.references(record);
+				if (i >= references.size() || references[i] >= entities.size()) malformed("entity reference out of range");
+				return entities[references[i]];
+			}
+
+			GameComponent* create(const SceneFileComponent& record, GameEntity* entity) {
+				const float* v = record.values;
+				switch (static_cast<ComponentType>(record.type)) {
+				case ComponentType::SphereRendererComponent:
+					return scene.createComponent<SphereRendererComponent>(mesh(record), v[0], record.ints[1], record.ints[2], texture(record));
+				case ComponentType::ArcRendererComponent:
+					return scene.createComponent<ArcRendererComponent>(mesh(record), v[0], v[1], record.ints[1], v[2], v[3], texture(record), record.ints[0]);
+				case ComponentType::MeshRendererComponent:
+					return scene.createComponent<MeshRendererComponent>(mesh(record), texture(record), record.ints[0]);
+				case ComponentType::CameraComponent: {
+					auto* camera = scene.createComponent<CameraComponent>(v[0], v[1], v[2], v[3], record.ints[0] != 0);
+					if (record.reference_count) camera->targetEntity = entityRef(record, 0);
+					return camera;
+				}
+				case ComponentType::DirectionalLightComponent:
+					return scene.createComponent<DirectionalLightComponent>(readVector(v), readVector(v + 3), readVector(v + 6));
+				case ComponentType::PointLightComponent:
+					return scene.createComponent<PointLightComponent>(readVector(v), readVector(v + 3), readVector(v + 6), v[9], v[10], v[11], v[12]);
+				case ComponentType::RigidbodyComponent: {
+					RigidbodyComponent* body;
+					if (record.flags & SCENE_COMPONENT_POOLED) {
+						if (!entity->getRegistry()) entity->bindRegistry(scene.getRegistry());
+						body = &entity->emplaceComponent<RigidbodyComponent>(v[0]);
+					} else {
+						body = scene.createComponent<RigidbodyComponent>(v[0]);
+					}
+					body->setVelocity(readVector(v + 1));
+					return body;
+				}
+				case ComponentType::PaddleControllerComponent:
+					return scene.createComponent<PaddleControllerComponent>(v[0]);
+				case ComponentType::BallResetComponent:
+					return scene.createComponent<BallResetComponent>(readVector(v));
+				case ComponentType::AdhocPaddleBroadphaseCollisionComponent:
+					return scene.createComponent<AdhocPaddleBroadphaseCollisionComponent>(entityRef(record, 0), entityRef(record, 1), entityRef(record, 2));
+				case ComponentType::AdhocBrickBroadphaseCollisionComponent: {
+					auto references = file.references(record);
+					std::vector<ArcRendererComponent*> arcs;
+					for (size_t i = 1; i < references.size(); ++i) {
+						auto* arc = references[i] < components.size() ? componentCast<ArcRendererComponent>(components[references[i]]) : nullptr;
+						if (!arc) malformed("brick collision refers to a component that is not an arc");
+						arcs.push_back(arc);
+					}
+					return scene.createComponent<AdhocBrickBroadphaseCollisionComponent>(entityRef(record, 0), arcs, record.ints[0], record.ints[1], v[0]);
+				}
+				default:
+					malformed("component type " + std::to_string(record.type) + " cannot be loaded");
+				}
+			}
+
+			void attach(uint32_t index, GameEntity* entity) {
+				const SceneFileComponent& record = file.components()[index];
+				GameComponent* comp = create(record, entity);
+				components[index] = comp;
+
+				if (!(record.flags & SCENE_COMPONENT_POOLED)) entity->addComponent(comp);
+				if (record.flags & SCENE_COMPONENT_EXTRA_LIGHT) {
+					if (auto* light = componentCast<LightComponent>(comp)) scene.addExtraLight(light);
+				}
+			}
+
+			void run() {
+				auto entity_records = file.entities();
+				entities.reserve(entity_records.size());
+				for (const SceneFileEntity& record : entity_records) {
+					GameEntity* entity = scene.createEntity(
+						gem::Vector<float, 3>{ record.position[0], record.position[1], record.position[2] },
+						gem::Quaternion<float>{ record.orientation[0], record.orientation[1], record.orientation[2], record.orientation[3] },
+						gem::Vector<float, 3>{ record.scale[0], record.scale[1], record.scale[2] },
+						(record.flags & SCENE_ENTITY_ENABLED) != 0
+					);
+					if (record.parent == SCENE_FILE_NONE) scene.addEntity(entity);
+					else entities[record.parent]->addChild(entity);
+					entities.push_back(entity);
+				}
+
+				auto component_records = file.components();
+				components.assign(component_records.size(), nullptr);
+				std::vector<std::pair<uint32_t, GameEntity*>> deferred;
+				for (size_t i = 0; i < entity_records.size(); ++i) {
+					const SceneFileEntity& record = entity_records[i];
+					for (uint32_t c = record.first_component; c < record.first_component + record.component_count; ++c) {
+						if (refersToComponents(static_cast<ComponentType>(component_records[c].type))) deferred.emplace_back(c, entities[i]);
+						else attach(c, entities[i]);
+					}
+				}
+				for (auto& [index, entity] : deferred) attach(index, entity);
+
+				const SceneFileHeader& header = file.header();
+				if (header.main_camera != SCENE_FILE_NONE) {
+					auto* camera = componentCast<CameraComponent>(components[header.main_camera]);
+					if (!camera) malformed("main camera is not a camera");
+					scene.setMainCamera(camera);
+				}
+				if (header.main_light != SCENE_FILE_NONE) {
+					auto* light = componentCast<DirectionalLightComponent>(components[header.main_light]);
+					if (!light) malformed("main light is not a directional light");
+					scene.setMainLight(light);
+				}
+			}
+		};
+	}
+
+	std::vector<GameEntity*> loadScene(GameScene& scene, const std::string& path) {
+		SceneFile file(path);
+		SceneLoader loader(scene, file);
+		loader.run();
+		return std::move(loader.entities);
+	}
+}
\ No newline at end of file
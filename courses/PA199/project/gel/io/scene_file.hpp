@@ -0,0 +1,188 @@
+#pragma once
+
+#include "component_type.hpp"
+#include "renderer/mesh_renderer_component.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace gel {
+	class GameEntity;
+	class GameScene;
+
+	// SCENE FILE FORMAT
+	// -------------------------------
+	// A header, flat tables of fixed-size records and one blob with the mesh buffers, all
+	// little endian and aligned to 16 bytes. A mapped file is used in place: the tables are
+	// read as arrays and the vertex bytes, stored in their GPU layout, go to glBufferData
+	// without being parsed or copied. Entities come parents first, each followed by its run of
+	// components. Records refer to each other by table index, textures by their index in
+	// GameScene::getTextures.
+
+	constexpr char SCENE_FILE_MAGIC[4] = { 'G', 'E', 'L', 'S' };
+	// Bump on any change to the records below, old files are rejected rather than misread
+	constexpr uint32_t SCENE_FILE_VERSION = 2;
+	constexpr uint32_t SCENE_FILE_NONE = 0xFFFFFFFFu;
+
+	enum SceneEntityFlags : uint32_t {
+		SCENE_ENTITY_ENABLED = 1 << 0
+	};
+
+	enum SceneComponentFlags : uint32_t {
+		SCENE_COMPONENT_POOLED = 1 << 0,       // kept in the scene registry instead of the entity's list
+		SCENE_COMPONENT_EXTRA_LIGHT = 1 << 1   // registered with GameScene::addExtraLight
+	};
+
+	struct SceneFileHeader {
+		char magic[4];
+		uint32_t version;
+		uint32_t entity_count;
+		uint32_t component_count;
+		uint32_t mesh_count;
+		uint32_t reference_count;
+		uint32_t main_camera;     // component index or SCENE_FILE_NONE
+		uint32_t main_light;
+		// Byte offsets from the start of the file
+		uint64_t entities;
+		uint64_t components;
+		uint64_t meshes;
+		uint64_t references;
+		uint64_t data;
+		uint64_t data_size;
+	};
+
+	struct SceneFileEntity {
+		float position[3];
+		float orientation[4];     // w, x, y, z
+		float scale[3];
+		uint32_t parent;          // entity index or SCENE_FILE_NONE for a root
+		uint32_t flags;
+		uint32_t first_component;
+		uint32_t component_count;
+	};
+
+	// The meaning of ints and values depends on the type:
+	//   MeshRendererComponent     ints[0] strength
+	//   SphereRendererComponent   ints[1] sector, ints[2] stack, values[0] radius
+	//   ArcRendererComponent      ints[0] strength, ints[1] segments, values[0..3] inner radius,
+	//                             outer radius, height, angle
+	//   CameraComponent           ints[0] orthographic, values[0..3] fov, aspect ratio, near, far,
+	//                             references: the target entity, if any
+	//   DirectionalLightComponent values[0..8] ambient, diffuse, specular
+	//   PointLightComponent       as above, values[9..12] range, constant, linear, quadratic
+	//   RigidbodyComponent        values[0] mass, values[1..3] velocity
+	//   PaddleControllerComponent values[0] speed in radians per second
+	//   BallResetComponent        values[0..2] initial position
+	//   AdhocPaddleBroadphaseCollisionComponent  references: ball, paddle A and paddle B entities
+	//   AdhocBrickBroadphaseCollisionComponent   ints[0..1] tower base and stack, values[0] tower
+	//                             base y, references: the ball entity, then the arc components
+	// Other mesh renderers are stored as MeshRendererComponent with their baked mesh.
+	struct SceneFileComponent {
+		uint32_t type;            // ComponentType
+		uint32_t flags;
+		uint32_t mesh;            // mesh index or SCENE_FILE_NONE
+		uint32_t texture;         // texture index or SCENE_FILE_NONE
+		uint32_t first_reference;
+		uint32_t reference_count;
+		int32_t ints[4];
+		float values[16];
+	};
+
+	struct SceneFileMesh {
+		uint32_t layout;          // VertexLayout
+		uint32_t vertex_count;
+		uint32_t index_count;
+		uint32_t reserved;
+		// Byte offsets into the data blob
+		uint64_t vertices;
+		uint64_t indices;
+	};
+
+	static_assert(sizeof(SceneFileHeader) == 80, "gel: SceneFileHeader layout changed, bump SCENE_FILE_VERSION.");
+	static_assert(sizeof(SceneFileEntity) == 56, "gel: SceneFileEntity layout changed, bump SCENE_FILE_VERSION.");
+	static_assert(sizeof(SceneFileComponent) == 104, "gel: SceneFileComponent layout changed, bump SCENE_FILE_VERSION.");
+	static_assert(sizeof(SceneFileMesh) == 32, "gel: SceneFileMesh layout changed, bump SCENE_FILE_VERSION.");
+
+	// A scene file mapped read-only. Opening checks the header and that every offset, count
+	// and index stays inside the file, so the accessors never read out of bounds. Throws
+	// std::runtime_error on files that are missing, malformed or of another version.
+	class SceneFile {
+	public:
+		explicit SceneFile(const std::string& path);
+		~SceneFile();
+
+		SceneFile(const SceneFile&) = delete;
+		SceneFile& operator=(const SceneFile&) = delete;
+
+		const SceneFileHeader& header() const { return *reinterpret_cast<const SceneFileHeader*>(data_); }
+
+		std::span<const SceneFileEntity> entities() const { return table<SceneFileEntity>(header().entities, header().entity_count); }
+		std::span<const SceneFileComponent> components() const { return table<SceneFileComponent>(header().components, header().component_count); }
+		std::span<const SceneFileMesh> meshes() const { return table<SceneFileMesh>(header().meshes, header().mesh_count); }
+		std::span<const uint32_t> references(const SceneFileComponent& component) const {
+			return table<uint32_t>(header().references, header().reference_count).subspan(component.first_reference, component.reference_count);
+		}
+
+		// Points into the mapping, valid while the file is open
+		MeshView mesh(uint32_t index) const;
+
+		const uint8_t* data() const { return data_; }
+		size_t size() const { return size_; }
+
+	private:
+		const uint8_t* data_ = nullptr;
+		size_t size_ = 0;
+#ifdef _WIN32
+		void* file_ = nullptr;
+		void* mapping_ = nullptr;
+#endif
+
+		template<typename T>
+		std::span<const T> table(uint64_t offset, uint32_t count) const {
+			return std::span<const T>(reinterpret_cast<const T*>(data_ + offset), count);
+		}
+
+		void validate() const;
+		void unmap();
+	};
+
+	// Builds the tables of a scene file in memory. Components belong to the entity added last,
+	// identical meshes are stored once.
+	class SceneWriter {
+	public:
+		uint32_t addEntity(const SceneFileEntity& entity);
+		uint32_t addComponent(const SceneFileComponent& component, std::span<const uint32_t> references = {});
+		uint32_t addMesh(const void* vertices, uint32_t vertex_count, const unsigned int* indices, uint32_t index_count, VertexLayout layout);
+
+		void setMainCamera(uint32_t component) { main_camera_ = component; }
+		void setMainLight(uint32_t component) { main_light_ = component; }
+
+		std::vector<uint8_t> serialize() const;
+		void write(const std::string& path) const;
+
+	private:
+		std::vector<SceneFileEntity> entities_;
+		std::vector<SceneFileComponent> components_;
+		std::vector<SceneFileMesh> meshes_;
+		std::vector<uint32_t> references_;
+		std::vector<uint8_t> data_;
+		std::unordered_multimap<size_t, uint32_t> mesh_hashes_;
+
+		uint32_t main_camera_ = SCENE_FILE_NONE;
+		uint32_t main_light_ = SCENE_FILE_NONE;
+	};
+
+	// Writes the entities reachable from the scene's roots with their components. Meshes are
+	// read back from the GPU. Throws std::runtime_error on components the format does not
+	// cover and on textures the scene does not own.
+	void exportScene(GameScene& scene, const std::string& path);
+
+	// Creates the file's entities and components in the scene's pools, adds the roots to the
+	// scene and returns all entities in file order. Textures are looked up in the scene, which
+	// needs them added beforehand in the order of the export.
+	std::vector<GameEntity*> loadScene(GameScene& scene, const std::string& path);
+}
\ No newline at end of file
@@ -0,0 +1,165 @@
+#include "job_system.hpp"
+
+#include <chrono>
+
+namespace gel {
+	struct JobSystem::Job {
+		std::function<void()> fn;
+
+		// Unfinished dependencies, plus one held by schedule until they are all registered
+		std::atomic<int> pending{ 1 };
+
+		std::mutex mutex;
+		bool done = false;
+		std::vector<JobHandle> dependents;
+		std::exception_ptr error;   // written before done is set, rethrown by wait
+	};
+
+	namespace {
+		thread_local const JobSystem* current_system = nullptr;
+		thread_local size_t current_queue = 0;
+	}
+
+	JobSystem::JobSystem(size_t worker_count) {
+		for (size_t i = 0; i <= worker_count; ++i) queues_.push_back(std::make_unique<Queue>());
+		for (size_t i = 0; i < worker_count; ++i) workers_.emplace_back(&JobSystem::workerLoop, this, i + 1);
+	}
+
+	JobSystem::~JobSystem() {
+		{
+			std::lock_guard<std::mutex> lock(wake_mutex_);
+			stopping_ = true;
+		}
+		wake_.notify_all();
+		for (auto& worker : workers_) worker.join();
+	}
+
+	JobSystem::JobHandle JobSystem::schedule(std::function<void()> fn, std::initializer_list<JobHandle> dependencies) {
+		return schedule(std::move(fn), std::vector<JobHandle>(dependencies));
+	}
+
+	JobSystem::JobHandle JobSystem::schedule(std::function<void()> fn, const std::vector<JobHandle>& dependencies) {
+		auto job = std::make_shared<Job>();
+		job->fn = std::move(fn);
+
+		for (const auto& dependency : dependencies) {
+			if (!dependency) continue;
+			std::lock_guard<std::mutex> lock(dependency->mutex);
+			if (!dependency->done) {
+				job->pending.fetch_add(1);
+				dependency->dependents.push_back(job);
+			}
+		}
+
+		if (job->pending.fetch_sub(1) == 1) push(job);
+		return job;
+	}
+
+	bool JobSystem::isDone(const JobHandle& job) const {
+		std::lock_guard<std::mutex> lock(job->mutex);
+		return job->done;
+	}
+
+	void JobSystem::wait(const JobHandle& job) {
+		size_t queue = currentQueue();
+		while (!isDone(job)) {
+			if (!runOne(queue)) std::this_thread::yield();
+		}
+		if (job->error) std::rethrow_exception(job->error);
+	}
+
+	JobStats JobSystem::stats() const {
+		return JobStats{ jobs_run_.load(), steals_.load(), static_cast<double>(busy_ns_.load()) * 1e-6 };
+	}
+
+	void JobSystem::resetStats() {
+		jobs_run_ = 0;
+		steals_ = 0;
+		busy_ns_ = 0;
+	}
+
+	size_t JobSystem::currentQueue() const {
+		return current_system == this ? current_queue : 0;
+	}
+
+	void JobSystem::push(JobHandle job) {
+		Queue& queue = *queues_[currentQueue()];
+		{
+			std::lock_guard<std::mutex> lock(queue.mutex);
+			queue.jobs.push_back(std::move(job));
+		}
+		queued_.fetch_add(1);
+
+		// Taking the lock orders the push before a worker's check of queued_, so it cannot
+		// miss the notification
+		{ std::lock_guard<std::mutex> lock(wake_mutex_); }
+		wake_.notify_one();
+	}
+
+	bool JobSystem::runOne(size_t queue) {
+		JobHandle job;
+		{
+			Queue& own = *queues_[queue];
+			std::lock_guard<std::mutex> lock(own.mutex);
+			if (!own.jobs.empty()) {
+				job = std::move(own.jobs.back());
+				own.jobs.pop_back();
+			}
+		}
+
+		for (size_t i = 1; !job && i < queues_.size(); ++i) {
+			Queue& victim = *queues_[(queue + i) % queues_.size()];
+			std::lock_guard<std::mutex> lock(victim.mutex);
+			if (!victim.jobs.empty()) {
+				job = std::move(victim.jobs.front());
+				victim.jobs.pop_front();
+				steals_.fetch_add(1, std::memory_order_relaxed);
+			}
+		}
+
+		if (!job) return false;
+		queued_.fetch_sub(1);
+
+		auto start = std::chrono::steady_clock::now();
+		// A throwing job must still finish, or its waiters and dependents hang
+		try {
+			job->fn();
+		}
+		catch (...) {
+			job->error = std::current_exception();
+		}
+		auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+		busy_ns_.fetch_add(static_cast<uint64_t>(elapsed.count()), std::memory_order_relaxed);
+		jobs_run_.fetch_add(1, std::memory_order_relaxed);
+
+		finish(job);
+		return true;
+	}
+
+	void JobSystem::finish(const JobHandle& job) {
+		std::vector<JobHandle> ready;
+		{
+			std::lock_guard<std::mutex> lock(job->mutex);
+			job->done = true;
+			ready.swap(job->dependents);
+		}
+		job->fn = nullptr;
+
+		for (auto& dependent : ready) {
+			if (dependent->pending.fetch_sub(1) == 1) push(std::move(dependent));
+		}
+	}
+
+	void JobSystem::workerLoop(size_t queue) {
+		current_system = this;
+		current_queue = queue;
+
+		while (true) {
+			if (runOne(queue)) continue;
+
+			std::unique_lock<std::mutex> lock(wake_mutex_);
+			wake_.wait(lock, [this] { return stopping_ || queued_.load() > 0; });
+			if (stopping_) return;
+		}
+	}
+}
\ No newline at end of file
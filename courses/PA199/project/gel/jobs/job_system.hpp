@@ -0,0 +1,119 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace gel {
+	struct JobStats {
+		uint64_t jobs = 0;      // jobs run
+		uint64_t steals = 0;    // jobs taken from another thread's deque
+		double busy_ms = 0.0;   // time spent inside job bodies, summed over threads
+	};
+
+	// Work-stealing scheduler. Every worker owns a deque: it pushes and pops its own jobs at
+	// the back and steals from the front of the others when it runs dry. Threads that are
+	// not workers share one more deque. A job starts once all of its dependencies finished,
+	// and waiting on a job runs other jobs instead of blocking.
+	class JobSystem {
+	public:
+		struct Job;
+		using JobHandle = std::shared_ptr<Job>;
+
+		// Leaves one hardware thread for the caller, which helps while it waits
+		explicit JobSystem(size_t worker_count = std::max(1u, std::thread::hardware_concurrency()) - 1);
+		~JobSystem();
+
+		JobSystem(const JobSystem&) = delete;
+		JobSystem& operator=(const JobSystem&) = delete;
+
+		JobHandle schedule(std::function<void()> fn, std::initializer_list<JobHandle> dependencies = {});
+		JobHandle schedule(std::function<void()> fn, const std::vector<JobHandle>& dependencies);
+
+		bool isDone(const JobHandle& job) const;
+
+		// Rethrows an exception the job threw. Its dependents start all the same.
+		void wait(const JobHandle& job);
+
+		// Calls fn(begin, end) over [0, count) in ranges of at most grain elements and returns
+		// when all are done. One job per thread pulls ranges from a shared counter, so uneven
+		// ranges balance out without a job per range. A grain of 0 picks one. When fn throws,
+		// no new ranges start, the running ones are waited for and the first exception is
+		// rethrown on the calling thread.
+		template<typename F>
+		void parallelFor(size_t count, size_t grain, F&& fn) {
+			if (count == 0) return;
+			if (grain == 0) grain = std::max<size_t>(1, count / (threadCount() * 4));
+
+			size_t ranges = (count + grain - 1) / grain;
+			if (ranges == 1 || workers_.empty()) {
+				for (size_t begin = 0; begin < count; begin += grain) fn(begin, std::min(count, begin + grain));
+				return;
+			}
+
+			std::atomic<size_t> next{ 0 };
+			std::mutex error_mutex;
+			std::exception_ptr error;
+			auto body = [&] {
+				for (size_t r = next.fetch_add(1); r < ranges; r = next.fetch_add(1)) {
+					try {
+						fn(r * grain, std::min(count, (r + 1) * grain));
+					}
+					catch (...) {
+						std::lock_guard<std::mutex> lock(error_mutex);
+						if (!error) error = std::current_exception();
+						next = ranges;
+					}
+				}
+			};
+
+			std::vector<JobHandle> jobs;
+			size_t helpers = std::min(ranges, threadCount()) - 1;
+			for (size_t i = 0; i < helpers; ++i) jobs.push_back(schedule(body));
+			body();
+			for (auto& job : jobs) wait(job);
+			if (error) std::rethrow_exception(error);
+		}
+
+		// Workers plus the calling thread
+		size_t threadCount() const { return workers_.size() + 1; }
+
+		JobStats stats() const;
+		void resetStats();
+
+	private:
+		struct Queue {
+			std::mutex mutex;
+			std::deque<JobHandle> jobs;
+		};
+
+		// Queue 0 is shared by threads that are not workers, worker i owns queue i + 1
+		std::vector<std::unique_ptr<Queue>> queues_;
+		std::vector<std::thread> workers_;
+
+		std::atomic<size_t> queued_{ 0 };
+		std::atomic<bool> stopping_{ false };
+		std::mutex wake_mutex_;
+		std::condition_variable wake_;
+
+		std::atomic<uint64_t> jobs_run_{ 0 };
+		std::atomic<uint64_t> steals_{ 0 };
+		std::atomic<uint64_t> busy_ns_{ 0 };
+
+		size_t currentQueue() const;
+		void push(JobHandle job);
+		bool runOne(size_t queue);
+		void finish(const JobHandle& job);
+		void workerLoop(size_t queue);
+	};
+}
\ No newline at end of file
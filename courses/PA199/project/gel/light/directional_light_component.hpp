@@ -5,6 +5,8 @@
 
 namespace gel {
 	class DirectionalLightComponent : public LightComponent {
+		GEL_COMPONENT(DirectionalLightComponent, LightComponent)
+
 	public:
 		DirectionalLightComponent(
 			gem::Vector<float, 3> ambient,
@@ -5,6 +5,8 @@
 
 namespace gel {
 	class LightComponent : public GameComponent {
+		GEL_COMPONENT(LightComponent, GameComponent)
+
 	public:
 		LightComponent(
 			gem::Vector<float, 3> ambient, 
@@ -16,6 +18,7 @@ namespace gel {
 		}
 
 		void update(float delta_time) override {}
+		uint8_t getAccess() const override { return ACCESS_NONE; }
 
 		void render() override {}
 
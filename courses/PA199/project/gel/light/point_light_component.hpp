@@ -7,6 +7,8 @@
 
 namespace gel {
 	class PointLightComponent : public LightComponent {
+		GEL_COMPONENT(PointLightComponent, LightComponent)
+
 	public:
 		PointLightComponent(
 			gem::Vector<float, 3> ambient,
@@ -0,0 +1 @@
+#include "object_pool.hpp"
\ No newline at end of file
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace gel {
+	struct PoolStats {
+		size_t live = 0;          // objects currently constructed
+		size_t capacity = 0;      // slots in all chunks
+		size_t chunks = 0;        // chunks currently held
+		size_t bytes = 0;         // bytes held in chunks
+		size_t allocations = 0;   // chunk allocations over the pool's lifetime
+
+		PoolStats& operator+=(const PoolStats& other) {
+			live += other.live;
+			capacity += other.capacity;
+			chunks += other.chunks;
+			bytes += other.bytes;
+			allocations += other.allocations;
+			return *this;
+		}
+	};
+
+	namespace detail {
+		class ObjectPoolBase {
+		public:
+			virtual ~ObjectPoolBase() = default;
+
+			// Takes the most derived address of an object made by this pool
+			virtual void destroy(void* object) = 0;
+			virtual PoolStats stats() const = 0;
+		};
+	}
+
+	// Fixed-size slots carved out of chunks of CHUNK_SIZE objects. Freed slots go to a free
+	// list and are reused before a new chunk is requested, so a steady spawn and despawn
+	// rate never reaches the global allocator. Objects never move. Destroying the pool runs
+	// the destructors of the live objects and frees one block per chunk.
+	template<typename T, size_t CHUNK_SIZE = 256>
+	class ObjectPool final : public detail::ObjectPoolBase {
+	public:
+		ObjectPool() = default;
+		ObjectPool(const ObjectPool&) = delete;
+		ObjectPool& operator=(const ObjectPool&) = delete;
+
+		~ObjectPool() override {
+			if constexpr (!std::is_trivially_destructible_v<T>) {
+				for (auto& chunk : chunks_) {
+					for (Slot& slot : chunk->slots) {
+						if (slot.live) std::destroy_at(slot.object());
+					}
+				}
+			}
+		}
+
+		template<typename... Args>
+		T* create(Args&&... args) {
+			if (!free_) grow();
+
+			Slot* slot = free_;
+			T* object = std::construct_at(reinterpret_cast<T*>(slot->storage), std::forward<Args>(args)...);
+			free_ = slot->next;
+			slot->live = true;
+			++live_;
+			return object;
+		}
+
+		void destroy(T* object) {
+			Slot* slot = reinterpret_cast<Slot*>(object);
+			if (!slot->live) throw std::runtime_error("Object was already destroyed.");
+
+			std::destroy_at(object);
+			slot->live = false;
+			slot->next = free_;
+			free_ = slot;
+			--live_;
+		}
+
+		void destroy(void* object) override {
+			destroy(static_cast<T*>(object));
+		}
+
+		PoolStats stats() const override {
+			return PoolStats{ live_, chunks_.size() * CHUNK_SIZE, chunks_.size(), chunks_.size() * sizeof(Chunk), allocations_ };
+		}
+
+	private:
+		struct Slot {
+			alignas(T) std::byte storage[sizeof(T)];
+			Slot* next;
+			bool live;
+
+			T* object() { return std::launder(reinterpret_cast<T*>(storage)); }
+		};
+
+		struct Chunk {
+			Slot slots[CHUNK_SIZE];
+		};
+
+		std::vector<std::unique_ptr<Chunk>> chunks_;
+		Slot* free_ = nullptr;
+		size_t live_ = 0;
+		size_t allocations_ = 0;
+
+		void grow() {
+			chunks_.push_back(std::unique_ptr<Chunk>(new Chunk));
+			++allocations_;
+
+			// Threaded back to front so slots are handed out in address order
+			for (size_t i = CHUNK_SIZE; i-- > 0;) {
+				Slot& slot = chunks_.back()->slots[i];
+				slot.live = false;
+				slot.next = free_;
+				free_ = &slot;
+			}
+		}
+	};
+}
\ No newline at end of file
@@ -13,6 +13,8 @@ namespace gel {
 	class ArcRendererComponent; // Forward declaration
 
 	class AdhocBrickBroadphaseCollisionComponent : public GameComponent {
+		GEL_COMPONENT(AdhocBrickBroadphaseCollisionComponent, GameComponent)
+
 	public:
 		AdhocBrickBroadphaseCollisionComponent(
 			GameEntity* ballEntity,
@@ -35,8 +37,14 @@ namespace gel {
 			// No rendering needed for this component
 		}
 
+		GameEntity* getBallEntity() const { return ballEntity; }
+		const std::vector<ArcRendererComponent*>& getArcRenderers() const { return arcMeshes; }
+		int getTowerBase() const { return towerBase; }
+		int getTowerStack() const { return towerStack; }
+		float getTowerBaseY() const { return towerBaseY; }
+
 		float getPaddleYaw(const gem::Quaternion<float>& q) {
-			return std::atan2(2.0f * (q.w() * q.y() + q.x() * q.z()),
+			return gem::trig::atan2(2.0f * (q.w() * q.y() + q.x() * q.z()),
 				1.0f - 2.0f * (q.y() * q.y() + q.z() * q.z()));
 		}
 
@@ -124,9 +132,9 @@ namespace gel {
 			}
 
 			gem::Vector<float, 3> normal = gem::Vector<float, 3>{
-				std::cos(polar.theta()),
+				gem::trig::cos(polar.theta()),
 				0.0f,
-				std::sin(polar.theta())
+				gem::trig::sin(polar.theta())
 			}.normalize();
 
 			float overlapOut = (polar.r() + ballRadius) - brickOuterRadius;
@@ -13,6 +13,8 @@ namespace gel {
 	class ArcRendererComponent; // Forward declaration
 
 	class AdhocPaddleBroadphaseCollisionComponent : public GameComponent {
+		GEL_COMPONENT(AdhocPaddleBroadphaseCollisionComponent, GameComponent)
+
 	public:
 		AdhocPaddleBroadphaseCollisionComponent(
 			GameEntity* ballEntity,
@@ -30,7 +32,7 @@ namespace gel {
 		}
 
 		float getPaddleYaw(const gem::Quaternion<float>& q) {
-			return std::atan2(2.0f * (q.w() * q.y() + q.x() * q.z()),
+			return gem::trig::atan2(2.0f * (q.w() * q.y() + q.x() * q.z()),
 				1.0f - 2.0f * (q.y() * q.y() + q.z() * q.z()));
 		}
 
@@ -67,6 +69,10 @@ namespace gel {
 
 		void render() override {}
 
+		GameEntity* getBallEntity() const { return ballEntity; }
+		GameEntity* getPaddleEntityA() const { return paddleEntityA; }
+		GameEntity* getPaddleEntityB() const { return paddleEntityB; }
+
 		bool checkCollision(
 			const gem::Vector<float, 3>& ballPosition, float ballRadius,
 			const gem::Vector<float, 3>& paddlePosition, float paddleRotation,
@@ -106,9 +112,9 @@ namespace gel {
 			//}
 
 			gem::Vector<float, 3> normal = gem::Vector<float, 3>{
-				std::cos(polar.theta()),
+				gem::trig::cos(polar.theta()),
 				0.0f,
-				std::sin(polar.theta())
+				gem::trig::sin(polar.theta())
 			}.normalize();
 
 			gem::Vector<float, 3> v = ballRigidbody->velocity();
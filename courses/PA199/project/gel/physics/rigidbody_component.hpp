@@ -7,7 +7,10 @@
 namespace gel {
 	class GameEntity; // Forward declaration
 
-	class RigidbodyComponent : public GameComponent {
+	// Final so the update loop over a registry pool calls update directly
+	class RigidbodyComponent final : public GameComponent {
+		GEL_COMPONENT(RigidbodyComponent, GameComponent)
+
 	public:
 		RigidbodyComponent(float mass = 1.0f) :
 			mass_(mass),
@@ -16,28 +19,29 @@ namespace gel {
 		}
 
 		void applyForce(const gem::Vector<float, 3>& force) {
-			accumulatedForce_ = accumulatedForce_ + force;
+			accumulatedForce_ += force;
 		}
 
 		void applyImpulse(const gem::Vector<float, 3>& impulse) {
-			velocity_ = velocity_ + impulse / mass_;
+			velocity_ += impulse / mass_;
 		}
 
 		void update(float delta_time) override {
 			if (mass_ <= 0.0f) return;
 
-			gem::Vector<float, 3> acceleration = accumulatedForce_ / mass_;
-			velocity_ = velocity_ + acceleration * delta_time;
+			velocity_ += accumulatedForce_ / mass_ * delta_time;
 
 			if (auto entity = getEntity()) {
 				gem::Vector<float, 3> pos = getEntity()->getPosition();
-				pos = pos + velocity_ * delta_time;
+				pos += velocity_ * delta_time;
 				getEntity()->setPosition(pos);
 			}
 
 			accumulatedForce_ = { 0.0f, 0.0f, 0.0f };
 		}
 
+		uint8_t getAccess() const override { return ACCESS_OWN_READ | ACCESS_OWN_WRITE; }
+
 		void render() override {}
 
 		float mass() const {
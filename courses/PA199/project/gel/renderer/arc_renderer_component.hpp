@@ -120,16 +120,19 @@ namespace gel {
 	}
 
 	class ArcRendererComponent : public MeshRendererComponent {
+		GEL_COMPONENT(ArcRendererComponent, MeshRendererComponent)
+
 	public:
 		ArcRendererComponent(
 			float inner_radius, float outer_radius, int segments,
 			float height = 1.0f, float angle = 2.0f * M_PI,
 			GLuint texture = 0,
-			int strength = 3
+			int strength = 3,
+			VertexLayout layout = VertexLayout::Full
 		) : MeshRendererComponent(
 			GenerateArcVertices(inner_radius, outer_radius, segments, height, angle),
 			GenerateArcIndices(segments, angle >= 2.0f * M_PI),
-			texture, strength
+			texture, strength, layout
 		), 
 			inner_radius_(inner_radius), 
 			outer_radius_(outer_radius), 
@@ -138,6 +141,21 @@ namespace gel {
 			angle_(angle)
 		{}
 
+		// Baked geometry of an arc with these parameters
+		ArcRendererComponent(
+			const MeshView& mesh,
+			float inner_radius, float outer_radius, int segments,
+			float height, float angle,
+			GLuint texture = 0,
+			int strength = 3
+		) : MeshRendererComponent(mesh, texture, strength),
+			inner_radius_(inner_radius),
+			outer_radius_(outer_radius),
+			segments_(segments),
+			height_(height),
+			angle_(angle)
+		{}
+
 		float innerRadius() const { return inner_radius_; }
 		float outerRadius() const { return outer_radius_; }
 		int segments() const { return segments_; }
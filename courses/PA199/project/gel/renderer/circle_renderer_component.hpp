@@ -44,6 +44,8 @@ namespace gel {
 	}
 
 	class CircleRendererComponent : public MeshRendererComponent {
+		GEL_COMPONENT(CircleRendererComponent, MeshRendererComponent)
+
 	public:
 		CircleRendererComponent(float radius = 1.0f, int segments = 32, GLuint texture = 0) :
 			MeshRendererComponent(
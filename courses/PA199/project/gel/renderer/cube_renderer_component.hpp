@@ -61,6 +61,8 @@ namespace gel {
     }
 
 	class CubeRendererComponent : public MeshRendererComponent {
+		GEL_COMPONENT(CubeRendererComponent, MeshRendererComponent)
+
 	public:
 		CubeRendererComponent(GLuint texture = 0) : MeshRendererComponent(
 			GenerateCubeVertices(),
@@ -81,6 +81,8 @@ namespace gel {
 	}
 
 	class CylinderRendererComponent : public MeshRendererComponent {
+		GEL_COMPONENT(CylinderRendererComponent, MeshRendererComponent)
+
 	public:
 		CylinderRendererComponent(
 			float radius = 1.0f,
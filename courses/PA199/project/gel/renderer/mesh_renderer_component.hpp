@@ -10,6 +10,7 @@
 #include <vector>
 #include <glad/glad.h>
 #include <cassert>
+#include <cstdint>
 #include <cstdlib>
 #include <ctime>
 
@@ -24,6 +25,33 @@ namespace gel {
 	};
 	#pragma pack(pop)
 
+	// 16-byte variant of MeshRendererVAO, half the bandwidth and memory:
+	// half-float position (w = 1), octahedral normal in snorm16 and unorm16 UVs.
+	// Positions keep 11 significant bits, UVs are clamped to [0, 1].
+	#pragma pack(push, 1)
+	struct PackedMeshRendererVAO {
+		uint16_t x, y, z, w;
+		int16_t nx, ny;
+		uint16_t u, v;
+	};
+	#pragma pack(pop)
+
+	static_assert(sizeof(PackedMeshRendererVAO) == 16, "gel: PackedMeshRendererVAO must be 16 bytes.");
+
+	enum class VertexLayout {
+		Full,	// MeshRendererVAO, 32 bytes
+		Packed	// PackedMeshRendererVAO, 16 bytes, normals decoded in the vertex shader
+	};
+
+	inline PackedMeshRendererVAO PackVertex(const MeshRendererVAO& vertex) {
+		gem::Vector<float, 2> normal = gem::octEncode(gem::Vector<float, 3>{ vertex.nx, vertex.ny, vertex.nz });
+		return PackedMeshRendererVAO{
+			gem::packHalf(vertex.x), gem::packHalf(vertex.y), gem::packHalf(vertex.z), gem::packHalf(1.0f),
+			gem::packSnorm16(normal[0]), gem::packSnorm16(normal[1]),
+			gem::packUnorm16(vertex.u), gem::packUnorm16(vertex.v)
+		};
+	}
+
 	const std::vector<gem::Vector<float, 3>> COLOR_ = {
 		{1.0f, 0.0f, 0.0f},  // Red
 		{0.0f, 1.0f, 0.0f},  // Green
@@ -34,27 +62,45 @@ namespace gel {
 		{1.0f, 0.5f, 0.0f}   // Orange
 	};
 
+	inline size_t vertexSize(VertexLayout layout) {
+		return layout == VertexLayout::Packed ? sizeof(PackedMeshRendererVAO) : sizeof(MeshRendererVAO);
+	}
+
+	// Vertices already in their GPU layout and the indices, borrowed. A mesh built from a view
+	// uploads the memory as it is and does not keep it.
+	struct MeshView {
+		const void* vertices = nullptr;
+		size_t vertex_count = 0;
+		const unsigned int* indices = nullptr;
+		size_t index_count = 0;
+		VertexLayout layout = VertexLayout::Full;
+	};
+
 	class MeshRendererComponent : public RendererComponent {
+		GEL_COMPONENT(MeshRendererComponent, RendererComponent)
+
 	public:
 		MeshRendererComponent(
 			const std::vector<MeshRendererVAO>& vertices, 
 			const std::vector<unsigned int>& indices,
 			GLuint texture = 0,
-			int mesh_strength = 1
+			int mesh_strength = 1,
+			VertexLayout layout = VertexLayout::Full
 			)
-		: vertices_(vertices), indices_(indices), texture_(texture),
+		: index_count_(indices.size()), vertex_count_(vertices.size()), layout_(layout), texture_(texture),
 			mesh_initial_strength_(mesh_strength), mesh_current_strength_(mesh_strength)
 		{
-			static bool seeded = false;
-			if (!seeded) {
-				std::srand(static_cast<unsigned int>(std::time(nullptr)));
-				seeded = true;
-			}
-
-			int color_index = std::rand() % COLOR_.size();
-			color_ = COLOR_[color_index];
+			pickColor();
+			setup(vertices, indices);
+		}
 
-			setup();
+		// Baked geometry, for example straight from a mapped scene file
+		MeshRendererComponent(const MeshView& mesh, GLuint texture = 0, int mesh_strength = 1)
+		: index_count_(mesh.index_count), vertex_count_(mesh.vertex_count), layout_(mesh.layout), texture_(texture),
+			mesh_initial_strength_(mesh_strength), mesh_current_strength_(mesh_strength)
+		{
+			pickColor();
+			upload(mesh);
 		}
 
 		~MeshRendererComponent() override {
@@ -64,10 +110,11 @@ namespace gel {
 		}
 
 		void update(float delta_time) override {}
+		uint8_t getAccess() const override { return ACCESS_NONE; }
 
 		void render() override {
 			glBindVertexArray(vao_);
-			glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(indices_.size()), GL_UNSIGNED_INT, 0);
+			glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(index_count_), GL_UNSIGNED_INT, 0);
 			glBindVertexArray(0);
 		}
 
@@ -79,6 +126,31 @@ namespace gel {
 			return texture_;
 		}
 
+		VertexLayout getVertexLayout() const {
+			return layout_;
+		}
+
+		size_t getVertexCount() const {
+			return vertex_count_;
+		}
+
+		size_t getIndexCount() const {
+			return index_count_;
+		}
+
+		// Copies the buffers back from the GPU, vertices in the mesh's own layout
+		void readMesh(std::vector<uint8_t>& vertices, std::vector<unsigned int>& indices) const {
+			vertices.resize(vertex_count_ * vertexSize(layout_));
+			indices.resize(index_count_);
+
+			glBindBuffer(GL_COPY_READ_BUFFER, vbo_);
+			glGetBufferSubData(GL_COPY_READ_BUFFER, 0, vertices.size(), vertices.data());
+			glBindBuffer(GL_COPY_READ_BUFFER, ebo_);
+			glGetBufferSubData(GL_COPY_READ_BUFFER, 0, indices.size() * sizeof(unsigned int), indices.data());
+			glBindBuffer(GL_COPY_READ_BUFFER, 0);
+			assert(glGetError() == 0U);
+		}
+
 		int mesh_initial_strength_;
 		int mesh_current_strength_;
 
@@ -87,8 +159,10 @@ namespace gel {
 		}
 
 	private:
-		std::vector<MeshRendererVAO> vertices_;
-		std::vector<unsigned int> indices_;
+		// The geometry only lives on the GPU, the CPU keeps what drawing needs
+		size_t index_count_;
+		size_t vertex_count_;
+		VertexLayout layout_;
 		gem::Vector<float, 3> color_;
 
 		GLuint vao_ = 0;
@@ -96,7 +170,31 @@ namespace gel {
 		GLuint ebo_ = 0;
 		GLuint texture_ = 0;
 
-		void setup() {
+		void pickColor() {
+			static bool seeded = false;
+			if (!seeded) {
+				std::srand(static_cast<unsigned int>(std::time(nullptr)));
+				seeded = true;
+			}
+
+			int color_index = std::rand() % COLOR_.size();
+			color_ = COLOR_[color_index];
+		}
+
+		void setup(const std::vector<MeshRendererVAO>& vertices, const std::vector<unsigned int>& indices) {
+			MeshView mesh{ vertices.data(), vertices.size(), indices.data(), indices.size(), layout_ };
+
+			std::vector<PackedMeshRendererVAO> packed;
+			if (layout_ == VertexLayout::Packed) {
+				packed.reserve(vertices.size());
+				for (const auto& vertex : vertices) packed.push_back(PackVertex(vertex));
+				mesh.vertices = packed.data();
+			}
+
+			upload(mesh);
+		}
+
+		void upload(const MeshView& mesh) {
 			// VAO Generate
 			glGenVertexArrays(1, &vao_);
 			glBindVertexArray(vao_);
@@ -106,9 +204,24 @@ namespace gel {
 			assert(glGetError() == 0U);
 			glBindBuffer(GL_ARRAY_BUFFER, vbo_);
 			assert(glGetError() == 0U);
-			glBufferData(GL_ARRAY_BUFFER, vertices_.size() * sizeof(MeshRendererVAO), vertices_.data(), GL_STATIC_DRAW);
+			glBufferData(GL_ARRAY_BUFFER, mesh.vertex_count * vertexSize(mesh.layout), mesh.vertices, GL_STATIC_DRAW);
+			assert(glGetError() == 0U);
+
+			if (mesh.layout == VertexLayout::Packed) setupPackedAttributes();
+			else setupFullAttributes();
+
+			// EBO Generate
+			glGenBuffers(1, &ebo_);
+			assert(glGetError() == 0U);
+			glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo_);
+			assert(glGetError() == 0U);
+			glBufferData(GL_ELEMENT_ARRAY_BUFFER, mesh.index_count * sizeof(unsigned int), mesh.indices, GL_STATIC_DRAW);
 			assert(glGetError() == 0U);
 
+			glBindVertexArray(0);
+		}
+
+		void setupFullAttributes() {
 			// VAO (Position)
 			glEnableVertexAttribArray(0);
 			assert(glGetError() == 0U);
@@ -126,16 +239,26 @@ namespace gel {
 			assert(glGetError() == 0U);
 			glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(MeshRendererVAO), (void*)offsetof(MeshRendererVAO, u));
 			assert(glGetError() == 0U);
+		}
 
-			// EBO Generate
-			glGenBuffers(1, &ebo_);
+		void setupPackedAttributes() {
+			// VAO (Position), the shader reads xyz of the half4
+			glEnableVertexAttribArray(0);
 			assert(glGetError() == 0U);
-			glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo_);
+			glVertexAttribPointer(0, 4, GL_HALF_FLOAT, GL_FALSE, sizeof(PackedMeshRendererVAO), (void*)offsetof(PackedMeshRendererVAO, x));
 			assert(glGetError() == 0U);
-			glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices_.size() * sizeof(unsigned int), indices_.data(), GL_STATIC_DRAW);
+
+			// VAO (Normal), two normalized shorts the shader unfolds with packed_normals set
+			glEnableVertexAttribArray(1);
+			assert(glGetError() == 0U);
+			glVertexAttribPointer(1, 2, GL_SHORT, GL_TRUE, sizeof(PackedMeshRendererVAO), (void*)offsetof(PackedMeshRendererVAO, nx));
 			assert(glGetError() == 0U);
 
-			glBindVertexArray(0);
+			// VAO (UV)
+			glEnableVertexAttribArray(2);
+			assert(glGetError() == 0U);
+			glVertexAttribPointer(2, 2, GL_UNSIGNED_SHORT, GL_TRUE, sizeof(PackedMeshRendererVAO), (void*)offsetof(PackedMeshRendererVAO, u));
+			assert(glGetError() == 0U);
 		}
 	};
 }
\ No newline at end of file
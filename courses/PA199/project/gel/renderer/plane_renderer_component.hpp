@@ -49,6 +49,8 @@ namespace gel {
 	}
 
 	class PlaneRendererComponent : public MeshRendererComponent {
+		GEL_COMPONENT(PlaneRendererComponent, MeshRendererComponent)
+
 	public:
 		PlaneRendererComponent(
 			float size = 1.0f, int divisions = 1, GLuint texture = 0) : MeshRendererComponent(
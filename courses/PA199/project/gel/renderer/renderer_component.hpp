@@ -6,5 +6,6 @@
 
 namespace gel {
 	class RendererComponent : public GameComponent {
+		GEL_COMPONENT(RendererComponent, GameComponent)
 	};
 }
\ No newline at end of file
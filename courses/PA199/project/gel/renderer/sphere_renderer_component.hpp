@@ -73,6 +73,8 @@ namespace gel {
 	}
 
 	class SphereRendererComponent : public MeshRendererComponent {
+		GEL_COMPONENT(SphereRendererComponent, MeshRendererComponent)
+
 	public:
 		SphereRendererComponent(
 			float radius = 1.0f, 
@@ -86,6 +88,17 @@ namespace gel {
 			sector_(sector),
 			stack_(stack) {}
 
+		// Baked geometry of a sphere with these parameters
+		SphereRendererComponent(
+			const MeshView& mesh,
+			float radius,
+			unsigned int sector,
+			unsigned int stack,
+			GLuint texture = 0) : MeshRendererComponent(mesh, texture),
+			radius_(radius),
+			sector_(sector),
+			stack_(stack) {}
+
 		float radius() const {
 			return radius_;
 		}
@@ -0,0 +1 @@
+#include "spline_renderer_component.hpp"
\ No newline at end of file
@@ -0,0 +1,104 @@
+#pragma once
+
+#include "mesh_renderer_component.hpp"
+#include <cmath>
+#include <vector>
+
+namespace gel {
+
+	// Tube of `radius` around the spline. Points and tangents come from forward differencing,
+	// the ring orientation is carried along by parallel transport so the tube does not twist.
+	inline std::vector<MeshRendererVAO> GenerateSplineVertices(
+		const gem::CubicSpline<float, 3>& spline, int steps_per_segment,
+		float radius = 0.05f, int sides = 8
+	) {
+		std::vector<gem::Vector<float, 3>> points, tangents;
+		spline.tessellate(steps_per_segment, points);
+		spline.tessellateDerivatives(steps_per_segment, tangents);
+
+		std::vector<MeshRendererVAO> vao;
+		vao.reserve(points.size() * (sides + 1));
+
+		gem::Vector<float, 3> tangent{ 1.0f, 0.0f, 0.0f };
+		gem::Vector<float, 3> normal{ 0.0f, 1.0f, 0.0f };
+
+		for (size_t i = 0; i < points.size(); ++i) {
+			if (tangents[i].magnitude() > 1e-6f) {
+				tangent = tangents[i].normalize();
+			}
+
+			if (i == 0) {
+				// Any direction perpendicular to the first tangent
+				gem::Vector<float, 3> axis = std::fabs(tangent[1]) < 0.9f ? gem::Vector<float, 3>{ 0.0f, 1.0f, 0.0f } : gem::Vector<float, 3>{ 1.0f, 0.0f, 0.0f };
+				normal = tangent.cross(axis).cross(tangent).normalize();
+			}
+			else {
+				normal = gem::Vector<float, 3>(normal - tangent * normal.dot(tangent)).normalize();
+			}
+			gem::Vector<float, 3> binormal = tangent.cross(normal);
+
+			float u = (float)i / (points.size() - 1);
+
+			for (int j = 0; j <= sides; ++j) {
+				float theta = 2.0f * M_PI * j / sides;
+				gem::Vector<float, 3> n = normal * cosf(theta) + binormal * sinf(theta);
+				gem::Vector<float, 3> p = points[i] + n * radius;
+
+				vao.push_back(MeshRendererVAO{ p[0], p[1], p[2], n[0], n[1], n[2], u, (float)j / sides });
+			}
+		}
+
+		return vao;
+	}
+
+	inline std::vector<unsigned int> GenerateSplineIndices(int rings, int sides) {
+		std::vector<unsigned int> indices;
+
+		const int stride = sides + 1;
+
+		for (int i = 0; i + 1 < rings; ++i) {
+			for (int j = 0; j < sides; ++j) {
+				int a = i * stride + j;
+				int b = a + stride;
+
+				indices.push_back(a);
+				indices.push_back(a + 1);
+				indices.push_back(b);
+
+				indices.push_back(a + 1);
+				indices.push_back(b + 1);
+				indices.push_back(b);
+			}
+		}
+
+		return indices;
+	}
+
+	// Path preview, e.g. of a camera fly-through or the predicted ball path
+	class SplineRendererComponent : public MeshRendererComponent {
+		GEL_COMPONENT(SplineRendererComponent, MeshRendererComponent)
+
+	public:
+		SplineRendererComponent(
+			const gem::CubicSpline<float, 3>& spline, int steps_per_segment = 16,
+			float radius = 0.05f, int sides = 8,
+			GLuint texture = 0
+		) : MeshRendererComponent(
+			GenerateSplineVertices(spline, steps_per_segment, radius, sides),
+			GenerateSplineIndices(static_cast<int>(spline.segmentCount()) * steps_per_segment + 1, sides),
+			texture
+		),
+			steps_per_segment_(steps_per_segment),
+			radius_(radius),
+			sides_(sides)
+		{}
+
+		int stepsPerSegment() const { return steps_per_segment_; }
+		float radius() const { return radius_; }
+		int sides() const { return sides_; }
+	private:
+		int steps_per_segment_;
+		float radius_;
+		int sides_;
+	};
+}
\ No newline at end of file
@@ -4,6 +4,8 @@
 
 namespace gel {
 	class TestComponent : public GameComponent {
+		GEL_COMPONENT(TestComponent, GameComponent)
+
 	public:
 		TestComponent() = default;
 
@@ -0,0 +1,3 @@
+#include "animation.hpp"
+
+namespace gem {}
\ No newline at end of file
@@ -0,0 +1,294 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include "math.hpp"
+#include "fast_math.hpp"
+#include "vector.hpp"
+#include "quaternion.hpp"
+#include "interpolation.hpp"
+#include "simd.hpp"
+#include "vector_array.hpp"
+
+// std::array<__m128, N> drops the vector type's may_alias attribute, which is harmless here
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wignored-attributes"
+#endif
+
+namespace gem {
+	// TRACK CURSOR
+	// -------------------------------
+	// Remembers the key a track was last sampled at. Playback time only moves forward between
+	// frames, so the next sample is found by stepping from there instead of searching all keys.
+
+	struct TrackCursor {
+		size_t key = 0;
+	};
+
+	// Keys `from` and `to` surround the sample time, `t` is how far it lies between them
+	template<typename T>
+	struct TrackSegment {
+		size_t from;
+		size_t to;
+		T t;
+	};
+
+	namespace detail {
+		template<typename T>
+		void requireIncreasing(const std::vector<T>& times, T time) {
+			if (!times.empty() && time <= times.back()) {
+				throw std::runtime_error("Keyframe times must be strictly increasing");
+			}
+		}
+
+		// Times before the first key hold the first value and times after the last key hold
+		// the last value. A time earlier than the cursor (a loop or a seek) falls back to a
+		// binary search, every other sample steps forward from the cursor.
+		template<typename T>
+		TrackSegment<T> locate(const std::vector<T>& times, T time, TrackCursor& cursor) {
+			if (times.empty()) {
+				throw std::runtime_error("Cannot sample a track without keys");
+			}
+
+			size_t last = times.size() - 1;
+			if (last == 0 || time <= times[0]) {
+				cursor.key = 0;
+				return { 0, 0, 0 };
+			}
+			if (time >= times[last]) {
+				cursor.key = last - 1;
+				return { last, last, 0 };
+			}
+
+			size_t key = cursor.key;
+			if (key >= last || time < times[key]) {
+				key = static_cast<size_t>(std::upper_bound(times.begin(), times.end(), time) - times.begin()) - 1;
+			}
+			while (times[key + 1] <= time) ++key;
+
+			cursor.key = key;
+			return { key, key + 1, (time - times[key]) / (times[key + 1] - times[key]) };
+		}
+	}
+
+	// KEYFRAME TRACKS
+	// -------------------------------
+
+	// Vector-valued curve (a position or a scale), linearly interpolated between keys
+	template<typename T, size_t N>
+	class Track {
+	public:
+		void addKey(T time, const Vector<T, N>& value) {
+			detail::requireIncreasing(times_, time);
+			times_.push_back(time);
+			values_.push_back(value);
+		}
+
+		size_t size() const { return times_.size(); }
+		bool empty() const { return times_.empty(); }
+
+		T time(size_t key) const { return times_[key]; }
+		const Vector<T, N>& value(size_t key) const { return values_[key]; }
+
+		// Time of the last key, the track holds its last value afterwards
+		T duration() const { return times_.empty() ? 0 : times_.back(); }
+
+		TrackSegment<T> locate(T time, TrackCursor& cursor) const {
+			return detail::locate(times_, time, cursor);
+		}
+
+		Vector<T, N> sample(T time, TrackCursor& cursor) const {
+			TrackSegment<T> segment = locate(time, cursor);
+			return lerp(values_[segment.from], values_[segment.to], segment.t);
+		}
+
+	private:
+		std::vector<T> times_;
+		std::vector<Vector<T, N>> values_;
+	};
+
+	enum class RotationInterpolation {
+		Nlerp, // normalized lerp, cheaper and close to slerp for keys less than ~90 degrees apart
+		Slerp  // constant angular velocity between keys
+	};
+
+	// Quaternion curve. Every key is stored in the hemisphere of the previous one, so
+	// neighbouring keys always blend along the shorter arc.
+	template<typename T>
+	class RotationTrack {
+	public:
+		void addKey(T time, Quaternion<T> value) {
+			detail::requireIncreasing(times_, time);
+			if (!values_.empty() && values_.back().dot(value) < 0) {
+				value = -value;
+			}
+			times_.push_back(time);
+			values_.push_back(value);
+		}
+
+		size_t size() const { return times_.size(); }
+		bool empty() const { return times_.empty(); }
+
+		T time(size_t key) const { return times_[key]; }
+		const Quaternion<T>& value(size_t key) const { return values_[key]; }
+
+		// Time of the last key, the track holds its last value afterwards
+		T duration() const { return times_.empty() ? 0 : times_.back(); }
+
+		TrackSegment<T> locate(T time, TrackCursor& cursor) const {
+			return detail::locate(times_, time, cursor);
+		}
+
+		Quaternion<T> sample(T time, TrackCursor& cursor, RotationInterpolation interpolation = RotationInterpolation::Nlerp) const {
+			TrackSegment<T> segment = locate(time, cursor);
+			if (interpolation == RotationInterpolation::Slerp) {
+				return slerp(values_[segment.from], values_[segment.to], segment.t);
+			}
+			return lerp(values_[segment.from], values_[segment.to], segment.t);
+		}
+
+	private:
+		std::vector<T> times_;
+		std::vector<Quaternion<T>> values_;
+	};
+
+	// Position, rotation and scale curves of one animated transform. Empty tracks leave
+	// that part of the transform alone.
+	template<typename T>
+	struct AnimationClip {
+		Track<T, 3> position;
+		RotationTrack<T> rotation;
+		Track<T, 3> scale;
+
+		T duration() const {
+			return std::max({ position.duration(), rotation.duration(), scale.duration() });
+		}
+	};
+
+	// INTERPOLATION KERNELS
+	// -------------------------------
+	// Batch counterparts of lerp and slerp with a blend factor per element, for sampling many
+	// tracks at once. Quaternions are stored as (w, x, y, z) like Quaternion<T>::data and
+	// are blended along the shorter arc. Every kernel resizes `out` to the input size.
+
+	// out[i] = a[i] + (b[i] - a[i]) * t[i]
+	template<typename T, size_t N>
+	void lerp(const VectorArray<T, N>& a, const VectorArray<T, N>& b, const std::vector<T>& t, VectorArray<T, N>& out) {
+		detail::requireSameSize(a.size(), b.size());
+		detail::requireSameSize(a.size(), t.size());
+		out.resize(a.size());
+
+		for (size_t k = 0; k < N; ++k) {
+			detail::runBatch<T, 3, 1>({ a.component(k), b.component(k), t.data() }, { out.component(k) }, a.size(),
+				[](const auto& x) { return std::array{ simd::madd(simd::sub(x[1], x[0]), x[2], x[0]) }; },
+				[](const auto& x) { return std::array{ x[0] + (x[1] - x[0]) * x[2] }; });
+		}
+	}
+
+	// out[i] = lerp(a[i], b[i], t[i]) for unit quaternions, the normalized lerp
+	template<typename T>
+	void nlerp(const VectorArray<T, 4>& a, const VectorArray<T, 4>& b, const std::vector<T>& t, VectorArray<T, 4>& out) {
+		detail::requireSameSize(a.size(), b.size());
+		detail::requireSameSize(a.size(), t.size());
+		out.resize(a.size());
+
+		detail::runBatch<T, 9, 4>(detail::concat(detail::concat(detail::streams(a), detail::streams(b)), std::array<const T*, 1>{ t.data() }), detail::streams(out), a.size(),
+			[](const auto& x) {
+				simd::f32x4 dot = simd::mul(x[0], x[4]);
+				for (size_t k = 1; k < 4; ++k) dot = simd::madd(x[k], x[4 + k], dot);
+				simd::f32x4 sign = simd::select(simd::less(dot, simd::broadcast(0.0f)), simd::broadcast(-1.0f), simd::broadcast(1.0f));
+
+				std::array<simd::f32x4, 4> result;
+				for (size_t k = 0; k < 4; ++k) result[k] = simd::madd(simd::sub(simd::mul(x[4 + k], sign), x[k]), x[8], x[k]);
+
+				simd::f32x4 sum = simd::mul(result[0], result[0]);
+				for (size_t k = 1; k < 4; ++k) sum = simd::madd(result[k], result[k], sum);
+				simd::f32x4 inverse_magnitude = fast::rsqrt(sum);
+				for (size_t k = 0; k < 4; ++k) result[k] = simd::mul(result[k], inverse_magnitude);
+				return result;
+			},
+			[](const auto& x) {
+				T dot = x[0] * x[4] + x[1] * x[5] + x[2] * x[6] + x[3] * x[7];
+				T sign = dot < 0 ? T(-1) : T(1);
+
+				std::array<T, 4> result;
+				for (size_t k = 0; k < 4; ++k) result[k] = x[k] + (x[4 + k] * sign - x[k]) * x[8];
+
+				T magnitude = std::sqrt(result[0] * result[0] + result[1] * result[1] + result[2] * result[2] + result[3] * result[3]);
+				for (size_t k = 0; k < 4; ++k) result[k] /= magnitude;
+				return result;
+			});
+	}
+
+	// out[i] = slerp(a[i], b[i], t[i]) for unit quaternions. Nearly equal pairs fall back to the
+	// normalized lerp like slerp does, selected per lane instead of branched on.
+	template<typename T>
+	void slerp(const VectorArray<T, 4>& a, const VectorArray<T, 4>& b, const std::vector<T>& t, VectorArray<T, 4>& out) {
+		detail::requireSameSize(a.size(), b.size());
+		detail::requireSameSize(a.size(), t.size());
+		out.resize(a.size());
+
+		const T DOT_THRESHOLD = static_cast<T>(0.9995);
+
+		detail::runBatch<T, 9, 4>(detail::concat(detail::concat(detail::streams(a), detail::streams(b)), std::array<const T*, 1>{ t.data() }), detail::streams(out), a.size(),
+			[DOT_THRESHOLD](const auto& x) {
+				const simd::f32x4 one = simd::broadcast(1.0f);
+
+				simd::f32x4 dot = simd::mul(x[0], x[4]);
+				for (size_t k = 1; k < 4; ++k) dot = simd::madd(x[k], x[4 + k], dot);
+				simd::f32x4 sign = simd::select(simd::less(dot, simd::broadcast(0.0f)), simd::broadcast(-1.0f), one);
+				dot = simd::min(simd::abs(dot), one);
+
+				simd::f32x4 theta_0 = fast::acos(dot);
+				simd::f32x4 sin_theta, cos_theta;
+				fast::sincos(simd::mul(theta_0, x[8]), sin_theta, cos_theta);
+
+				// sin(theta_0) is zero for equal quaternions, those lanes take the lerp weights
+				simd::f32x4 close = simd::less(simd::broadcast(DOT_THRESHOLD), dot);
+				simd::f32x4 s1 = simd::div(sin_theta, fast::sin(theta_0));
+				simd::f32x4 s0 = simd::sub(cos_theta, simd::mul(dot, s1));
+				s0 = simd::select(close, simd::sub(one, x[8]), s0);
+				s1 = simd::mul(simd::select(close, x[8], s1), sign);
+
+				std::array<simd::f32x4, 4> result;
+				for (size_t k = 0; k < 4; ++k) result[k] = simd::madd(x[k], s0, simd::mul(x[4 + k], s1));
+
+				simd::f32x4 sum = simd::mul(result[0], result[0]);
+				for (size_t k = 1; k < 4; ++k) sum = simd::madd(result[k], result[k], sum);
+				simd::f32x4 magnitude = simd::sqrt(sum);
+				for (size_t k = 0; k < 4; ++k) result[k] = simd::div(result[k], magnitude);
+				return result;
+			},
+			[DOT_THRESHOLD](const auto& x) {
+				T dot = x[0] * x[4] + x[1] * x[5] + x[2] * x[6] + x[3] * x[7];
+				T sign = dot < 0 ? T(-1) : T(1);
+				dot = std::min(std::abs(dot), T(1));
+
+				T s0 = 1 - x[8];
+				T s1 = x[8];
+				if (dot <= DOT_THRESHOLD) {
+					T theta_0 = trig::acos(dot);
+					T theta = theta_0 * x[8];
+					s1 = trig::sin(theta) / trig::sin(theta_0);
+					s0 = trig::cos(theta) - dot * s1;
+				}
+				s1 *= sign;
+
+				std::array<T, 4> result;
+				for (size_t k = 0; k < 4; ++k) result[k] = x[k] * s0 + x[4 + k] * s1;
+
+				T magnitude = std::sqrt(result[0] * result[0] + result[1] * result[1] + result[2] * result[2] + result[3] * result[3]);
+				for (size_t k = 0; k < 4; ++k) result[k] /= magnitude;
+				return result;
+			});
+	}
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
\ No newline at end of file
@@ -2,6 +2,9 @@
 
 #include <cmath>
 
+#include "math.hpp"
+#include "fast_math.hpp"
+
 namespace gem {
 	template <typename T, size_t N>
 	struct Vector; // Forward declaration
@@ -13,8 +16,8 @@ namespace gem {
 	struct AxisAngle {
 		Vector<T, 4> data;
 
-		AxisAngle() : data{ 0, 0, 0, 0 } {}
-		AxisAngle(T angle, T x, T y, T z) : data{ angle, x, y, z } {
+		constexpr AxisAngle() : data{ 0, 0, 0, 0 } {}
+		constexpr AxisAngle(T angle, T x, T y, T z) : data{ angle, x, y, z } {
 			Vector<T, 3> ax{ x, y, z };
 			ax = ax.normalize();
 			data[1] = ax[0];
@@ -22,15 +25,15 @@ namespace gem {
 			data[3] = ax[2];
 		}
 
-		T angle() const { return data[0]; }
-		Vector<T, 3> axis() const { return Vector<T, 3>{ data[1], data[2], data[3] }; }
+		constexpr T angle() const { return data[0]; }
+		constexpr Vector<T, 3> axis() const { return Vector<T, 3>{ data[1], data[2], data[3] }; }
 
-		Quaternion<T> toQuaternion() const {
+		constexpr Quaternion<T> toQuaternion() const {
 			T half_angle = angle() * static_cast<T>(0.5);
-			T s = std::sin(half_angle);
+			T s = trig::sin(half_angle);
 
 			return Quaternion<T>(
-				std::cos(half_angle),
+				trig::cos(half_angle),
 				axis()[0] * s,
 				axis()[1] * s,
 				axis()[2] * s
@@ -0,0 +1,3 @@
+#include "dual_quaternion.hpp"
+
+namespace gem {}
\ No newline at end of file
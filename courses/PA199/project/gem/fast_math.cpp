@@ -0,0 +1,3 @@
+#include "fast_math.hpp"
+
+namespace gem {}
\ No newline at end of file
@@ -0,0 +1,266 @@
+#pragma once
+
+#include <bit>
+#include <cstdint>
+#include <type_traits>
+
+#include "math.hpp"
+#include "simd.hpp"
+
+namespace gem {
+	namespace fast {
+		// FAST APPROXIMATIONS
+		// -------------------------------
+		// Polynomial approximations for hot paths, accurate to float precision instead of to the
+		// last ulp like <cmath>. The scalar forms are constexpr templates, the simd::f32x4 forms
+		// evaluate the same polynomials on four lanes at once. Maximum errors against <cmath>
+		// (checked by gem_fast_math_test):
+		//
+		//   sin, cos, sincos   3e-7 absolute for |x| <= 100, growing with |x| past that
+		//   atan2              3e-7 absolute
+		//   acos               5e-7 absolute on [-1, 1], NaN outside like std::acos
+		//   rsqrt              3e-7 relative (the SIMD form starts from the 12-bit hardware estimate)
+		//   fmod               about |x| * 1.2e-7 absolute, it truncates x / y instead of the exact remainder
+
+		namespace detail {
+			constexpr double TWO_PI_HI = 6.28125; // k * TWO_PI_HI is exact for |k| < 2^16
+			constexpr double TWO_PI_LO = 1.9353071795864769e-3;
+			constexpr double INV_TWO_PI = 0.15915494309189535;
+
+			// x minus the nearest multiple of 2 * PI, in [-PI, PI]
+			template<typename T>
+			constexpr T reduce(T x) {
+				// Adding and subtracting 1.5 * 2^(mantissa bits) rounds q to the nearest integer
+				const T round_shift = static_cast<T>(std::is_same_v<T, float> ? 12582912.0 : 6755399441055744.0);
+				T k = (x * static_cast<T>(INV_TWO_PI) + round_shift) - round_shift;
+				T r = x - k * static_cast<T>(TWO_PI_HI);
+				return r - k * static_cast<T>(TWO_PI_LO);
+			}
+
+			// sin(r) for r in [-3 * PI / 2, 3 * PI / 2]: reflected into [-PI / 2, PI / 2] and
+			// evaluated as a degree 11 odd polynomial
+			template<typename T>
+			constexpr T sinReduced(T r) {
+				const T pi = static_cast<T>(math::PI);
+				const T half_pi = static_cast<T>(math::PI / 2);
+
+				if (r > half_pi) r = pi - r;
+				else if (r < -half_pi) r = -pi - r;
+
+				T r2 = r * r;
+				T p = static_cast<T>(-2.50521084e-8);
+				p = p * r2 + static_cast<T>(2.75573192e-6);
+				p = p * r2 + static_cast<T>(-1.98412698e-4);
+				p = p * r2 + static_cast<T>(8.33333333e-3);
+				p = p * r2 + static_cast<T>(-1.66666667e-1);
+				return r + r * r2 * p;
+			}
+
+			// atan(x) with |x| reduced to [0, tan(PI / 8)] first (Cephes atanf)
+			template<typename T>
+			constexpr T atan(T x) {
+				T a = x < 0 ? -x : x;
+				T y = 0;
+				T t = a;
+
+				if (a > static_cast<T>(2.41421356)) {
+					y = static_cast<T>(math::PI / 2);
+					t = -1 / a;
+				}
+				else if (a > static_cast<T>(0.414213562)) {
+					y = static_cast<T>(math::PI / 4);
+					t = (a - 1) / (a + 1);
+				}
+
+				T z = t * t;
+				T p = static_cast<T>(8.05374449538e-2);
+				p = p * z + static_cast<T>(-1.38776856032e-1);
+				p = p * z + static_cast<T>(1.99777106478e-1);
+				p = p * z + static_cast<T>(-3.33329491539e-1);
+				y += t + t * z * p;
+
+				return x < 0 ? -y : y;
+			}
+		}
+
+		// SCALAR FORMS
+		// -------------------------------
+
+		template<typename T>
+		constexpr T sin(T x) {
+			return detail::sinReduced(detail::reduce(x));
+		}
+
+		template<typename T>
+		constexpr T cos(T x) {
+			return detail::sinReduced(detail::reduce(x) + static_cast<T>(math::PI / 2));
+		}
+
+		// Both with a single range reduction
+		template<typename T>
+		constexpr void sincos(T x, T& s, T& c) {
+			T r = detail::reduce(x);
+			s = detail::sinReduced(r);
+			c = detail::sinReduced(r + static_cast<T>(math::PI / 2));
+		}
+
+		template<typename T>
+		constexpr T atan2(T y, T x) {
+			const T pi = static_cast<T>(math::PI);
+
+			if (x == 0) {
+				return y < 0 ? -pi / 2 : (y == 0 ? 0 : pi / 2);
+			}
+
+			T r = detail::atan(y / x);
+			if (x < 0) r += y < 0 ? -pi : pi;
+			return r;
+		}
+
+		// sqrt(1 - |x|) times a degree 7 polynomial (Abramowitz and Stegun 4.4.45)
+		template<typename T>
+		constexpr T acos(T x) {
+			T a = x < 0 ? -x : x;
+
+			T p = static_cast<T>(-0.0012624911);
+			p = p * a + static_cast<T>(0.0066700901);
+			p = p * a + static_cast<T>(-0.0170881256);
+			p = p * a + static_cast<T>(0.0308918810);
+			p = p * a + static_cast<T>(-0.0501743046);
+			p = p * a + static_cast<T>(0.0889789874);
+			p = p * a + static_cast<T>(-0.2145988016);
+			p = p * a + static_cast<T>(1.5707963050);
+
+			T r = math::sqrt(1 - a) * p;
+			return x < 0 ? static_cast<T>(math::PI) - r : r;
+		}
+
+		// 1 / sqrt(x) from the bit-level initial guess refined by three Newton steps.
+		// Computed in float precision for every T. Mainly useful in constant expressions, at
+		// runtime a scalar 1 / sqrt(x) is about as fast and the SIMD form is the one that pays off.
+		template<typename T>
+		constexpr T rsqrt(T x) {
+			float f = static_cast<float>(x);
+			float y = std::bit_cast<float>(0x5f375a86u - (std::bit_cast<uint32_t>(f) >> 1));
+			y = y * (1.5f - 0.5f * f * y * y);
+			y = y * (1.5f - 0.5f * f * y * y);
+			y = y * (1.5f - 0.5f * f * y * y);
+			return static_cast<T>(y);
+		}
+
+		template<typename T>
+		constexpr T fmod(T x, T y) {
+			return x - y * static_cast<T>(static_cast<long long>(x / y));
+		}
+
+		// SIMD FORMS
+		// -------------------------------
+
+		namespace detail {
+			inline simd::f32x4 reduce(simd::f32x4 x) {
+				simd::f32x4 k = simd::round(simd::mul(x, simd::broadcast(static_cast<float>(INV_TWO_PI))));
+				simd::f32x4 r = simd::sub(x, simd::mul(k, simd::broadcast(static_cast<float>(TWO_PI_HI))));
+				return simd::sub(r, simd::mul(k, simd::broadcast(static_cast<float>(TWO_PI_LO))));
+			}
+
+			inline simd::f32x4 sinReduced(simd::f32x4 r) {
+				const simd::f32x4 pi = simd::broadcast(static_cast<float>(math::PI));
+				const simd::f32x4 half_pi = simd::broadcast(static_cast<float>(math::PI / 2));
+
+				simd::f32x4 signed_pi = simd::select(simd::less(r, simd::broadcast(0.0f)), simd::sub(simd::broadcast(0.0f), pi), pi);
+				r = simd::select(simd::less(half_pi, simd::abs(r)), simd::sub(signed_pi, r), r);
+
+				simd::f32x4 r2 = simd::mul(r, r);
+				simd::f32x4 p = simd::broadcast(-2.50521084e-8f);
+				p = simd::madd(p, r2, simd::broadcast(2.75573192e-6f));
+				p = simd::madd(p, r2, simd::broadcast(-1.98412698e-4f));
+				p = simd::madd(p, r2, simd::broadcast(8.33333333e-3f));
+				p = simd::madd(p, r2, simd::broadcast(-1.66666667e-1f));
+				return simd::madd(simd::mul(p, r2), r, r);
+			}
+
+			inline simd::f32x4 atan(simd::f32x4 x) {
+				const simd::f32x4 zero = simd::broadcast(0.0f);
+				const simd::f32x4 one = simd::broadcast(1.0f);
+
+				simd::f32x4 a = simd::abs(x);
+				simd::f32x4 big = simd::less(simd::broadcast(2.41421356f), a);
+				simd::f32x4 mid = simd::less(simd::broadcast(0.414213562f), a);
+				simd::f32x4 y = simd::select(big, simd::broadcast(static_cast<float>(math::PI / 2)),
+					simd::select(mid, simd::broadcast(static_cast<float>(math::PI / 4)), zero));
+				simd::f32x4 t = simd::select(big, simd::div(simd::broadcast(-1.0f), a),
+					simd::select(mid, simd::div(simd::sub(a, one), simd::add(a, one)), a));
+
+				simd::f32x4 z = simd::mul(t, t);
+				simd::f32x4 p = simd::broadcast(8.05374449538e-2f);
+				p = simd::madd(p, z, simd::broadcast(-1.38776856032e-1f));
+				p = simd::madd(p, z, simd::broadcast(1.99777106478e-1f));
+				p = simd::madd(p, z, simd::broadcast(-3.33329491539e-1f));
+				y = simd::add(y, simd::madd(simd::mul(p, z), t, t));
+
+				return simd::select(simd::less(x, zero), simd::sub(zero, y), y);
+			}
+		}
+
+		inline simd::f32x4 sin(simd::f32x4 x) {
+			return detail::sinReduced(detail::reduce(x));
+		}
+
+		inline simd::f32x4 cos(simd::f32x4 x) {
+			return detail::sinReduced(simd::add(detail::reduce(x), simd::broadcast(static_cast<float>(math::PI / 2))));
+		}
+
+		inline void sincos(simd::f32x4 x, simd::f32x4& s, simd::f32x4& c) {
+			simd::f32x4 r = detail::reduce(x);
+			s = detail::sinReduced(r);
+			c = detail::sinReduced(simd::add(r, simd::broadcast(static_cast<float>(math::PI / 2))));
+		}
+
+		inline simd::f32x4 atan2(simd::f32x4 y, simd::f32x4 x) {
+			const simd::f32x4 zero = simd::broadcast(0.0f);
+			const simd::f32x4 pi = simd::broadcast(static_cast<float>(math::PI));
+			const simd::f32x4 half_pi = simd::broadcast(static_cast<float>(math::PI / 2));
+
+			simd::f32x4 y_negative = simd::less(y, zero);
+			simd::f32x4 r = detail::atan(simd::div(y, x));
+			r = simd::add(r, simd::select(simd::less(x, zero), simd::select(y_negative, simd::sub(zero, pi), pi), zero));
+
+			simd::f32x4 on_axis = simd::select(y_negative, simd::sub(zero, half_pi), simd::select(simd::equal(y, zero), zero, half_pi));
+			return simd::select(simd::equal(x, zero), on_axis, r);
+		}
+
+		inline simd::f32x4 acos(simd::f32x4 x) {
+			simd::f32x4 a = simd::abs(x);
+
+			simd::f32x4 p = simd::broadcast(-0.0012624911f);
+			p = simd::madd(p, a, simd::broadcast(0.0066700901f));
+			p = simd::madd(p, a, simd::broadcast(-0.0170881256f));
+			p = simd::madd(p, a, simd::broadcast(0.0308918810f));
+			p = simd::madd(p, a, simd::broadcast(-0.0501743046f));
+			p = simd::madd(p, a, simd::broadcast(0.0889789874f));
+			p = simd::madd(p, a, simd::broadcast(-0.2145988016f));
+			p = simd::madd(p, a, simd::broadcast(1.5707963050f));
+
+			simd::f32x4 r = simd::mul(simd::sqrt(simd::sub(simd::broadcast(1.0f), a)), p);
+			return simd::select(simd::less(x, simd::broadcast(0.0f)), simd::sub(simd::broadcast(static_cast<float>(math::PI)), r), r);
+		}
+
+		// Hardware estimate refined by one Newton step
+		inline simd::f32x4 rsqrt(simd::f32x4 x) {
+			simd::f32x4 y = simd::rsqrt(x);
+			simd::f32x4 half_xyy = simd::mul(simd::mul(simd::broadcast(0.5f), x), simd::mul(y, y));
+			return simd::mul(y, simd::sub(simd::broadcast(1.5f), half_xyy));
+		}
+	}
+
+	// TRIG SELECTION
+	// -------------------------------
+	// Polar, slerp, AxisAngle::toQuaternion and the collision components take their trigonometry
+	// from gem::trig, which is gem::fast when GEM_USE_FAST_MATH is defined and gem::math otherwise.
+
+#if defined(GEM_USE_FAST_MATH)
+	namespace trig = fast;
+#else
+	namespace trig = math;
+#endif
+}
\ No newline at end of file
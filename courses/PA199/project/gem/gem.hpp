@@ -7,9 +7,19 @@
 #define M_PI 3.14159265358979323846
 #endif
 
+#include "math.hpp"
+#include "fast_math.hpp"
 #include "vector.hpp"
+#include "matrix3.hpp"
 #include "matrix.hpp"
 #include "quaternion.hpp"
+#include "dual_quaternion.hpp"
 #include "axis_angle.hpp"
 #include "interpolation.hpp"
 #include "coordinates.hpp"
+#include "transform.hpp"
+#include "vector_array.hpp"
+#include "geometry.hpp"
+#include "animation.hpp"
+#include "spline.hpp"
+#include "packing.hpp"
\ No newline at end of file
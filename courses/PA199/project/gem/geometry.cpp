@@ -0,0 +1,3 @@
+#include "geometry.hpp"
+
+namespace gem {}
\ No newline at end of file
@@ -0,0 +1,555 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "math.hpp"
+#include "fast_math.hpp"
+#include "vector.hpp"
+#include "matrix.hpp"
+#include "simd.hpp"
+#include "vector_array.hpp"
+
+// std::array<__m128, N> drops the vector type's may_alias attribute, which is harmless here
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wignored-attributes"
+#endif
+
+namespace gem {
+	template<typename T>
+	struct Sphere; // Forward declaration
+
+	// AXIS-ALIGNED BOUNDING BOX
+	// -------------------------------
+
+	template<typename T>
+	struct AABB {
+		Vector<T, 3> min;
+		Vector<T, 3> max;
+
+		static constexpr AABB fromCenterExtents(const Vector<T, 3>& center, const Vector<T, 3>& extents) {
+			return AABB{ center - extents, center + extents };
+		}
+
+		constexpr Vector<T, 3> center() const {
+			return (min + max) * static_cast<T>(0.5);
+		}
+
+		// Half of the size along each axis
+		constexpr Vector<T, 3> extents() const {
+			return (max - min) * static_cast<T>(0.5);
+		}
+
+		// Smallest box containing both boxes
+		constexpr AABB merge(const AABB& other) const {
+			AABB result;
+			for (int i = 0; i < 3; ++i) {
+				result.min[i] = std::min(min[i], other.min[i]);
+				result.max[i] = std::max(max[i], other.max[i]);
+			}
+			return result;
+		}
+
+		// Smallest box containing this box and the point
+		constexpr AABB expand(const Vector<T, 3>& point) const {
+			AABB result;
+			for (int i = 0; i < 3; ++i) {
+				result.min[i] = std::min(min[i], point[i]);
+				result.max[i] = std::max(max[i], point[i]);
+			}
+			return result;
+		}
+
+		constexpr Vector<T, 3> closestPoint(const Vector<T, 3>& point) const {
+			Vector<T, 3> result;
+			for (int i = 0; i < 3; ++i) {
+				result[i] = std::clamp(point[i], min[i], max[i]);
+			}
+			return result;
+		}
+
+		constexpr bool contains(const Vector<T, 3>& point) const {
+			return point[0] >= min[0] && point[0] <= max[0]
+				&& point[1] >= min[1] && point[1] <= max[1]
+				&& point[2] >= min[2] && point[2] <= max[2];
+		}
+
+		constexpr bool contains(const AABB& other) const {
+			return contains(other.min) && contains(other.max);
+		}
+
+		constexpr bool intersects(const AABB& other) const {
+			return min[0] <= other.max[0] && max[0] >= other.min[0]
+				&& min[1] <= other.max[1] && max[1] >= other.min[1]
+				&& min[2] <= other.max[2] && max[2] >= other.min[2];
+		}
+
+		constexpr bool intersects(const Sphere<T>& sphere) const;
+
+		// Box around this box transformed by m, without the perspective divide (Arvo's method)
+		constexpr AABB transform(const Matrix4<T>& m) const {
+			AABB result;
+			for (int i = 0; i < 3; ++i) {
+				result.min[i] = m(i, 3);
+				result.max[i] = m(i, 3);
+				for (int j = 0; j < 3; ++j) {
+					T a = m(i, j) * min[j];
+					T b = m(i, j) * max[j];
+					result.min[i] += std::min(a, b);
+					result.max[i] += std::max(a, b);
+				}
+			}
+			return result;
+		}
+	};
+
+	// SPHERE
+	// -------------------------------
+
+	template<typename T>
+	struct Sphere {
+		Vector<T, 3> center;
+		T radius;
+
+		constexpr AABB<T> boundingBox() const {
+			return AABB<T>::fromCenterExtents(center, Vector<T, 3>{ radius, radius, radius });
+		}
+
+		constexpr bool contains(const Vector<T, 3>& point) const {
+			Vector<T, 3> d = point - center;
+			return d.dot(d) <= radius * radius;
+		}
+
+		constexpr bool contains(const Sphere& other) const {
+			if (other.radius > radius) return false;
+			Vector<T, 3> d = other.center - center;
+			T reach = radius - other.radius;
+			return d.dot(d) <= reach * reach;
+		}
+
+		constexpr bool intersects(const Sphere& other) const {
+			Vector<T, 3> d = other.center - center;
+			T reach = radius + other.radius;
+			return d.dot(d) <= reach * reach;
+		}
+
+		constexpr bool intersects(const AABB<T>& box) const {
+			Vector<T, 3> d = box.closestPoint(center) - center;
+			return d.dot(d) <= radius * radius;
+		}
+	};
+
+	template<typename T>
+	constexpr bool AABB<T>::intersects(const Sphere<T>& sphere) const {
+		return sphere.intersects(*this);
+	}
+
+	// PLANE
+	// -------------------------------
+	// Points p with normal.dot(p) + distance == 0. The normal points to the positive half-space.
+
+	template<typename T>
+	struct Plane {
+		Vector<T, 3> normal;
+		T distance;
+
+		static constexpr Plane fromPointNormal(const Vector<T, 3>& point, const Vector<T, 3>& normal) {
+			Vector<T, 3> n = normal.normalize();
+			return Plane{ n, -n.dot(point) };
+		}
+
+		// Counter-clockwise a, b, c face the normal
+		static constexpr Plane fromPoints(const Vector<T, 3>& a, const Vector<T, 3>& b, const Vector<T, 3>& c) {
+			return fromPointNormal(a, (b - a).cross(c - a));
+		}
+
+		// Scales the equation so that the normal has unit length and signedDistance() is in world units
+		constexpr Plane normalize() const {
+			T mag = normal.magnitude();
+			if (mag == 0) return *this;
+			return Plane{ normal / mag, distance / mag };
+		}
+
+		constexpr T signedDistance(const Vector<T, 3>& point) const {
+			return normal.dot(point) + distance;
+		}
+
+		constexpr bool intersects(const Sphere<T>& sphere) const {
+			return math::abs(signedDistance(sphere.center)) <= sphere.radius;
+		}
+
+		constexpr bool intersects(const AABB<T>& box) const {
+			Vector<T, 3> e = box.extents();
+			T r = e[0] * math::abs(normal[0]) + e[1] * math::abs(normal[1]) + e[2] * math::abs(normal[2]);
+			return math::abs(signedDistance(box.center())) <= r;
+		}
+	};
+
+	// RAY
+	// -------------------------------
+	// The intersect functions return whether the ray hits the volume and store the parameter t of
+	// the first point at(t) with t >= 0 on the volume (t = 0 when the origin is inside). t is in
+	// world units when the direction has unit length.
+
+	template<typename T>
+	struct Ray {
+		Vector<T, 3> origin;
+		Vector<T, 3> direction;
+
+		constexpr Vector<T, 3> at(T t) const {
+			return origin + direction * t;
+		}
+
+		// Slab test
+		constexpr bool intersect(const AABB<T>& box, T& t) const {
+			T t_near = -std::numeric_limits<T>::infinity();
+			T t_far = std::numeric_limits<T>::infinity();
+
+			for (int i = 0; i < 3; ++i) {
+				T inv = 1 / direction[i];
+				T t0 = (box.min[i] - origin[i]) * inv;
+				T t1 = (box.max[i] - origin[i]) * inv;
+				t_near = std::max(t_near, std::min(t0, t1));
+				t_far = std::min(t_far, std::max(t0, t1));
+			}
+
+			t_near = std::max(t_near, static_cast<T>(0));
+			if (t_far < t_near) return false;
+
+			t = t_near;
+			return true;
+		}
+
+		constexpr bool intersect(const Sphere<T>& sphere, T& t) const {
+			Vector<T, 3> oc = origin - sphere.center;
+			T a = direction.dot(direction);
+			T b = oc.dot(direction);
+			T c = oc.dot(oc) - sphere.radius * sphere.radius;
+
+			T discriminant = b * b - a * c;
+			if (discriminant < 0) return false;
+
+			T root = math::sqrt(discriminant);
+			if (-b + root < 0) return false;
+
+			t = std::max((-b - root) / a, static_cast<T>(0));
+			return true;
+		}
+
+		constexpr bool intersect(const Plane<T>& plane, T& t) const {
+			T denominator = plane.normal.dot(direction);
+			if (denominator == 0) return false;
+
+			T hit = -plane.signedDistance(origin) / denominator;
+			if (hit < 0) return false;
+
+			t = hit;
+			return true;
+		}
+	};
+
+	// FRUSTUM
+	// -------------------------------
+	// Six inward-facing planes, a point is inside when it is on the positive side of all of them.
+
+	template<typename T>
+	struct Frustum {
+		static constexpr size_t LEFT = 0;
+		static constexpr size_t RIGHT = 1;
+		static constexpr size_t BOTTOM = 2;
+		static constexpr size_t TOP = 3;
+		static constexpr size_t NEAR = 4;
+		static constexpr size_t FAR = 5;
+
+		std::array<Plane<T>, 6> planes;
+
+		// Gribb-Hartmann extraction. With clip = m * p, a point is inside when -w <= x, y, z <= w,
+		// so every plane is the last row of m plus or minus one of the others.
+		// Works on projection (view space frustum) and projection * view (world space frustum) matrices.
+		static constexpr Frustum fromMatrix(const Matrix4<T>& m) {
+			Frustum result;
+			for (int i = 0; i < 3; ++i) {
+				Vector<T, 3> row{ m(i, 0), m(i, 1), m(i, 2) };
+				Vector<T, 3> w{ m(3, 0), m(3, 1), m(3, 2) };
+				result.planes[2 * i] = Plane<T>{ w + row, m(3, 3) + m(i, 3) }.normalize();
+				result.planes[2 * i + 1] = Plane<T>{ w - row, m(3, 3) - m(i, 3) }.normalize();
+			}
+			return result;
+		}
+
+		constexpr bool contains(const Vector<T, 3>& point) const {
+			for (const Plane<T>& plane : planes) {
+				if (plane.signedDistance(point) < 0) return false;
+			}
+			return true;
+		}
+
+		// Whole sphere inside
+		constexpr bool contains(const Sphere<T>& sphere) const {
+			for (const Plane<T>& plane : planes) {
+				if (plane.signedDistance(sphere.center) < sphere.radius) return false;
+			}
+			return true;
+		}
+
+		// Conservative: false only when the sphere is completely behind one plane, a sphere near
+		// a corner outside the frustum may still pass. This is the usual culling trade-off.
+		constexpr bool intersects(const Sphere<T>& sphere) const {
+			for (const Plane<T>& plane : planes) {
+				if (plane.signedDistance(sphere.center) < -sphere.radius) return false;
+			}
+			return true;
+		}
+
+		// Conservative like intersects(Sphere), tests the box corner furthest along each normal
+		constexpr bool intersects(const AABB<T>& box) const {
+			for (const Plane<T>& plane : planes) {
+				Vector<T, 3> corner{
+					plane.normal[0] >= 0 ? box.max[0] : box.min[0],
+					plane.normal[1] >= 0 ? box.max[1] : box.min[1],
+					plane.normal[2] >= 0 ? box.max[2] : box.min[2]
+				};
+				if (plane.signedDistance(corner) < 0) return false;
+			}
+			return true;
+		}
+	};
+
+	// ANNULAR SECTOR
+	// -------------------------------
+	// The footprint of an ArcRendererComponent on the XZ plane: the points around `center` whose
+	// distance is in [inner_radius, outer_radius] and whose polar angle (Polar::fromCartesian) is in
+	// [start, start + sweep]. Heights are ignored.
+
+	template<typename T>
+	struct AnnularSector {
+		Vector<T, 3> center;
+		T inner_radius;
+		T outer_radius;
+		T start;
+		T sweep;
+
+		// An arc mesh generated with GenerateArcVertices(inner, outer, ..., angle) spans polar angles
+		// [0, angle], rotating its entity by `yaw` around Y moves that to [-yaw, angle - yaw].
+		static constexpr AnnularSector fromArc(const Vector<T, 3>& center, T inner_radius, T outer_radius, T angle, T yaw) {
+			return AnnularSector{ center, inner_radius, outer_radius, -yaw, angle };
+		}
+
+		// Whether the polar angle theta falls inside [start, start + sweep] modulo 2 * PI
+		constexpr bool containsAngle(T theta) const {
+			const T two_pi = static_cast<T>(2 * math::PI);
+			if (sweep >= two_pi) return true;
+
+			T local = trig::fmod(theta - start, two_pi);
+			if (local < 0) local += two_pi;
+			return local <= sweep;
+		}
+
+		constexpr bool contains(const Vector<T, 3>& point) const {
+			T dx = point[0] - center[0];
+			T dz = point[2] - center[2];
+			T r2 = dx * dx + dz * dz;
+
+			if (r2 < inner_radius * inner_radius || r2 > outer_radius * outer_radius) return false;
+			return containsAngle(trig::atan2(dz, dx));
+		}
+
+		// The sphere's cross-section through its center as a disc on the XZ plane
+		constexpr bool intersects(const Sphere<T>& sphere) const {
+			T dx = sphere.center[0] - center[0];
+			T dz = sphere.center[2] - center[2];
+			T r = math::sqrt(dx * dx + dz * dz);
+
+			if (r + sphere.radius < inner_radius || r - sphere.radius > outer_radius) return false;
+			if (containsAngle(trig::atan2(dz, dx))) return true;
+
+			// Outside the wedge the closest point of the sector lies on one of its straight edges
+			return edgeDistanceSquared(start, dx, dz) <= sphere.radius * sphere.radius
+				|| edgeDistanceSquared(start + sweep, dx, dz) <= sphere.radius * sphere.radius;
+		}
+
+	private:
+		// Squared distance from (x, z), relative to the center, to the edge at polar angle theta
+		constexpr T edgeDistanceSquared(T theta, T x, T z) const {
+			T ux = trig::cos(theta);
+			T uz = trig::sin(theta);
+
+			T along = std::clamp(x * ux + z * uz, inner_radius, outer_radius);
+			T ex = x - along * ux;
+			T ez = z - along * uz;
+			return ex * ex + ez * ez;
+		}
+	};
+
+	// BATCH QUERIES
+	// -------------------------------
+	// One frustum or ray against many volumes stored as VectorArray streams: spheres as
+	// VectorArray<T, 4> (center, radius), boxes as a pair of VectorArray<T, 3> (min, max).
+	// For float they test four volumes at once, any other type falls back to the scalar
+	// functions above, which give the same answers.
+
+	namespace detail {
+		// Like runBatch, but the packet kernel returns a lane mask and the scalar kernel a bool,
+		// written to `out` as 1 or 0
+		template<typename T, size_t In, typename PacketKernel, typename ScalarKernel>
+		void runMaskBatch(const std::array<const T*, In>& in, std::vector<uint8_t>& out, size_t count, PacketKernel packet_kernel, ScalarKernel scalar_kernel) {
+			out.resize(count);
+
+			if constexpr (std::is_same_v<T, float>) {
+				size_t i = 0;
+				for (; i + 4 <= count; i += 4) {
+					std::array<simd::f32x4, In> x;
+					for (size_t k = 0; k < In; ++k) x[k] = simd::load(in[k] + i);
+
+					int bits = simd::maskBits(packet_kernel(x));
+					for (size_t j = 0; j < 4; ++j) out[i + j] = static_cast<uint8_t>((bits >> j) & 1);
+				}
+
+				if (i < count) {
+					size_t rest = count - i;
+					float buffer[4] = {};
+
+					std::array<simd::f32x4, In> x;
+					for (size_t k = 0; k < In; ++k) {
+						for (size_t j = 0; j < rest; ++j) buffer[j] = in[k][i + j];
+						x[k] = simd::load(buffer);
+					}
+
+					int bits = simd::maskBits(packet_kernel(x));
+					for (size_t j = 0; j < rest; ++j) out[i + j] = static_cast<uint8_t>((bits >> j) & 1);
+				}
+			}
+			else {
+				for (size_t i = 0; i < count; ++i) {
+					std::array<T, In> x;
+					for (size_t k = 0; k < In; ++k) x[k] = in[k][i];
+					out[i] = scalar_kernel(x) ? 1 : 0;
+				}
+			}
+		}
+	}
+
+	// out[i] = frustum.intersects(spheres[i])
+	template<typename T>
+	void intersects(const Frustum<T>& frustum, const VectorArray<T, 4>& spheres, std::vector<uint8_t>& out) {
+		detail::runMaskBatch<T, 4>(detail::streams(spheres), out, spheres.size(),
+			[&frustum](const auto& x) {
+				simd::f32x4 neg_radius = simd::sub(simd::broadcast(0.0f), x[3]);
+				simd::f32x4 outside = simd::broadcast(0.0f);
+				for (const Plane<T>& plane : frustum.planes) {
+					simd::f32x4 d = simd::madd(x[0], simd::broadcast(plane.normal[0]), simd::broadcast(plane.distance));
+					d = simd::madd(x[1], simd::broadcast(plane.normal[1]), d);
+					d = simd::madd(x[2], simd::broadcast(plane.normal[2]), d);
+					outside = simd::maskOr(outside, simd::less(d, neg_radius));
+				}
+				return simd::maskNot(outside);
+			},
+			[&frustum](const auto& x) {
+				return frustum.intersects(Sphere<T>{ Vector<T, 3>{ x[0], x[1], x[2] }, x[3] });
+			});
+	}
+
+	// out[i] = frustum.intersects(AABB{ mins[i], maxs[i] })
+	template<typename T>
+	void intersects(const Frustum<T>& frustum, const VectorArray<T, 3>& mins, const VectorArray<T, 3>& maxs, std::vector<uint8_t>& out) {
+		detail::requireSameSize(mins.size(), maxs.size());
+
+		detail::runMaskBatch<T, 6>(detail::concat(detail::streams(mins), detail::streams(maxs)), out, mins.size(),
+			[&frustum](const auto& x) {
+				simd::f32x4 outside = simd::broadcast(0.0f);
+				for (const Plane<T>& plane : frustum.planes) {
+					// The furthest corner along the normal is picked per plane, not per box
+					simd::f32x4 d = simd::broadcast(plane.distance);
+					for (int k = 0; k < 3; ++k) {
+						d = simd::madd(x[plane.normal[k] >= 0 ? 3 + k : k], simd::broadcast(plane.normal[k]), d);
+					}
+					outside = simd::maskOr(outside, simd::less(d, simd::broadcast(0.0f)));
+				}
+				return simd::maskNot(outside);
+			},
+			[&frustum](const auto& x) {
+				return frustum.intersects(AABB<T>{ Vector<T, 3>{ x[0], x[1], x[2] }, Vector<T, 3>{ x[3], x[4], x[5] } });
+			});
+	}
+
+	// out[i] = the t of ray.intersect(spheres[i], t), infinity on a miss
+	template<typename T>
+	void intersect(const Ray<T>& ray, const VectorArray<T, 4>& spheres, std::vector<T>& out) {
+		out.resize(spheres.size());
+
+		const T a = ray.direction.dot(ray.direction);
+		const T inv_a = 1 / a;
+
+		detail::runBatch<T, 4, 1>(detail::streams(spheres), { out.data() }, spheres.size(),
+			[&ray, a, inv_a](const auto& x) {
+				const simd::f32x4 zero = simd::broadcast(0.0f);
+
+				simd::f32x4 ocx = simd::sub(simd::broadcast(ray.origin[0]), x[0]);
+				simd::f32x4 ocy = simd::sub(simd::broadcast(ray.origin[1]), x[1]);
+				simd::f32x4 ocz = simd::sub(simd::broadcast(ray.origin[2]), x[2]);
+
+				simd::f32x4 b = simd::mul(ocx, simd::broadcast(ray.direction[0]));
+				b = simd::madd(ocy, simd::broadcast(ray.direction[1]), b);
+				b = simd::madd(ocz, simd::broadcast(ray.direction[2]), b);
+
+				simd::f32x4 c = simd::mul(ocx, ocx);
+				c = simd::madd(ocy, ocy, c);
+				c = simd::madd(ocz, ocz, c);
+				c = simd::sub(c, simd::mul(x[3], x[3]));
+
+				simd::f32x4 discriminant = simd::sub(simd::mul(b, b), simd::mul(simd::broadcast(a), c));
+				simd::f32x4 root = simd::sqrt(simd::max(discriminant, zero));
+				simd::f32x4 neg_b = simd::sub(zero, b);
+
+				simd::f32x4 miss = simd::maskOr(simd::less(discriminant, zero), simd::less(simd::add(neg_b, root), zero));
+				simd::f32x4 t = simd::max(simd::mul(simd::sub(neg_b, root), simd::broadcast(inv_a)), zero);
+				return std::array{ simd::select(miss, simd::broadcast(std::numeric_limits<float>::infinity()), t) };
+			},
+			[&ray](const auto& x) {
+				T t = 0;
+				bool hit = ray.intersect(Sphere<T>{ Vector<T, 3>{ x[0], x[1], x[2] }, x[3] }, t);
+				return std::array{ hit ? t : std::numeric_limits<T>::infinity() };
+			});
+	}
+
+	// out[i] = the t of ray.intersect(AABB{ mins[i], maxs[i] }, t), infinity on a miss
+	template<typename T>
+	void intersect(const Ray<T>& ray, const VectorArray<T, 3>& mins, const VectorArray<T, 3>& maxs, std::vector<T>& out) {
+		detail::requireSameSize(mins.size(), maxs.size());
+		out.resize(mins.size());
+
+		const Vector<T, 3> inv{ 1 / ray.direction[0], 1 / ray.direction[1], 1 / ray.direction[2] };
+
+		detail::runBatch<T, 6, 1>(detail::concat(detail::streams(mins), detail::streams(maxs)), { out.data() }, mins.size(),
+			[&ray, &inv](const auto& x) {
+				simd::f32x4 t_near = simd::broadcast(0.0f);
+				simd::f32x4 t_far = simd::broadcast(std::numeric_limits<float>::infinity());
+
+				for (int k = 0; k < 3; ++k) {
+					simd::f32x4 o = simd::broadcast(ray.origin[k]);
+					simd::f32x4 s = simd::broadcast(inv[k]);
+					simd::f32x4 t0 = simd::mul(simd::sub(x[k], o), s);
+					simd::f32x4 t1 = simd::mul(simd::sub(x[3 + k], o), s);
+					t_near = simd::max(t_near, simd::min(t0, t1));
+					t_far = simd::min(t_far, simd::max(t0, t1));
+				}
+
+				simd::f32x4 miss = simd::less(t_far, t_near);
+				return std::array{ simd::select(miss, simd::broadcast(std::numeric_limits<float>::infinity()), t_near) };
+			},
+			[&ray](const auto& x) {
+				T t = 0;
+				bool hit = ray.intersect(AABB<T>{ Vector<T, 3>{ x[0], x[1], x[2] }, Vector<T, 3>{ x[3], x[4], x[5] } }, t);
+				return std::array{ hit ? t : std::numeric_limits<T>::infinity() };
+			});
+	}
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
\ No newline at end of file
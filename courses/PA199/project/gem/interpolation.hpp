@@ -3,13 +3,16 @@
 #include <cmath>
 #include <iostream>
 
+#include "math.hpp"
+#include "fast_math.hpp"
+
 namespace gem
 {
 	template<typename T, size_t N>
 	struct Vector; // Forward declaration
 
 	template<typename T, size_t N>
-	Vector<T, N> lerp(Vector<T, N> a, Vector<T, N> b, float t)
+	constexpr Vector<T, N> lerp(Vector<T, N> a, Vector<T, N> b, float t)
 	{
 		return a + (b - a) * t;
 	};
@@ -18,13 +21,13 @@ namespace gem
 	struct Quaternion; // Forward declaration
 	
 	template<typename T>
-	Quaternion<T> lerp(Quaternion<T> a, Quaternion<T> b, float t)
+	constexpr Quaternion<T> lerp(Quaternion<T> a, Quaternion<T> b, float t)
 	{
 		return (a + (b - a) * t).normalize();
 	};
 
 	template<typename T>
-	Quaternion<T> slerp(Quaternion<T> a, Quaternion<T> b, float t)
+	constexpr Quaternion<T> slerp(Quaternion<T> a, Quaternion<T> b, float t)
 	{
 		// Clamping Edges
 		if (t == 0.0f) return a;
@@ -44,12 +47,12 @@ namespace gem
 			return lerp(a, b, t).normalize();
 		}
 
-		T theta_0 = std::acos(dot);
+		T theta_0 = trig::acos(dot);
 		T theta = theta_0 * t;
 
-		T sin_theta = std::sin(theta);
-		T sin_theta_0 = std::sin(theta_0);
-		T s0 = std::cos(theta) - dot * sin_theta / sin_theta_0;
+		T sin_theta = trig::sin(theta);
+		T sin_theta_0 = trig::sin(theta_0);
+		T s0 = trig::cos(theta) - dot * sin_theta / sin_theta_0;
 		T s1 = sin_theta / sin_theta_0;
 
 		return (a * s0 + b * s1).normalize();
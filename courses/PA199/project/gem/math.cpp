@@ -0,0 +1,3 @@
+#include "math.hpp"
+
+namespace gem {}
\ No newline at end of file
@@ -0,0 +1,171 @@
+#pragma once
+
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+namespace gem {
+	namespace math {
+		constexpr double PI = 3.14159265358979323846;
+
+		// COMPILE-TIME APPROXIMATIONS
+		// -------------------------------
+		// Only used during constant evaluation, where <cmath> is not constexpr.
+		// They work in double and are accurate to a few ulps over the ranges gem uses.
+
+		namespace detail {
+			constexpr double abs(double x) {
+				return x < 0 ? -x : x;
+			}
+
+			constexpr double trunc(double x) {
+				return static_cast<double>(static_cast<long long>(x));
+			}
+
+			constexpr double fmod(double x, double y) {
+				return x - trunc(x / y) * y;
+			}
+
+			constexpr double sqrt(double x) {
+				if (x != x || x < 0) return std::numeric_limits<double>::quiet_NaN();
+				if (x == 0 || x == std::numeric_limits<double>::infinity()) return x;
+
+				// Newton iteration from above decreases monotonically until it converges
+				double curr = x > 1 ? x : 1;
+				while (true) {
+					double next = 0.5 * (curr + x / curr);
+					if (next >= curr) return curr;
+					curr = next;
+				}
+			}
+
+			// Wraps x into [-PI, PI]
+			constexpr double wrapPi(double x) {
+				double k = x / (2 * PI);
+				k = trunc(k < 0 ? k - 0.5 : k + 0.5);
+				return x - k * (2 * PI);
+			}
+
+			constexpr double sin(double x) {
+				double r = wrapPi(x);
+				if (r > PI / 2) r = PI - r;
+				if (r < -PI / 2) r = -PI - r;
+
+				double term = r, sum = r;
+				for (int i = 1; i < 20; ++i) {
+					term *= -r * r / ((2 * i) * (2 * i + 1));
+					sum += term;
+				}
+				return sum;
+			}
+
+			constexpr double cos(double x) {
+				double r = abs(wrapPi(x));
+				double sign = 1;
+				if (r > PI / 2) {
+					r = PI - r;
+					sign = -1;
+				}
+
+				double term = 1, sum = 1;
+				for (int i = 1; i < 20; ++i) {
+					term *= -r * r / ((2 * i - 1) * (2 * i));
+					sum += term;
+				}
+				return sign * sum;
+			}
+
+			constexpr double atan(double x) {
+				if (x != x) return x;
+				if (x < 0) return -atan(-x);
+				if (x > 1) return PI / 2 - atan(1 / x);
+
+				// Two half-angle steps bring x below tan(PI / 16) where the series converges fast
+				x = x / (1 + sqrt(1 + x * x));
+				x = x / (1 + sqrt(1 + x * x));
+
+				double term = x, sum = x;
+				for (int i = 1; i < 30; ++i) {
+					term *= -x * x;
+					sum += term / (2 * i + 1);
+				}
+				return 4 * sum;
+			}
+
+			constexpr double atan2(double y, double x) {
+				if (x > 0) return atan(y / x);
+				if (x < 0) return y < 0 ? atan(y / x) - PI : atan(y / x) + PI;
+				if (y > 0) return PI / 2;
+				if (y < 0) return -PI / 2;
+				return 0;
+			}
+
+			constexpr double acos(double x) {
+				if (x < -1 || x > 1) return std::numeric_limits<double>::quiet_NaN();
+				return atan2(sqrt(1 - x * x), x);
+			}
+
+			constexpr double asin(double x) {
+				if (x < -1 || x > 1) return std::numeric_limits<double>::quiet_NaN();
+				return atan2(x, sqrt(1 - x * x));
+			}
+		}
+
+		// CONSTEXPR MATH FUNCTIONS
+		// -------------------------------
+		// Forward to <cmath> at runtime and to the approximations above during constant evaluation.
+
+		template<typename T>
+		constexpr T abs(T x) {
+			return x < 0 ? -x : x;
+		}
+
+		template<typename T>
+		constexpr T sqrt(T x) {
+			if (std::is_constant_evaluated()) return static_cast<T>(detail::sqrt(static_cast<double>(x)));
+			return static_cast<T>(std::sqrt(x));
+		}
+
+		template<typename T>
+		constexpr T sin(T x) {
+			if (std::is_constant_evaluated()) return static_cast<T>(detail::sin(static_cast<double>(x)));
+			return static_cast<T>(std::sin(x));
+		}
+
+		template<typename T>
+		constexpr T cos(T x) {
+			if (std::is_constant_evaluated()) return static_cast<T>(detail::cos(static_cast<double>(x)));
+			return static_cast<T>(std::cos(x));
+		}
+
+		template<typename T>
+		constexpr T tan(T x) {
+			if (std::is_constant_evaluated()) return static_cast<T>(detail::sin(static_cast<double>(x)) / detail::cos(static_cast<double>(x)));
+			return static_cast<T>(std::tan(x));
+		}
+
+		template<typename T>
+		constexpr T acos(T x) {
+			if (std::is_constant_evaluated()) return static_cast<T>(detail::acos(static_cast<double>(x)));
+			return static_cast<T>(std::acos(x));
+		}
+
+		template<typename T>
+		constexpr T asin(T x) {
+			if (std::is_constant_evaluated()) return static_cast<T>(detail::asin(static_cast<double>(x)));
+			return static_cast<T>(std::asin(x));
+		}
+
+		template<typename T>
+		constexpr T atan2(T y, T x) {
+			if (std::is_constant_evaluated()) return static_cast<T>(detail::atan2(static_cast<double>(y), static_cast<double>(x)));
+			return static_cast<T>(std::atan2(y, x));
+		}
+
+		template<typename T>
+		constexpr T fmod(T x, T y) {
+			if (std::is_constant_evaluated()) return static_cast<T>(detail::fmod(static_cast<double>(x), static_cast<double>(y)));
+			return static_cast<T>(std::fmod(x, y));
+		}
+	}
+}
\ No newline at end of file
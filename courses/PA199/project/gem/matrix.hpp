@@ -4,6 +4,15 @@
 #include <iostream>
 #include <cmath>
 #include <array>
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "math.hpp"
+#include "simd.hpp"
 
 namespace gem {
 	template <typename T, size_t N>
@@ -12,30 +21,122 @@ namespace gem {
 	template <typename T>
 	struct Quaternion; // Forward declaration
 
-	template <typename T>
-	struct Matrix4 {
-		std::array<std::array<T, 4>, 4> data;
+	// STORAGE LAYOUT
+	// -------------------------------
+	// Matrix4 is row-major by default. With GEM_MATRIX_COLUMN_MAJOR defined (the CMake option
+	// GEM_COLUMN_MAJOR) it is stored column-major like OpenGL expects, so values() can be uploaded
+	// or memcpy'd into a uniform buffer without a transpose. Everything else is the same in both
+	// layouts: m(row, col) and m[row][col] always address the same logical element, products and
+	// vectors use the column-vector convention (translation in m(i, 3)).
+	// Every other shape is always row-major, which keeps the rows of a 3x4 affine matrix in packets.
+
+#if defined(GEM_MATRIX_COLUMN_MAJOR)
+	constexpr bool MATRIX_COLUMN_MAJOR = true;
+#else
+	constexpr bool MATRIX_COLUMN_MAJOR = false;
+#endif
+
+	// COMPILE-TIME UNROLLING
+	// -------------------------------
+	// Matrix operators expand into one statement per element at compile time instead of
+	// running loops, the same code the hand-written 4x4 operators used to spell out.
+
+	namespace detail {
+		template<typename F, size_t... I>
+		constexpr void unroll(F&& f, std::index_sequence<I...>) {
+			(f(std::integral_constant<size_t, I>{}), ...);
+		}
 
-		T& operator()(int row, int col) {
-			return data[row][col];
+		// f(0), f(1), ..., f(N - 1) with compile-time indices
+		template<size_t N, typename F>
+		constexpr void unroll(F&& f) {
+			unroll(f, std::make_index_sequence<N>{});
 		}
 
-		const T& operator()(int row, int col) const {
-			return data[row][col];
+		template<typename F, size_t... I>
+		constexpr auto unrolledSum(F&& f, std::index_sequence<I...>) {
+			return (f(std::integral_constant<size_t, I>{}) + ...);
 		}
 
-		T* operator[](int row) {
-			return data[row].data();
+		// f(0) + f(1) + ... + f(N - 1) with compile-time indices
+		template<size_t N, typename F>
+		constexpr auto unrolledSum(F&& f) {
+			return unrolledSum(f, std::make_index_sequence<N>{});
 		}
+	}
+
+	// R x C matrix. The square 2, 3 and 4 shapes have det and inverse, Matrix4 and the affine
+	// Matrix3x4 have the transform factories. Matrix4<float> and Matrix3x4<float> route their
+	// products through the gem::simd kernels, constant evaluation always takes the scalar path.
+	template <typename T, size_t R, size_t C>
+	struct Matrix {
+		static constexpr size_t ROWS = R;
+		static constexpr size_t COLS = C;
+
+		static constexpr bool COLUMN_MAJOR = MATRIX_COLUMN_MAJOR && R == 4 && C == 4;
+		static constexpr bool USE_SIMD = std::is_same_v<T, float>;
+
+		// Three rows of four, the last row of an affine transform (0 0 0 1) is implied
+		static constexpr bool IS_AFFINE = R == 3 && C == 4;
+		static constexpr bool IS_TRANSFORM = (R == 3 || R == 4) && C == 4;
+		static constexpr bool HAS_LINEAR_BLOCK = (R == 3 && C == 3) || IS_TRANSFORM;
+
+		// data[row][col] when row-major, data[col][row] when column-major.
+		// Prefer m(row, col) unless the code is the same for both layouts.
+		static constexpr size_t OUTER = COLUMN_MAJOR ? C : R;
+		static constexpr size_t INNER = COLUMN_MAJOR ? R : C;
+		std::array<std::array<T, INNER>, OUTER> data;
+
+		constexpr T& operator()(int row, int col) {
+			if constexpr (COLUMN_MAJOR) return data[col][row];
+			else return data[row][col];
+		}
+
+		constexpr const T& operator()(int row, int col) const {
+			if constexpr (COLUMN_MAJOR) return data[col][row];
+			else return data[row][col];
+		}
+
+		// m[row][col], independent of the layout
+		struct RowRef {
+			Matrix* matrix;
+			int row;
+
+			constexpr T& operator[](int col) const { return (*matrix)(row, col); }
+		};
+
+		struct ConstRowRef {
+			const Matrix* matrix;
+			int row;
 
-		Matrix4() = default;
+			constexpr const T& operator[](int col) const { return (*matrix)(row, col); }
+		};
+
+		constexpr RowRef operator[](int row) {
+			return RowRef{ this, row };
+		}
+
+		constexpr ConstRowRef operator[](int row) const {
+			return ConstRowRef{ this, row };
+		}
+
+		// The R * C values in storage order, e.g. for glUniformMatrix4fv with transpose = !COLUMN_MAJOR
+		constexpr T* values() {
+			return &data[0][0];
+		}
+
+		constexpr const T* values() const {
+			return &data[0][0];
+		}
 
-		Matrix4(std::initializer_list<std::initializer_list<T>> list) {
+		constexpr Matrix() = default;
+
+		constexpr Matrix(std::initializer_list<std::initializer_list<T>> list) : data{} {
 			size_t i = 0;
 			for (auto& row : list) {
 				size_t j = 0;
 				for (auto& val : row) {
-					data[i][j++] = val;
+					(*this)(static_cast<int>(i), static_cast<int>(j++)) = val;
 				}
 				++i;
 			}
@@ -44,71 +145,63 @@ namespace gem {
 		// MATRIX DEFINITIONS
 		// -------------------------------
 
-		static Matrix4 identity() {
-			Matrix4<T> result = {};
-
-			result.data[0][0] = 1; result.data[0][1] = 0; result.data[0][2] = 0; result.data[0][3] = 0;
-			result.data[1][0] = 0; result.data[1][1] = 1; result.data[1][2] = 0; result.data[1][3] = 0;
-			result.data[2][0] = 0; result.data[2][1] = 0; result.data[2][2] = 1; result.data[2][3] = 0;
-			result.data[3][0] = 0; result.data[3][1] = 0; result.data[3][2] = 0; result.data[3][3] = 1;
-
+		// Ones on the main diagonal, also for the affine 3x4 (no rotation, no translation)
+		static constexpr Matrix identity() {
+			Matrix result = zero();
+			detail::unroll<(R < C ? R : C)>([&](auto i) { result(i, i) = 1; });
 			return result;
 		}
 
-		static Matrix4 zero() {
-			Matrix4<T> result = {};
-			result.data[0][0] = 0; result.data[0][1] = 0; result.data[0][2] = 0; result.data[0][3] = 0;
-			result.data[1][0] = 0; result.data[1][1] = 0; result.data[1][2] = 0; result.data[1][3] = 0;
-			result.data[2][0] = 0; result.data[2][1] = 0; result.data[2][2] = 0; result.data[2][3] = 0;
-			result.data[3][0] = 0; result.data[3][1] = 0; result.data[3][2] = 0; result.data[3][3] = 0;
-			return result;
+		// Value-initialization zeroes all entries without a runtime loop
+		static constexpr Matrix zero() {
+			return Matrix{};
 		}
 
-		static Matrix4 translation(const Vector<T, 3>& v) {
-			Matrix4<T> result = identity();
-			result.data[0][3] = v[0];
-			result.data[1][3] = v[1];
-			result.data[2][3] = v[2];
+		static constexpr Matrix translation(const Vector<T, 3>& v) requires IS_TRANSFORM {
+			Matrix result = identity();
+			result(0, 3) = v[0];
+			result(1, 3) = v[1];
+			result(2, 3) = v[2];
 			return result;
 		}
 
-		static Matrix4 scale(const Vector<T, 3>& v) {
-			Matrix4<T> result = identity();
-			result.data[0][0] = v[0];
-			result.data[1][1] = v[1];
-			result.data[2][2] = v[2];
+		static constexpr Matrix scale(const Vector<T, 3>& v) requires HAS_LINEAR_BLOCK {
+			Matrix result = identity();
+			result(0, 0) = v[0];
+			result(1, 1) = v[1];
+			result(2, 2) = v[2];
 			return result;
 		}
 
-		static Matrix4 rotationX(T angle) {
-			Matrix4<T> result = identity();
-			T c = std::cos(angle);
-			T s = std::sin(angle);
-			result.data[1][1] = c;  result.data[1][2] = -s;
-			result.data[2][1] = s;  result.data[2][2] = c;
+		static constexpr Matrix rotationX(T angle) requires HAS_LINEAR_BLOCK {
+			Matrix result = identity();
+			T c = math::cos(angle);
+			T s = math::sin(angle);
+			result(1, 1) = c;  result(1, 2) = -s;
+			result(2, 1) = s;  result(2, 2) = c;
 			return result;
 		}
 
-		static Matrix4 rotationY(T angle) {
-			Matrix4<T> result = identity();
-			T c = std::cos(angle);
-			T s = std::sin(angle);
-			result.data[0][0] = c;  result.data[0][2] = s;
-			result.data[2][0] = -s; result.data[2][2] = c;
+		static constexpr Matrix rotationY(T angle) requires HAS_LINEAR_BLOCK {
+			Matrix result = identity();
+			T c = math::cos(angle);
+			T s = math::sin(angle);
+			result(0, 0) = c;  result(0, 2) = s;
+			result(2, 0) = -s; result(2, 2) = c;
 			return result;
 		}
 
-		static Matrix4 rotationZ(T angle) {
-			Matrix4<T> result = identity();
-			T c = std::cos(angle);
-			T s = std::sin(angle);
-			result.data[0][0] = c;  result.data[0][1] = -s;
-			result.data[1][0] = s;  result.data[1][1] = c;
+		static constexpr Matrix rotationZ(T angle) requires HAS_LINEAR_BLOCK {
+			Matrix result = identity();
+			T c = math::cos(angle);
+			T s = math::sin(angle);
+			result(0, 0) = c;  result(0, 1) = -s;
+			result(1, 0) = s;  result(1, 1) = c;
 			return result;
 		}
 
-		static Matrix4 rotation(const Quaternion<T>& q) {
-			Matrix4<T> result = identity();
+		static constexpr Matrix rotation(const Quaternion<T>& q) requires HAS_LINEAR_BLOCK {
+			Matrix result = identity();
 
 			T xx = q.x() * q.x();
 			T yy = q.y() * q.y();
@@ -120,352 +213,460 @@ namespace gem {
 			T wy = q.w() * q.y();
 			T wz = q.w() * q.z();
 
-			result.data[0][0] = 1 - 2 * (yy + zz);
-			result.data[0][1] = 2 * (xy - wz);
-			result.data[0][2] = 2 * (xz + wy);
-			result.data[1][0] = 2 * (xy + wz);
-			result.data[1][1] = 1 - 2 * (xx + zz);
-			result.data[1][2] = 2 * (yz - wx);
-			result.data[2][0] = 2 * (xz - wy);
-			result.data[2][1] = 2 * (yz + wx);
-			result.data[2][2] = 1 - 2 * (xx + yy);
+			result(0, 0) = 1 - 2 * (yy + zz);
+			result(0, 1) = 2 * (xy - wz);
+			result(0, 2) = 2 * (xz + wy);
+			result(1, 0) = 2 * (xy + wz);
+			result(1, 1) = 1 - 2 * (xx + zz);
+			result(1, 2) = 2 * (yz - wx);
+			result(2, 0) = 2 * (xz - wy);
+			result(2, 1) = 2 * (yz + wx);
+			result(2, 2) = 1 - 2 * (xx + yy);
 
 			return result;
 		}
 
-		// ADDITION OPERATORS
-		// -------------------------------
-
-		Matrix4<T> operator+(const Matrix4<T>& other) const {
-			Matrix4<T> result;
+		// Rotation matrices for many quaternions, e.g. all model matrices of a frame.
+		// For float four quaternions are converted per SIMD step.
+		static void rotation(const std::vector<Quaternion<T>>& quaternions, std::vector<Matrix>& out) requires (R == 4 && C == 4) {
+			out.resize(quaternions.size());
 
-			result.data[0][0] = data[0][0] + other.data[0][0];
-			result.data[0][1] = data[0][1] + other.data[0][1];
-			result.data[0][2] = data[0][2] + other.data[0][2];
-			result.data[0][3] = data[0][3] + other.data[0][3];
-
-			result.data[1][0] = data[1][0] + other.data[1][0];
-			result.data[1][1] = data[1][1] + other.data[1][1];
-			result.data[1][2] = data[1][2] + other.data[1][2];
-			result.data[1][3] = data[1][3] + other.data[1][3];
+			size_t i = 0;
+			if constexpr (USE_SIMD) {
+				static_assert(sizeof(Quaternion<T>) == 4 * sizeof(T) && sizeof(Matrix) == 16 * sizeof(T));
+				for (; i + 4 <= quaternions.size(); i += 4) {
+					simd::quat4ToMat4<COLUMN_MAJOR>(&quaternions[i].data[0], out[i].values());
+				}
+			}
+			for (; i < quaternions.size(); ++i) {
+				out[i] = rotation(quaternions[i]);
+			}
+		}
 
-			result.data[2][0] = data[2][0] + other.data[2][0];
-			result.data[2][1] = data[2][1] + other.data[2][1];
-			result.data[2][2] = data[2][2] + other.data[2][2];
-			result.data[2][3] = data[2][3] + other.data[2][3];
+		// ELEMENT-WISE OPERATORS
+		// -------------------------------
+		// Element-wise results do not depend on the layout, so these walk the stored array
 
-			result.data[3][0] = data[3][0] + other.data[3][0];
-			result.data[3][1] = data[3][1] + other.data[3][1];
-			result.data[3][2] = data[3][2] + other.data[3][2];
-			result.data[3][3] = data[3][3] + other.data[3][3];
+		constexpr Matrix operator+(const Matrix& other) const {
+			return zip(other, [](T a, T b) { return a + b; });
+		}
 
-			return result;
+		constexpr Matrix operator+(T scalar) const {
+			return map([scalar](T a) { return a + scalar; });
 		}
 
-		Matrix4<T> operator+(T scalar) const {
-			Matrix4<T> result;
+		friend constexpr Matrix operator+(T scalar, const Matrix& mat) {
+			return mat + scalar;
+		}
 
-			result.data[0][0] = data[0][0] + scalar;
-			result.data[0][1] = data[0][1] + scalar;
-			result.data[0][2] = data[0][2] + scalar;
-			result.data[0][3] = data[0][3] + scalar;
+		constexpr Matrix operator-(const Matrix& other) const {
+			return zip(other, [](T a, T b) { return a - b; });
+		}
 
-			result.data[1][0] = data[1][0] + scalar;
-			result.data[1][1] = data[1][1] + scalar;
-			result.data[1][2] = data[1][2] + scalar;
-			result.data[1][3] = data[1][3] + scalar;
+		constexpr Matrix operator-(T scalar) const {
+			return map([scalar](T a) { return a - scalar; });
+		}
 
-			result.data[2][0] = data[2][0] + scalar;
-			result.data[2][1] = data[2][1] + scalar;
-			result.data[2][2] = data[2][2] + scalar;
-			result.data[2][3] = data[2][3] + scalar;
+		friend constexpr Matrix operator-(T scalar, const Matrix& mat) {
+			return mat.map([scalar](T a) { return scalar - a; });
+		}
 
-			result.data[3][0] = data[3][0] + scalar;
-			result.data[3][1] = data[3][1] + scalar;
-			result.data[3][2] = data[3][2] + scalar;
-			result.data[3][3] = data[3][3] + scalar;
+		constexpr Matrix operator*(T scalar) const {
+			return map([scalar](T a) { return a * scalar; });
+		}
 
-			return result;
+		friend constexpr Matrix operator*(T scalar, const Matrix& mat) {
+			return mat * scalar;
 		}
 
-		friend Matrix4<T> operator+(T scalar, const Matrix4<T>& mat) {
-			return mat + scalar;
+		constexpr Matrix operator-() const {
+			return map([](T a) { return -a; });
 		}
 
-		// SUBTRACTION OPERATORS
-		// --------------------------------
+		constexpr Matrix negate() const {
+			return -*this;
+		}
 
-		Matrix4<T> operator-(const Matrix4<T>& other) const {
-			Matrix4<T> result;
+		// PRODUCT OPERATORS
+		// -------------------------------
 
-			result.data[0][0] = data[0][0] - other.data[0][0];
-			result.data[0][1] = data[0][1] - other.data[0][1];
-			result.data[0][2] = data[0][2] - other.data[0][2];
-			result.data[0][3] = data[0][3] - other.data[0][3];
+		template<size_t K>
+		constexpr Matrix<T, R, K> operator*(const Matrix<T, C, K>& other) const {
+			Matrix<T, R, K> result;
+
+			if constexpr (USE_SIMD && R == 4 && C == 4 && K == 4) {
+				if (!std::is_constant_evaluated()) {
+					// Column-major data holds the transposes, and transpose(a * b) = transpose(b) * transpose(a),
+					// so the same row-major product of the stored arrays works with the operands swapped
+					const auto& a = COLUMN_MAJOR ? other.data : data;
+					const auto& b = COLUMN_MAJOR ? data : other.data;
+					simd::mat4Mul(&a[0][0], &b[0][0], &result.data[0][0]);
+					return result;
+				}
+			}
 
-			result.data[1][0] = data[1][0] - other.data[1][0];
-			result.data[1][1] = data[1][1] - other.data[1][1];
-			result.data[1][2] = data[1][2] - other.data[1][2];
-			result.data[1][3] = data[1][3] - other.data[1][3];
+			detail::unroll<R * K>([&](auto index) {
+				constexpr int i = static_cast<int>(index / K), j = static_cast<int>(index % K);
+				result(i, j) = detail::unrolledSum<C>([&](auto k) { return (*this)(i, static_cast<int>(k)) * other(static_cast<int>(k), j); });
+			});
+			return result;
+		}
 
-			result.data[2][0] = data[2][0] - other.data[2][0];
-			result.data[2][1] = data[2][1] - other.data[2][1];
-			result.data[2][2] = data[2][2] - other.data[2][2];
-			result.data[2][3] = data[2][3] - other.data[2][3];
+		// Composition of two affine transforms, the product of the 4x4 matrices they stand for
+		constexpr Matrix operator*(const Matrix& other) const requires IS_AFFINE {
+			Matrix result;
 
-			result.data[3][0] = data[3][0] - other.data[3][0];
-			result.data[3][1] = data[3][1] - other.data[3][1];
-			result.data[3][2] = data[3][2] - other.data[3][2];
-			result.data[3][3] = data[3][3] - other.data[3][3];
+			if constexpr (USE_SIMD) {
+				if (!std::is_constant_evaluated()) {
+					simd::affineMul(values(), other.values(), result.values());
+					return result;
+				}
+			}
 
+			detail::unroll<12>([&](auto index) {
+				constexpr int i = static_cast<int>(index / 4), j = static_cast<int>(index % 4);
+				T sum = (*this)(i, 0) * other(0, j) + (*this)(i, 1) * other(1, j) + (*this)(i, 2) * other(2, j);
+				result(i, j) = j == 3 ? sum + (*this)(i, 3) : sum;
+			});
 			return result;
 		}
 
-		Matrix4<T> operator-(T scalar) const {
-			Matrix4<T> result;
+		constexpr Vector<T, R> operator*(const Vector<T, C>& v) const {
+			Vector<T, R> result;
 
-			result.data[0][0] = data[0][0] - scalar;
-			result.data[0][1] = data[0][1] - scalar;
-			result.data[0][2] = data[0][2] - scalar;
-			result.data[0][3] = data[0][3] - scalar;
+			if constexpr (USE_SIMD && R == 4 && C == 4) {
+				if (!std::is_constant_evaluated()) {
+					// Column-major data is a sum of the stored columns scaled by v
+					if constexpr (COLUMN_MAJOR) simd::vec4MulMat4(v.data, &data[0][0], result.data);
+					else simd::mat4MulVec4(&data[0][0], v.data, result.data);
+					return result;
+				}
+			}
 
-			result.data[1][0] = data[1][0] - scalar;
-			result.data[1][1] = data[1][1] - scalar;
-			result.data[1][2] = data[1][2] - scalar;
-			result.data[1][3] = data[1][3] - scalar;
+			detail::unroll<R>([&](auto i) {
+				result.data[i] = detail::unrolledSum<C>([&](auto k) { return (*this)(static_cast<int>(i), static_cast<int>(k)) * v[k]; });
+			});
+			return result;
+		}
 
-			result.data[2][0] = data[2][0] - scalar;
-			result.data[2][1] = data[2][1] - scalar;
-			result.data[2][2] = data[2][2] - scalar;
-			result.data[2][3] = data[2][3] - scalar;
+		friend constexpr Vector<T, C> operator*(const Vector<T, R>& v, const Matrix& mat) {
+			Vector<T, C> result;
 
-			result.data[3][0] = data[3][0] - scalar;
-			result.data[3][1] = data[3][1] - scalar;
-			result.data[3][2] = data[3][2] - scalar;
-			result.data[3][3] = data[3][3] - scalar;
+			if constexpr (USE_SIMD && R == 4 && C == 4) {
+				if (!std::is_constant_evaluated()) {
+					if constexpr (COLUMN_MAJOR) simd::mat4MulVec4(&mat.data[0][0], v.data, result.data);
+					else simd::vec4MulMat4(v.data, &mat.data[0][0], result.data);
+					return result;
+				}
+			}
 
+			detail::unroll<C>([&](auto j) {
+				result.data[j] = detail::unrolledSum<R>([&](auto k) { return v[k] * mat(static_cast<int>(k), static_cast<int>(j)); });
+			});
 			return result;
 		}
 
-		friend Matrix4<T> operator-(T scalar, const Matrix4<T>& other) {
-			Matrix4<T> result;
+		// Points get the translation, vectors (directions) only the linear block
+		constexpr Vector<T, 3> transformPoint(const Vector<T, 3>& p) const requires IS_TRANSFORM {
+			Vector<T, 3> result;
+			detail::unroll<3>([&](auto i) {
+				const int row = static_cast<int>(i);
+				result.data[i] = (*this)(row, 0) * p[0] + (*this)(row, 1) * p[1] + (*this)(row, 2) * p[2] + (*this)(row, 3);
+			});
+			return result;
+		}
 
-			result.data[0][0] = scalar - other.data[0][0];
-			result.data[0][1] = scalar - other.data[0][1];
-			result.data[0][2] = scalar - other.data[0][2];
-			result.data[0][3] = scalar - other.data[0][3];
+		constexpr Vector<T, 3> transformVector(const Vector<T, 3>& v) const requires IS_TRANSFORM {
+			Vector<T, 3> result;
+			detail::unroll<3>([&](auto i) {
+				const int row = static_cast<int>(i);
+				result.data[i] = (*this)(row, 0) * v[0] + (*this)(row, 1) * v[1] + (*this)(row, 2) * v[2];
+			});
+			return result;
+		}
 
-			result.data[1][0] = scalar - other.data[1][0];
-			result.data[1][1] = scalar - other.data[1][1];
-			result.data[1][2] = scalar - other.data[1][2];
-			result.data[1][3] = scalar - other.data[1][3];
+		// TRANSPOSITION FUNCTION
+		// -------------------------------
 
-			result.data[2][0] = scalar - other.data[2][0];
-			result.data[2][1] = scalar - other.data[2][1];
-			result.data[2][2] = scalar - other.data[2][2];
-			result.data[2][3] = scalar - other.data[2][3];
+		constexpr Matrix<T, C, R> transpose() const {
+			Matrix<T, C, R> result;
 
-			result.data[3][0] = scalar - other.data[3][0];
-			result.data[3][1] = scalar - other.data[3][1];
-			result.data[3][2] = scalar - other.data[3][2];
-			result.data[3][3] = scalar - other.data[3][3];
+			if constexpr (USE_SIMD && R == 4 && C == 4) {
+				if (!std::is_constant_evaluated()) {
+					// Transposing the stored array is the same operation in both layouts
+					simd::mat4Transpose(&data[0][0], &result.data[0][0]);
+					return result;
+				}
+			}
 
+			detail::unroll<R * C>([&](auto index) {
+				constexpr int i = static_cast<int>(index / C), j = static_cast<int>(index % C);
+				result(j, i) = (*this)(i, j);
+			});
 			return result;
 		}
 
-		// MULTIPLICATION OPERATORS
-		// --------------------------------
+		// DETERMINANT FUNCTION
+		// -------------------------------
+		// det and inverse read the stored array directly: det(transpose(m)) = det(m) and
+		// inverse(transpose(m)) = transpose(inverse(m)), so they are correct in both layouts
 
-		Matrix4<T> operator*(const Matrix4<T>& other) const {
-			Matrix4<T> result;
+		constexpr T det() const requires (R == C && R >= 2 && R <= 4) {
+			if constexpr (R == 2) {
+				return data[0][0] * data[1][1] - data[0][1] * data[1][0];
+			}
+			else if constexpr (R == 3) {
+				const T& a = data[0][0], b = data[0][1], c = data[0][2];
+				const T& d = data[1][0], e = data[1][1], f = data[1][2];
+				const T& g = data[2][0], h = data[2][1], i = data[2][2];
+
+				return a * (e * i - f * h) - b * (d * i - f * g) + c * (d * h - e * g);
+			}
+			else {
+				const T& a = data[0][0], b = data[0][1], c = data[0][2], d = data[0][3];
+				const T& e = data[1][0], f = data[1][1], g = data[1][2], h = data[1][3];
+				const T& i = data[2][0], j = data[2][1], k = data[2][2], l = data[2][3];
+				const T& m = data[3][0], n = data[3][1], o = data[3][2], p = data[3][3];
+
+				return
+					a * (f * (k * p - l * o) - g * (j * p - l * n) + h * (j * o - k * n)) -
+					b * (e * (k * p - l * o) - g * (i * p - l * m) + h * (i * o - k * m)) +
+					c * (e * (j * p - l * n) - f * (i * p - l * m) + h * (i * n - j * m)) -
+					d * (e * (j * o - k * n) - f * (i * o - k * m) + g * (i * n - j * m));
+			}
+		}
 
-			result.data[0][0] = data[0][0] * other.data[0][0] + data[0][1] * other.data[1][0] + data[0][2] * other.data[2][0] + data[0][3] * other.data[3][0];
-			result.data[0][1] = data[0][0] * other.data[0][1] + data[0][1] * other.data[1][1] + data[0][2] * other.data[2][1] + data[0][3] * other.data[3][1];
-			result.data[0][2] = data[0][0] * other.data[0][2] + data[0][1] * other.data[1][2] + data[0][2] * other.data[2][2] + data[0][3] * other.data[3][2];
-			result.data[0][3] = data[0][0] * other.data[0][3] + data[0][1] * other.data[1][3] + data[0][2] * other.data[2][3] + data[0][3] * other.data[3][3];
+		// Matrix of cofactors, cofactor(i, j) = (-1)^(i + j) * minor(i, j).
+		// transpose(cofactor()) / det() is the inverse and cofactor() / det() the inverse transpose.
+		constexpr Matrix cofactor() const requires (R == 3 && C == 3) {
+			const T& a = data[0][0], b = data[0][1], c = data[0][2];
+			const T& d = data[1][0], e = data[1][1], f = data[1][2];
+			const T& g = data[2][0], h = data[2][1], i = data[2][2];
 
-			result.data[1][0] = data[1][0] * other.data[0][0] + data[1][1] * other.data[1][0] + data[1][2] * other.data[2][0] + data[1][3] * other.data[3][0];
-			result.data[1][1] = data[1][0] * other.data[0][1] + data[1][1] * other.data[1][1] + data[1][2] * other.data[2][1] + data[1][3] * other.data[3][1];
-			result.data[1][2] = data[1][0] * other.data[0][2] + data[1][1] * other.data[1][2] + data[1][2] * other.data[2][2] + data[1][3] * other.data[3][2];
-			result.data[1][3] = data[1][0] * other.data[0][3] + data[1][1] * other.data[1][3] + data[1][2] * other.data[2][3] + data[1][3] * other.data[3][3];
+			Matrix result;
 
-			result.data[2][0] = data[2][0] * other.data[0][0] + data[2][1] * other.data[1][0] + data[2][2] * other.data[2][0] + data[2][3] * other.data[3][0];
-			result.data[2][1] = data[2][0] * other.data[0][1] + data[2][1] * other.data[1][1] + data[2][2] * other.data[2][1] + data[2][3] * other.data[3][1];
-			result.data[2][2] = data[2][0] * other.data[0][2] + data[2][1] * other.data[1][2] + data[2][2] * other.data[2][2] + data[2][3] * other.data[3][2];
-			result.data[2][3] = data[2][0] * other.data[0][3] + data[2][1] * other.data[1][3] + data[2][2] * other.data[2][3] + data[2][3] * other.data[3][3];
+			result.data[0][0] = e * i - f * h;
+			result.data[0][1] = f * g - d * i;
+			result.data[0][2] = d * h - e * g;
 
-			result.data[3][0] = data[3][0] * other.data[0][0] + data[3][1] * other.data[1][0] + data[3][2] * other.data[2][0] + data[3][3] * other.data[3][0];
-			result.data[3][1] = data[3][0] * other.data[0][1] + data[3][1] * other.data[1][1] + data[3][2] * other.data[2][1] + data[3][3] * other.data[3][1];
-			result.data[3][2] = data[3][0] * other.data[0][2] + data[3][1] * other.data[1][2] + data[3][2] * other.data[2][2] + data[3][3] * other.data[3][2];
-			result.data[3][3] = data[3][0] * other.data[0][3] + data[3][1] * other.data[1][3] + data[3][2] * other.data[2][3] + data[3][3] * other.data[3][3];
+			result.data[1][0] = c * h - b * i;
+			result.data[1][1] = a * i - c * g;
+			result.data[1][2] = b * g - a * h;
+
+			result.data[2][0] = b * f - c * e;
+			result.data[2][1] = c * d - a * f;
+			result.data[2][2] = a * e - b * d;
 
 			return result;
 		}
 
-		Matrix4<T> operator*(T scalar) const {
-			Matrix4<T> result;
+		// INVERSE FUNCTIONS
+		// -------------------------------
 
-			result.data[0][0] = data[0][0] * scalar;
-			result.data[0][1] = data[0][1] * scalar;
-			result.data[0][2] = data[0][2] * scalar;
-			result.data[0][3] = data[0][3] * scalar;
+		constexpr Matrix inverse() const requires (R == C && R >= 2 && R <= 4) {
+			if constexpr (R == 2) {
+				T determinant = det();
+				if (determinant == 0) {
+					throw std::runtime_error("Matrix is not invertible");
+				}
 
-			result.data[1][0] = data[1][0] * scalar;
-			result.data[1][1] = data[1][1] * scalar;
-			result.data[1][2] = data[1][2] * scalar;
-			result.data[1][3] = data[1][3] * scalar;
+				T invDet = 1 / determinant;
+				Matrix result;
+				result.data[0][0] = data[1][1] * invDet;
+				result.data[0][1] = -data[0][1] * invDet;
+				result.data[1][0] = -data[1][0] * invDet;
+				result.data[1][1] = data[0][0] * invDet;
+				return result;
+			}
+			else if constexpr (R == 3) {
+				Matrix cof = cofactor();
 
-			result.data[2][0] = data[2][0] * scalar;
-			result.data[2][1] = data[2][1] * scalar;
-			result.data[2][2] = data[2][2] * scalar;
-			result.data[2][3] = data[2][3] * scalar;
+				T determinant = data[0][0] * cof.data[0][0] + data[0][1] * cof.data[0][1] + data[0][2] * cof.data[0][2];
+				if (determinant == 0) {
+					throw std::runtime_error("Matrix is not invertible");
+				}
 
-			result.data[3][0] = data[3][0] * scalar;
-			result.data[3][1] = data[3][1] * scalar;
-			result.data[3][2] = data[3][2] * scalar;
-			result.data[3][3] = data[3][3] * scalar;
+				return cof.transpose() * (1 / determinant);
+			}
+			else {
+				const T& a = data[0][0], b = data[0][1], c = data[0][2], d = data[0][3];
+				const T& e = data[1][0], f = data[1][1], g = data[1][2], h = data[1][3];
+				const T& i = data[2][0], j = data[2][1], k = data[2][2], l = data[2][3];
+				const T& m = data[3][0], n = data[3][1], o = data[3][2], p = data[3][3];
+
+				// 2x2 sub-determinants of the upper and lower row pairs
+				T s0 = a * f - e * b, s1 = a * g - e * c, s2 = a * h - e * d;
+				T s3 = b * g - f * c, s4 = b * h - f * d, s5 = c * h - g * d;
+				T c0 = i * n - m * j, c1 = i * o - m * k, c2 = i * p - m * l;
+				T c3 = j * o - n * k, c4 = j * p - n * l, c5 = k * p - o * l;
+
+				T determinant = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+				if (determinant == 0) {
+					throw std::runtime_error("Matrix is not invertible");
+				}
 
-			return result;
-		}
+				T invDet = 1 / determinant;
+				Matrix result;
 
-		friend Matrix4<T> operator*(T scalar, const Matrix4<T>& mat) {
-			return mat * scalar;
-		}
+				result.data[0][0] = (f * c5 - g * c4 + h * c3) * invDet;
+				result.data[0][1] = (c * c4 - b * c5 - d * c3) * invDet;
+				result.data[0][2] = (n * s5 - o * s4 + p * s3) * invDet;
+				result.data[0][3] = (k * s4 - j * s5 - l * s3) * invDet;
 
-		Vector<T, 4> operator*(const Vector<T, 4>& v) const {
-			Vector<T, 4> result;
+				result.data[1][0] = (g * c2 - e * c5 - h * c1) * invDet;
+				result.data[1][1] = (a * c5 - c * c2 + d * c1) * invDet;
+				result.data[1][2] = (o * s2 - m * s5 - p * s1) * invDet;
+				result.data[1][3] = (i * s5 - k * s2 + l * s1) * invDet;
 
-			result.data[0] = data[0][0] * v[0] + data[0][1] * v[1] + data[0][2] * v[2] + data[0][3] * v[3];
-			result.data[1] = data[1][0] * v[0] + data[1][1] * v[1] + data[1][2] * v[2] + data[1][3] * v[3];
-			result.data[2] = data[2][0] * v[0] + data[2][1] * v[1] + data[2][2] * v[2] + data[2][3] * v[3];
-			result.data[3] = data[3][0] * v[0] + data[3][1] * v[1] + data[3][2] * v[2] + data[3][3] * v[3];
-			
-			return result;
+				result.data[2][0] = (e * c4 - f * c2 + h * c0) * invDet;
+				result.data[2][1] = (b * c2 - a * c4 - d * c0) * invDet;
+				result.data[2][2] = (m * s4 - n * s2 + p * s0) * invDet;
+				result.data[2][3] = (j * s2 - i * s4 - l * s0) * invDet;
+
+				result.data[3][0] = (f * c1 - e * c3 - g * c0) * invDet;
+				result.data[3][1] = (a * c3 - b * c1 + c * c0) * invDet;
+				result.data[3][2] = (n * s1 - m * s3 - o * s0) * invDet;
+				result.data[3][3] = (i * s3 - j * s1 + k * s0) * invDet;
+
+				return result;
+			}
 		}
 
-		friend Vector<T, 4> operator*(const Vector<T, 4>& v, const Matrix4<T>& mat) {
-			Vector<T, 4> result;
-			result.data[0] = v[0] * mat.data[0][0] + v[1] * mat.data[1][0] + v[2] * mat.data[2][0] + v[3] * mat.data[3][0];
-			result.data[1] = v[0] * mat.data[0][1] + v[1] * mat.data[1][1] + v[2] * mat.data[2][1] + v[3] * mat.data[3][1];
-			result.data[2] = v[0] * mat.data[0][2] + v[1] * mat.data[1][2] + v[2] * mat.data[2][2] + v[3] * mat.data[3][2];
-			result.data[3] = v[0] * mat.data[0][3] + v[1] * mat.data[1][3] + v[2] * mat.data[2][3] + v[3] * mat.data[3][3];
-			return result;
+		// The inverse of the affine transform, see affineInverse()
+		constexpr Matrix inverse() const requires IS_AFFINE {
+			return affineInverse();
 		}
 
-		// NEGATION OPERATOR & FUNCTION
-		// -------------------------------
+		// transpose(inverse()) in one step, the matrix that maps normals when this maps points
+		constexpr Matrix inverseTranspose() const requires (R == 3 && C == 3) {
+			Matrix cof = cofactor();
 
-		Matrix4<T> operator-() const {
-			Matrix4<T> result;
+			T determinant = data[0][0] * cof.data[0][0] + data[0][1] * cof.data[0][1] + data[0][2] * cof.data[0][2];
+			if (determinant == 0) {
+				throw std::runtime_error("Matrix is not invertible");
+			}
 
-			result.data[0][0] = -data[0][0];
-			result.data[0][1] = -data[0][1];
-			result.data[0][2] = -data[0][2];
-			result.data[0][3] = -data[0][3];
+			return cof * (1 / determinant);
+		}
 
-			result.data[1][0] = -data[1][0];
-			result.data[1][1] = -data[1][1];
-			result.data[1][2] = -data[1][2];
-			result.data[1][3] = -data[1][3];
+		// 3x3 BLOCK AND AFFINE FUNCTIONS
+		// -------------------------------
 
-			result.data[2][0] = -data[2][0];
-			result.data[2][1] = -data[2][1];
-			result.data[2][2] = -data[2][2];
-			result.data[2][3] = -data[2][3];
+		// Upper-left 3x3 block, the rotation and scale part of an affine matrix
+		constexpr Matrix<T, 3, 3> toMatrix3() const requires IS_TRANSFORM {
+			Matrix<T, 3, 3> result;
+			detail::unroll<9>([&](auto index) {
+				constexpr int i = static_cast<int>(index / 3), j = static_cast<int>(index % 3);
+				result(i, j) = (*this)(i, j);
+			});
+			return result;
+		}
 
-			result.data[3][0] = -data[3][0];
-			result.data[3][1] = -data[3][1];
-			result.data[3][2] = -data[3][2];
-			result.data[3][3] = -data[3][3];
+		// transpose(inverse(upper-left 3x3)), which keeps normals perpendicular to surfaces under
+		// non-uniform scale. Equal to mat3(transpose(inverse(model))) in GLSL, once per object on
+		// the CPU instead of once per vertex in the shader.
+		constexpr Matrix<T, 3, 3> normalMatrix() const requires IS_TRANSFORM {
+			return toMatrix3().inverseTranspose();
+		}
 
+		// The upper three rows, dropping the last row of an affine Matrix4
+		constexpr Matrix<T, 3, 4> toAffine() const requires (R == 4 && C == 4) {
+			Matrix<T, 3, 4> result;
+			detail::unroll<12>([&](auto index) {
+				constexpr int i = static_cast<int>(index / 4), j = static_cast<int>(index % 4);
+				result(i, j) = (*this)(i, j);
+			});
 			return result;
 		}
 
-		Matrix4<T> negate() const {
-			return -*this;
+		// The full 4x4 matrix with the implied last row 0 0 0 1
+		constexpr Matrix<T, 4, 4> toMatrix4() const requires IS_AFFINE {
+			Matrix<T, 4, 4> result = Matrix<T, 4, 4>::identity();
+			detail::unroll<12>([&](auto index) {
+				constexpr int i = static_cast<int>(index / 4), j = static_cast<int>(index % 4);
+				result(i, j) = (*this)(i, j);
+			});
+			return result;
 		}
 
-		// TRANSPOSITION FUNCTION
-		// -------------------------------
+		// Inverse of an affine matrix (last row 0 0 0 1). Only the upper 3x3 block is inverted
+		// and the translation is mapped back through it, instead of the full 4x4 cofactor expansion.
+		constexpr Matrix affineInverse() const requires IS_TRANSFORM {
+			const T& a = (*this)(0, 0), b = (*this)(0, 1), c = (*this)(0, 2);
+			const T& d = (*this)(1, 0), e = (*this)(1, 1), f = (*this)(1, 2);
+			const T& g = (*this)(2, 0), h = (*this)(2, 1), i = (*this)(2, 2);
 
-		Matrix4<T> transpose() const {
-			Matrix4<T> result;
+			T c00 = e * i - f * h;
+			T c01 = f * g - d * i;
+			T c02 = d * h - e * g;
 
-			result.data[0][0] = data[0][0];
-			result.data[0][1] = data[1][0];
-			result.data[0][2] = data[2][0];
-			result.data[0][3] = data[3][0];
+			T determinant = a * c00 + b * c01 + c * c02;
+			if (determinant == 0) {
+				throw std::runtime_error("Matrix is not invertible");
+			}
 
-			result.data[1][0] = data[0][1];
-			result.data[1][1] = data[1][1];
-			result.data[1][2] = data[2][1];
-			result.data[1][3] = data[3][1];
+			T invDet = 1 / determinant;
+			Matrix result;
 
-			result.data[2][0] = data[0][2];
-			result.data[2][1] = data[1][2];
-			result.data[2][2] = data[2][2];
-			result.data[2][3] = data[3][2];
+			result(0, 0) = c00 * invDet;
+			result(0, 1) = (c * h - b * i) * invDet;
+			result(0, 2) = (b * f - c * e) * invDet;
 
-			result.data[3][0] = data[0][3];
-			result.data[3][1] = data[1][3];
-			result.data[3][2] = data[2][3];
-			result.data[3][3] = data[3][3];
+			result(1, 0) = c01 * invDet;
+			result(1, 1) = (a * i - c * g) * invDet;
+			result(1, 2) = (c * d - a * f) * invDet;
 
-			return result;
-		}
+			result(2, 0) = c02 * invDet;
+			result(2, 1) = (b * g - a * h) * invDet;
+			result(2, 2) = (a * e - b * d) * invDet;
 
-		// DETERMINANT FUNCTION
-		// -------------------------------
+			const T& tx = (*this)(0, 3), ty = (*this)(1, 3), tz = (*this)(2, 3);
+			result(0, 3) = -(result(0, 0) * tx + result(0, 1) * ty + result(0, 2) * tz);
+			result(1, 3) = -(result(1, 0) * tx + result(1, 1) * ty + result(1, 2) * tz);
+			result(2, 3) = -(result(2, 0) * tx + result(2, 1) * ty + result(2, 2) * tz);
 
-		T det() const {
-			const T& a = data[0][0], b = data[0][1], c = data[0][2], d = data[0][3];
-			const T& e = data[1][0], f = data[1][1], g = data[1][2], h = data[1][3];
-			const T& i = data[2][0], j = data[2][1], k = data[2][2], l = data[2][3];
-			const T& m = data[3][0], n = data[3][1], o = data[3][2], p = data[3][3];
+			if constexpr (R == 4) {
+				result(3, 0) = 0; result(3, 1) = 0; result(3, 2) = 0; result(3, 3) = 1;
+			}
 
-			return
-				a * (f * (k * p - l * o) - g * (j * p - l * n) + h * (j * o - k * n)) -
-				b * (e * (k * p - l * o) - g * (i * p - l * m) + h * (i * o - k * m)) +
-				c * (e * (j * p - l * n) - f * (i * p - l * m) + h * (i * n - j * m)) -
-				d * (e * (j * o - k * n) - f * (i * o - k * m) + g * (i * n - j * m));
+			return result;
 		}
 
-		// INVERSE FUNCTION
-		// -------------------------------
-
-		Matrix4<T> inverse() const {
-			T determinant = det();
-			if (determinant == 0) {
+		// Inverse of translation(position) * rotation(orientation) * scale(scale), built directly
+		// as scale(1 / scale) * transpose(rotation) * translation(-position). Expects a unit quaternion.
+		static constexpr Matrix inverseTRS(const Vector<T, 3>& position, const Quaternion<T>& orientation, const Vector<T, 3>& scale) requires IS_TRANSFORM {
+			if (scale[0] == 0 || scale[1] == 0 || scale[2] == 0) {
 				throw std::runtime_error("Matrix is not invertible");
 			}
 
-			T invDet = 1 / determinant;
-			Matrix4<T> result;
+			const Quaternion<T>& q = orientation;
+			T xx = q.x() * q.x(), yy = q.y() * q.y(), zz = q.z() * q.z();
+			T xy = q.x() * q.y(), xz = q.x() * q.z(), yz = q.y() * q.z();
+			T wx = q.w() * q.x(), wy = q.w() * q.y(), wz = q.w() * q.z();
+
+			T sx = 1 / scale[0], sy = 1 / scale[1], sz = 1 / scale[2];
+			Matrix result;
 
-			const T& a = data[0][0], b = data[0][1], c = data[0][2], d = data[0][3];
-			const T& e = data[1][0], f = data[1][1], g = data[1][2], h = data[1][3];
-			const T& i = data[2][0], j = data[2][1], k = data[2][2], l = data[2][3];
-			const T& m = data[3][0], n = data[3][1], o = data[3][2], p = data[3][3];
+			// Rows of the transposed rotation, divided by the matching scale
+			result(0, 0) = (1 - 2 * (yy + zz)) * sx;
+			result(0, 1) = 2 * (xy + wz) * sx;
+			result(0, 2) = 2 * (xz - wy) * sx;
 
-			result.data[0][0] = (f * (k * p - l * o) - g * (j * p - l * n) + h * (j * o - k * n)) * invDet;
-			result.data[0][1] = (c * (j * p - l * n) - b * (k * p - l * o) - d * (j * o - k * n)) * invDet;
-			result.data[0][2] = (b * (g * p - h * o) - c * (f * p - h * n) + d * (f * o - g * n)) * invDet;
-			result.data[0][3] = (c * (f * l - g * k) - b * (g * l - h * k) + d * (f * k - g * j)) * invDet;
+			result(1, 0) = 2 * (xy - wz) * sy;
+			result(1, 1) = (1 - 2 * (xx + zz)) * sy;
+			result(1, 2) = 2 * (yz + wx) * sy;
 
-			result.data[1][0] = (g * (i * p - l * m) - e * (k * p - l * o) + h * (i * o - k * m)) * invDet;
-			result.data[1][1] = (a * (k * p - l * o) - c * (i * p - l * m) - d * (i * o - k * m)) * invDet;
-			result.data[1][2] = (c * (e * p - h * m) - a * (g * p - h * o) + d * (e * o - g * m)) * invDet;
-			result.data[1][3] = (a * (g * l - h * k) - c * (e * l - h * i) + d * (e * k - g * i)) * invDet;
+			result(2, 0) = 2 * (xz + wy) * sz;
+			result(2, 1) = 2 * (yz - wx) * sz;
+			result(2, 2) = (1 - 2 * (xx + yy)) * sz;
 
-			result.data[2][0] = (e * (j * p - l * n) - f * (i * p - l * m) + h * (i * n - j * m)) * invDet;
-			result.data[2][1] = (b * (i * p - l * m) - a * (j * p - l * n) - d * (i * n - j * m)) * invDet;
-			result.data[2][2] = (a * (f * p - h * n) - b * (e * p - h * m) + d * (e * n - f * m)) * invDet;
-			result.data[2][3] = (b * (e * l - h * i) - a * (f * l - h * k) + d * (e * k - f * j)) * invDet;
+			result(0, 3) = -(result(0, 0) * position[0] + result(0, 1) * position[1] + result(0, 2) * position[2]);
+			result(1, 3) = -(result(1, 0) * position[0] + result(1, 1) * position[1] + result(1, 2) * position[2]);
+			result(2, 3) = -(result(2, 0) * position[0] + result(2, 1) * position[1] + result(2, 2) * position[2]);
 
-			result.data[3][0] = (f * (i * o - k * m) - e * (j * o - k * n) + g * (i * n - j * m)) * invDet;
-			result.data[3][1] = (a * (j * o - k * n) - b * (i * o - k * m) - c * (i * n - j * m)) * invDet;
-			result.data[3][2] = (b * (e * o - g * m) - a * (f * o - g * n) + c * (e * n - f * m)) * invDet;
-			result.data[3][3] = (a * (f * k - g * j) - b * (e * k - g * i) + c * (e * j - f * i)) * invDet;
+			if constexpr (R == 4) {
+				result(3, 0) = 0; result(3, 1) = 0; result(3, 2) = 0; result(3, 3) = 1;
+			}
 
 			return result;
 		}
@@ -473,38 +674,38 @@ namespace gem {
 		// LOOKAT FUNCTION
 		// -------------------------------
 
-		static Matrix4<T> lookAt(const Vector<T, 3>& eye,
+		static constexpr Matrix lookAt(const Vector<T, 3>& eye,
 			const Vector<T, 3>& center,
-			const Vector<T, 3>& up)
+			const Vector<T, 3>& up) requires (R == 4 && C == 4)
 		{
 			Vector<T, 3> nup = up;
 			Vector<T, 3> f = (center - eye).normalize();
 			if (f.cross(up).magnitude() < 0.001) {
-				nup = (fabs(f[1]) > 0.99f) ? Vector<T, 3>{ 0, 0, 1 } : Vector<T, 3>{ 0, 1, 0 };
+				nup = (math::abs(f[1]) > 0.99f) ? Vector<T, 3>{ 0, 0, 1 } : Vector<T, 3>{ 0, 1, 0 };
 			}
 			Vector<T, 3> r = f.cross(nup).normalize();
 			Vector<T, 3> u = r.cross(f);
 
-			Matrix4<T> result = identity();
+			Matrix result = identity();
 
-			result[0][0] = r[0]; 
-			result[0][1] = r[1]; 
-			result[0][2] = r[2]; 
+			result[0][0] = r[0];
+			result[0][1] = r[1];
+			result[0][2] = r[2];
 			result[0][3] = -r.dot(eye);
 
-			result[1][0] = u[0]; 
-			result[1][1] = u[1]; 
-			result[1][2] = u[2]; 
+			result[1][0] = u[0];
+			result[1][1] = u[1];
+			result[1][2] = u[2];
 			result[1][3] = -u.dot(eye);
 
-			result[2][0] = -f[0]; 
-			result[2][1] = -f[1]; 
-			result[2][2] = -f[2]; 
+			result[2][0] = -f[0];
+			result[2][1] = -f[1];
+			result[2][2] = -f[2];
 			result[2][3] = f.dot(eye);
 
-			result[3][0] = 0; 
-			result[3][1] = 0; 
-			result[3][1] = 0; 
+			result[3][0] = 0;
+			result[3][1] = 0;
+			result[3][1] = 0;
 			result[3][3] = 1;
 
 			/*
@@ -517,10 +718,10 @@ namespace gem {
 			return result;
 		}
 
-		static Matrix4<T> perspective(T fov, T aspect, T near, T far) {
-			Matrix4<T> result = zero();
+		static constexpr Matrix perspective(T fov, T aspect, T near, T far) requires (R == 4 && C == 4) {
+			Matrix result = zero();
 
-			T tanHalfFov = std::tan(fov * (M_PI / 180) / 2);
+			T tanHalfFov = math::tan(fov * (M_PI / 180) / 2);
 
 			result[0][0] = 1 / (aspect * tanHalfFov);
 			result[1][1] = 1 / (tanHalfFov);
@@ -532,8 +733,8 @@ namespace gem {
 			return result;
 		}
 
-		static Matrix4<T> ortho(T left, T right, T bottom, T top, T near, T far) {
-			Matrix4<T> result = Matrix4<T>::identity();
+		static constexpr Matrix ortho(T left, T right, T bottom, T top, T near, T far) requires (R == 4 && C == 4) {
+			Matrix result = identity();
 
 			result[0][0] = 2 / (right - left);
 			result[1][1] = 2 / (top - bottom);
@@ -545,5 +746,44 @@ namespace gem {
 
 			return result;
 		}
+
+	private:
+		template<typename F>
+		constexpr Matrix map(F&& f) const {
+			Matrix result;
+			detail::unroll<R * C>([&](auto index) {
+				constexpr size_t outer = index / INNER, inner = index % INNER;
+				result.data[outer][inner] = f(data[outer][inner]);
+			});
+			return result;
+		}
+
+		template<typename F>
+		constexpr Matrix zip(const Matrix& other, F&& f) const {
+			Matrix result;
+			detail::unroll<R * C>([&](auto index) {
+				constexpr size_t outer = index / INNER, inner = index % INNER;
+				result.data[outer][inner] = f(data[outer][inner], other.data[outer][inner]);
+			});
+			return result;
+		}
 	};
+
+	template <typename T>
+	using Matrix2 = Matrix<T, 2, 2>;
+
+	// Used for the normal matrix and other linear (non-translating) maps
+	template <typename T>
+	using Matrix3 = Matrix<T, 3, 3>;
+
+	// Affine transform in 12 values instead of 16, with the last row 0 0 0 1 implied
+	template <typename T>
+	using Matrix3x4 = Matrix<T, 3, 4>;
+
+	template <typename T>
+	using Matrix4 = Matrix<T, 4, 4>;
+
+	static_assert(sizeof(Matrix4<float>) == 16 * sizeof(float), "gem: Matrix4<float> must be 16 contiguous floats for the SIMD kernels.");
+	static_assert(sizeof(Matrix3x4<float>) == 12 * sizeof(float), "gem: Matrix3x4<float> must be 12 contiguous floats for the SIMD kernels.");
+	static_assert(sizeof(Matrix3<float>) == 9 * sizeof(float), "gem: Matrix3<float> must be 9 contiguous floats to be uploaded as a mat3.");
 }
\ No newline at end of file
@@ -0,0 +1,3 @@
+#include "matrix3.hpp"
+
+namespace gem {}
\ No newline at end of file
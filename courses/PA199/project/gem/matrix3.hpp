@@ -0,0 +1,4 @@
+#pragma once
+
+// Matrix3 is an alias of the generic gem::Matrix, kept as a header for existing includes
+#include "matrix.hpp"
\ No newline at end of file
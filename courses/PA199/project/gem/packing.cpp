@@ -0,0 +1,3 @@
+#include "packing.hpp"
+
+namespace gem {}
\ No newline at end of file
@@ -0,0 +1,138 @@
+#pragma once
+
+#include <bit>
+#include <cstdint>
+#include <stdexcept>
+
+#include "math.hpp"
+#include "vector.hpp"
+
+namespace gem {
+	// Conversions between floats and the compact formats GPUs read natively as vertex
+	// attributes: IEEE half floats, 16-bit normalized integers and octahedral unit vectors.
+	// Everything is constexpr and matches the OpenGL decoding rules, so data packed here
+	// reads back in a shader as the value unpacked here.
+
+	namespace detail {
+		// Round half away from zero, constexpr unlike std::round
+		constexpr int32_t roundToInt(float x) {
+			return static_cast<int32_t>(x < 0 ? x - 0.5f : x + 0.5f);
+		}
+
+		template<typename T>
+		constexpr T signNotZero(T x) {
+			return x < 0 ? static_cast<T>(-1) : static_cast<T>(1);
+		}
+	}
+
+	// HALF FLOAT FUNCTIONS
+	// -------------------------------
+
+	// Rounds to nearest even. Values too large for a half become infinity, values too small
+	// become half denormals or zero, NaN stays NaN.
+	constexpr uint16_t packHalf(float value) {
+		uint32_t bits = std::bit_cast<uint32_t>(value);
+		uint32_t sign = (bits >> 16) & 0x8000u;
+		uint32_t abs = bits & 0x7fffffffu;
+
+		// NaN keeps a quiet mantissa bit, infinity and overflow map to infinity
+		if (abs > 0x7f800000u) return static_cast<uint16_t>(sign | 0x7e00u);
+		if (abs >= 0x47800000u) return static_cast<uint16_t>(sign | 0x7c00u);
+
+		// Below the smallest normal half (2^-14): a denormal in units of 2^-24
+		if (abs < 0x38800000u) {
+			if (abs < 0x33000000u) return static_cast<uint16_t>(sign);
+
+			uint32_t mantissa = (abs & 0x7fffffu) | 0x800000u;
+			uint32_t shift = 126u - (abs >> 23);
+			uint32_t half = mantissa >> shift;
+			uint32_t rest = mantissa & ((1u << shift) - 1u);
+			uint32_t halfway = 1u << (shift - 1u);
+			if (rest > halfway || (rest == halfway && (half & 1u))) ++half;
+			return static_cast<uint16_t>(sign | half);
+		}
+
+		// Rebias the exponent from 127 to 15 and drop 13 mantissa bits. A carry out of the
+		// mantissa correctly bumps the exponent, up to infinity.
+		uint32_t half = (abs - 0x38000000u) >> 13;
+		uint32_t rest = abs & 0x1fffu;
+		if (rest > 0x1000u || (rest == 0x1000u && (half & 1u))) ++half;
+		return static_cast<uint16_t>(sign | half);
+	}
+
+	// Exact, every half is representable as a float
+	constexpr float unpackHalf(uint16_t half) {
+		uint32_t sign = static_cast<uint32_t>(half & 0x8000u) << 16;
+		uint32_t exponent = (half >> 10) & 0x1fu;
+		uint32_t mantissa = half & 0x3ffu;
+
+		if (exponent == 0x1fu) return std::bit_cast<float>(sign | 0x7f800000u | (mantissa << 13));
+		if (exponent == 0) {
+			float denormal = static_cast<float>(mantissa) * 5.9604644775390625e-8f; // 2^-24
+			return sign ? -denormal : denormal;
+		}
+		return std::bit_cast<float>(sign | ((exponent + 112u) << 23) | (mantissa << 13));
+	}
+
+	// NORMALIZED INTEGER FUNCTIONS
+	// -------------------------------
+
+	// [-1, 1] -> [-32767, 32767], clamped
+	constexpr int16_t packSnorm16(float value) {
+		float clamped = value < -1.0f ? -1.0f : (value > 1.0f ? 1.0f : value);
+		return static_cast<int16_t>(detail::roundToInt(clamped * 32767.0f));
+	}
+
+	// -32768 and -32767 both decode to -1, as in OpenGL
+	constexpr float unpackSnorm16(int16_t value) {
+		float result = static_cast<float>(value) / 32767.0f;
+		return result < -1.0f ? -1.0f : result;
+	}
+
+	// [0, 1] -> [0, 65535], clamped
+	constexpr uint16_t packUnorm16(float value) {
+		float clamped = value < 0.0f ? 0.0f : (value > 1.0f ? 1.0f : value);
+		return static_cast<uint16_t>(detail::roundToInt(clamped * 65535.0f));
+	}
+
+	constexpr float unpackUnorm16(uint16_t value) {
+		return static_cast<float>(value) / 65535.0f;
+	}
+
+	// OCTAHEDRAL ENCODING FUNCTIONS
+	// -------------------------------
+
+	// Projects a direction onto the octahedron |x| + |y| + |z| = 1 and unfolds the lower
+	// half over the diagonals, giving two values in [-1, 1]. Unlike spherical coordinates
+	// the error is spread almost evenly over the sphere and no trigonometry is needed.
+	template<typename T>
+	constexpr Vector<T, 2> octEncode(const Vector<T, 3>& direction) {
+		T l1 = math::abs(direction[0]) + math::abs(direction[1]) + math::abs(direction[2]);
+		if (l1 == 0) throw std::runtime_error("Cannot octahedron-encode a zero vector.");
+
+		T x = direction[0] / l1;
+		T y = direction[1] / l1;
+		if (direction[2] < 0) {
+			T folded_x = (1 - math::abs(y)) * detail::signNotZero(x);
+			T folded_y = (1 - math::abs(x)) * detail::signNotZero(y);
+			x = folded_x;
+			y = folded_y;
+		}
+		return Vector<T, 2>{ x, y };
+	}
+
+	// Returns a unit vector
+	template<typename T>
+	constexpr Vector<T, 3> octDecode(const Vector<T, 2>& encoded) {
+		T x = encoded[0];
+		T y = encoded[1];
+		T z = 1 - math::abs(x) - math::abs(y);
+		if (z < 0) {
+			T unfolded_x = (1 - math::abs(y)) * detail::signNotZero(x);
+			T unfolded_y = (1 - math::abs(x)) * detail::signNotZero(y);
+			x = unfolded_x;
+			y = unfolded_y;
+		}
+		return Vector<T, 3>{ x, y, z }.normalize();
+	}
+}
\ No newline at end of file
@@ -2,73 +2,88 @@
 
 #include <cmath>
 #include <iostream>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
 
-namespace gem {
-	template <typename T, size_t N>
-	struct Vector; // Forward declaration
+#include "math.hpp"
+#include "vector.hpp"
 
+namespace gem {
 	template <typename T>
 	struct AxisAngle; // Forward declaration
 
-	template<typename T>
-	struct Quaternion {
-		Vector<T, 4> data;
-
-		Quaternion() : data{ 1, 0, 0, 0 } {}
-		Quaternion(T w, T x, T y, T z) : data{ w, x, y, z } {}
-		Quaternion(const Vector<T, 4>& vec) : data(vec) {}
-
-		T& operator[](size_t index) { return data[index]; }
-		const T& operator[](size_t index) const { return data[index]; }
-
-		T& w() { return data[0]; }
-		T& x() { return data[1]; }
-		T& y() { return data[2]; }
-		T& z() { return data[3]; }
-
-		const T& x() const { return data[1]; }
-		const T& y() const { return data[2]; }
-		const T& z() const { return data[3]; }
-		const T& w() const { return data[0]; }
-
-		// ADDITION OPERATORS
-		// -------------------------------
+	template <typename T>
+	struct Quaternion; // Forward declaration
 
-		Quaternion<T> operator+(const Quaternion<T>& other) const {
-			return Quaternion<T>(data + other.data);
-		}
+	// The rotated x, y and z axes of a quaternion, i.e. the columns of its rotation matrix
+	template<typename T>
+	struct Basis {
+		Vector<T, 3> right;
+		Vector<T, 3> up;
+		Vector<T, 3> forward;
+	};
 
-		Quaternion<T> operator+(T scalar) const {
-			return Quaternion<T>(data + scalar);
-		}
+	// Unevaluated element-wise quaternion arithmetic (sums, differences and scalings) over
+	// the (w, x, y, z) components. It turns into a Quaternion on assignment or conversion,
+	// the Hamilton product and the other quaternion functions evaluate it first.
+	template<typename E>
+	struct QuaternionExpr {
+		using value_type = typename E::value_type;
+
+		E components;
+
+		constexpr value_type operator[](size_t index) const { return components[index]; }
+
+		constexpr value_type w() const { return components[0]; }
+		constexpr value_type x() const { return components[1]; }
+		constexpr value_type y() const { return components[2]; }
+		constexpr value_type z() const { return components[3]; }
+
+		constexpr Quaternion<value_type> eval() const { return Quaternion<value_type>(*this); }
+
+		constexpr Quaternion<value_type> operator*(const Quaternion<value_type>& other) const { return eval() * other; }
+		constexpr Quaternion<value_type> operator~() const { return ~eval(); }
+		constexpr Quaternion<value_type> conjugate() const { return eval().conjugate(); }
+		constexpr Quaternion<value_type> normalize() const { return eval().normalize(); }
+		constexpr Quaternion<value_type> inverse() const { return eval().inverse(); }
+		constexpr value_type magnitude() const { return components.magnitude(); }
+		constexpr value_type dot(const Quaternion<value_type>& other) const { return components.dot(other.data); }
+		constexpr AxisAngle<value_type> toAxisAngle() const { return eval().toAxisAngle(); }
+		constexpr Vector<value_type, 3> rotate(const Vector<value_type, 3>& vec) const { return eval().rotate(vec); }
+		constexpr Basis<value_type> basis() const { return eval().basis(); }
+	};
 
-		friend Quaternion<T> operator+(T scalar, const Quaternion<T>& quat) {
-			return Quaternion<T>(scalar + quat.data);
-		}
+	template<typename T>
+	struct Quaternion {
+		Vector<T, 4> data;
 
-		// SUBTRACTION OPERATORS
-		// --------------------------------
+		constexpr Quaternion() : data{ 1, 0, 0, 0 } {}
+		constexpr Quaternion(T w, T x, T y, T z) : data{ w, x, y, z } {}
+		constexpr Quaternion(const Vector<T, 4>& vec) : data(vec) {}
 
-		Quaternion<T> operator-() const {
-			return Quaternion<T>(-data);
+		template<typename E>
+		constexpr Quaternion(const QuaternionExpr<E>& expr) : data() {
+			data = expr.components;
 		}
 
-		Quaternion<T> operator-(const Quaternion<T>& other) const {
-			return Quaternion<T>(data - other.data);
-		}
+		constexpr T& operator[](size_t index) { return data[index]; }
+		constexpr const T& operator[](size_t index) const { return data[index]; }
 
-		Quaternion<T> operator-(T scalar) const {
-			return Quaternion<T>(data - scalar);
-		}
+		constexpr T& w() { return data[0]; }
+		constexpr T& x() { return data[1]; }
+		constexpr T& y() { return data[2]; }
+		constexpr T& z() { return data[3]; }
 
-		friend Quaternion<T> operator-(T scalar, const Quaternion<T>& quat) {
-			return Quaternion<T>(scalar - quat.data);
-		}
+		constexpr const T& x() const { return data[1]; }
+		constexpr const T& y() const { return data[2]; }
+		constexpr const T& z() const { return data[3]; }
+		constexpr const T& w() const { return data[0]; }
 
-		// MULTIPLICATION OPERATORS
+		// HAMILTON PRODUCT
 		// -----------------------------------
 
-		Quaternion<T> operator*(const Quaternion<T>& other) const {
+		constexpr Quaternion<T> operator*(const Quaternion<T>& other) const {
 			return Quaternion<T>(
 				data[0] * other.data[0] - data[1] * other.data[1] - data[2] * other.data[2] - data[3] * other.data[3],
 				data[0] * other.data[1] + data[1] * other.data[0] + data[2] * other.data[3] - data[3] * other.data[2],
@@ -77,52 +92,44 @@ namespace gem {
 			);
 		}
 
-		Quaternion<T> operator*(T scalar) const {
-			return Quaternion<T>(data * scalar);
-		}
-
-		friend Quaternion<T> operator*(T scalar, const Quaternion<T>& quat) {
-			return Quaternion<T>(scalar * quat.data);
-		}
-
 		// CONJUGATE FUNCTIONS
 		// -------------------------------
 
-		Quaternion<T> operator~() const {
+		constexpr Quaternion<T> operator~() const {
 			return Quaternion<T>(data[0], -data[1], -data[2], -data[3]);
 		}
 
-		Quaternion<T> conjugate() const {
+		constexpr Quaternion<T> conjugate() const {
 			return ~(*this);
 		}
 
 		// QUATERNION FUNCTIONS
 		// -------------------------------
 
-		T magnitude() const {
+		constexpr T magnitude() const {
 			return data.magnitude();
 		}
 
-		Quaternion<T> normalize() const {
+		constexpr Quaternion<T> normalize() const {
 			return Quaternion<T>(data.normalize());
 		}
 
-		Quaternion<T> inverse() const {
+		constexpr Quaternion<T> inverse() const {
 			T mag_sq = magnitude() * magnitude();
 			if (mag_sq == 0) throw std::runtime_error("Cannot invert a zero-magnitude quaternion.");
 			
 			return conjugate() * (1 / mag_sq);
 		}
 
-		T dot(const Quaternion<T>& other) const {
+		constexpr T dot(const Quaternion<T>& other) const {
 			return data.dot(other.data);
 		}
 
-		AxisAngle<T> toAxisAngle() const {
+		constexpr AxisAngle<T> toAxisAngle() const {
 			Quaternion<T> q = normalize();
 
-			T angle = 2 * std::acos(q.w());
-			T s = std::sqrt(1 - q.w() * q.w());
+			T angle = 2 * math::acos(q.w());
+			T s = math::sqrt(1 - q.w() * q.w());
 
 			if (s < 0.001) { 
 				return AxisAngle<T>();
@@ -131,11 +138,121 @@ namespace gem {
 			}
 		}
 
-		Vector<T, 3> rotate(const Vector<T, 3>& vec) const {
-			Quaternion<T> p(0, vec[0], vec[1], vec[2]);
-			Quaternion<T> q_conj = conjugate();
-			Quaternion<T> result = (*this) * p * q_conj;
-			return Vector<T, 3>{ result.x(), result.y(), result.z() };
+		// q * (0, vec) * conj(q) expanded into two cross products: with t = 2 * (q.xyz x vec)
+		// the result is vec + w * t + q.xyz x t. Expects a unit quaternion.
+		constexpr Vector<T, 3> rotate(const Vector<T, 3>& vec) const {
+			T tx = 2 * (y() * vec[2] - z() * vec[1]);
+			T ty = 2 * (z() * vec[0] - x() * vec[2]);
+			T tz = 2 * (x() * vec[1] - y() * vec[0]);
+
+			return Vector<T, 3>{
+				vec[0] + w() * tx + (y() * tz - z() * ty),
+				vec[1] + w() * ty + (z() * tx - x() * tz),
+				vec[2] + w() * tz + (x() * ty - y() * tx)
+			};
+		}
+
+		// All three rotated axes at once. Scaled by 2 / |q|^2 rather than 2, so the basis stays
+		// orthonormal even if the quaternion has drifted off unit length.
+		constexpr Basis<T> basis() const {
+			T n = dot(*this);
+			T s = n > 0 ? 2 / n : 0;
+
+			T xx = x() * x() * s, yy = y() * y() * s, zz = z() * z() * s;
+			T xy = x() * y() * s, xz = x() * z() * s, yz = y() * z() * s;
+			T wx = w() * x() * s, wy = w() * y() * s, wz = w() * z() * s;
+
+			return Basis<T>{
+				Vector<T, 3>{ 1 - (yy + zz), xy + wz, xz - wy },
+				Vector<T, 3>{ xy - wz, 1 - (xx + zz), yz + wx },
+				Vector<T, 3>{ xz + wy, yz - wx, 1 - (xx + yy) }
+			};
 		}
 	};
+
+	namespace detail {
+		template<typename Q>
+		struct IsQuaternion : std::false_type {};
+
+		template<typename T>
+		struct IsQuaternion<Quaternion<T>> : std::true_type {};
+
+		template<typename Q>
+		struct IsQuaternionExpr : std::false_type {};
+
+		template<typename E>
+		struct IsQuaternionExpr<QuaternionExpr<E>> : std::true_type {};
+
+		// Vector expression over the components, keeps the value category of the quaternion
+		template<typename Q>
+		constexpr decltype(auto) components(Q&& q) {
+			if constexpr (IsQuaternion<std::remove_cvref_t<Q>>::value) {
+				return (std::forward<Q>(q).data);
+			} else {
+				return (std::forward<Q>(q).components);
+			}
+		}
+
+		template<typename E>
+		constexpr QuaternionExpr<std::remove_cvref_t<E>> makeQuaternionExpr(E&& components) {
+			return QuaternionExpr<std::remove_cvref_t<E>>{ std::forward<E>(components) };
+		}
+	}
+
+	template<typename Q>
+	concept QuaternionExpression = detail::IsQuaternion<std::remove_cvref_t<Q>>::value || detail::IsQuaternionExpr<std::remove_cvref_t<Q>>::value;
+
+	// ADDITION OPERATORS
+	// -------------------------------
+
+	template<QuaternionExpression L, QuaternionExpression R>
+	constexpr auto operator+(L&& lhs, R&& rhs) {
+		return detail::makeQuaternionExpr(detail::components(std::forward<L>(lhs)) + detail::components(std::forward<R>(rhs)));
+	}
+
+	template<QuaternionExpression Q, Scalar S>
+	constexpr auto operator+(Q&& quat, S scalar) {
+		return detail::makeQuaternionExpr(detail::components(std::forward<Q>(quat)) + scalar);
+	}
+
+	template<Scalar S, QuaternionExpression Q>
+	constexpr auto operator+(S scalar, Q&& quat) {
+		return detail::makeQuaternionExpr(scalar + detail::components(std::forward<Q>(quat)));
+	}
+
+	// SUBTRACTION OPERATORS
+	// --------------------------------
+
+	template<QuaternionExpression Q>
+	constexpr auto operator-(Q&& quat) {
+		return detail::makeQuaternionExpr(-detail::components(std::forward<Q>(quat)));
+	}
+
+	template<QuaternionExpression L, QuaternionExpression R>
+	constexpr auto operator-(L&& lhs, R&& rhs) {
+		return detail::makeQuaternionExpr(detail::components(std::forward<L>(lhs)) - detail::components(std::forward<R>(rhs)));
+	}
+
+	template<QuaternionExpression Q, Scalar S>
+	constexpr auto operator-(Q&& quat, S scalar) {
+		return detail::makeQuaternionExpr(detail::components(std::forward<Q>(quat)) - scalar);
+	}
+
+	template<Scalar S, QuaternionExpression Q>
+	constexpr auto operator-(S scalar, Q&& quat) {
+		return detail::makeQuaternionExpr(scalar - detail::components(std::forward<Q>(quat)));
+	}
+
+	// SCALAR MULTIPLICATION OPERATORS
+	// -----------------------------------
+
+	template<QuaternionExpression Q, Scalar S>
+	constexpr auto operator*(Q&& quat, S scalar) {
+		return detail::makeQuaternionExpr(detail::components(std::forward<Q>(quat)) * scalar);
+	}
+
+	template<Scalar S, QuaternionExpression Q>
+	constexpr auto operator*(S scalar, Q&& quat) {
+		return detail::makeQuaternionExpr(scalar * detail::components(std::forward<Q>(quat)));
+	}
 }
\ No newline at end of file
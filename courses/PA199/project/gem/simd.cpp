@@ -0,0 +1,3 @@
+#include "simd.hpp"
+
+namespace gem {}
\ No newline at end of file
@@ -0,0 +1,380 @@
+#pragma once
+
+// SIMD BACKEND SELECTION
+// -------------------------------
+// The backend is picked at compile time from the target flags (/arch:AVX, -mavx, ...).
+// Define GEM_NO_SIMD to force the scalar fallback kernels everywhere.
+
+#if !defined(GEM_NO_SIMD)
+	#if defined(__AVX__)
+		#define GEM_SIMD_AVX 1
+	#endif
+	#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+		#define GEM_SIMD_SSE 1
+	#endif
+	#if defined(__FMA__) || defined(__AVX2__)
+		#define GEM_SIMD_FMA 1
+	#endif
+#endif
+
+#include <cmath>
+
+#if defined(GEM_SIMD_AVX)
+#include <immintrin.h>
+#elif defined(GEM_SIMD_SSE)
+#include <emmintrin.h>
+#endif
+
+namespace gem {
+	namespace simd {
+#if defined(GEM_SIMD_SSE)
+		constexpr bool enabled = true;
+#else
+		constexpr bool enabled = false;
+#endif
+
+#if defined(GEM_SIMD_AVX)
+		constexpr const char* backend = "avx";
+#elif defined(GEM_SIMD_SSE)
+		constexpr const char* backend = "sse";
+#else
+		constexpr const char* backend = "scalar";
+#endif
+
+#if defined(GEM_SIMD_SSE)
+		// HELPERS
+		// -------------------------------
+
+		inline __m128 madd(__m128 a, __m128 b, __m128 c) {
+#if defined(GEM_SIMD_FMA)
+			return _mm_fmadd_ps(a, b, c);
+#else
+			return _mm_add_ps(_mm_mul_ps(a, b), c);
+#endif
+		}
+
+		template<int I>
+		inline __m128 splat(__m128 v) {
+			return _mm_shuffle_ps(v, v, _MM_SHUFFLE(I, I, I, I));
+		}
+
+		// 4x4 MATRIX KERNELS (row-major, 16 contiguous floats)
+		// -------------------------------
+
+		// out = a * b
+		inline void mat4Mul(const float* a, const float* b, float* out) {
+#if defined(GEM_SIMD_AVX)
+			// Two output rows per iteration, one per 128-bit lane.
+			__m256 bb0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(b + 0));
+			__m256 bb1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(b + 4));
+			__m256 bb2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(b + 8));
+			__m256 bb3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(b + 12));
+
+			for (int i = 0; i < 16; i += 8) {
+				__m256 rows = _mm256_loadu_ps(a + i);
+				__m256 r = _mm256_mul_ps(_mm256_shuffle_ps(rows, rows, _MM_SHUFFLE(0, 0, 0, 0)), bb0);
+				r = _mm256_add_ps(r, _mm256_mul_ps(_mm256_shuffle_ps(rows, rows, _MM_SHUFFLE(1, 1, 1, 1)), bb1));
+				r = _mm256_add_ps(r, _mm256_mul_ps(_mm256_shuffle_ps(rows, rows, _MM_SHUFFLE(2, 2, 2, 2)), bb2));
+				r = _mm256_add_ps(r, _mm256_mul_ps(_mm256_shuffle_ps(rows, rows, _MM_SHUFFLE(3, 3, 3, 3)), bb3));
+				_mm256_storeu_ps(out + i, r);
+			}
+#else
+			__m128 b0 = _mm_loadu_ps(b + 0);
+			__m128 b1 = _mm_loadu_ps(b + 4);
+			__m128 b2 = _mm_loadu_ps(b + 8);
+			__m128 b3 = _mm_loadu_ps(b + 12);
+
+			for (int i = 0; i < 16; i += 4) {
+				__m128 row = _mm_loadu_ps(a + i);
+				__m128 r = _mm_mul_ps(splat<0>(row), b0);
+				r = madd(splat<1>(row), b1, r);
+				r = madd(splat<2>(row), b2, r);
+				r = madd(splat<3>(row), b3, r);
+				_mm_storeu_ps(out + i, r);
+			}
+#endif
+		}
+
+		// out = transpose(m)
+		inline void mat4Transpose(const float* m, float* out) {
+			__m128 r0 = _mm_loadu_ps(m + 0);
+			__m128 r1 = _mm_loadu_ps(m + 4);
+			__m128 r2 = _mm_loadu_ps(m + 8);
+			__m128 r3 = _mm_loadu_ps(m + 12);
+			_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+			_mm_storeu_ps(out + 0, r0);
+			_mm_storeu_ps(out + 4, r1);
+			_mm_storeu_ps(out + 8, r2);
+			_mm_storeu_ps(out + 12, r3);
+		}
+
+		// out = m * v (v as a column vector)
+		inline void mat4MulVec4(const float* m, const float* v, float* out) {
+			__m128 c0 = _mm_loadu_ps(m + 0);
+			__m128 c1 = _mm_loadu_ps(m + 4);
+			__m128 c2 = _mm_loadu_ps(m + 8);
+			__m128 c3 = _mm_loadu_ps(m + 12);
+			_MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+
+			__m128 x = _mm_loadu_ps(v);
+			__m128 r = _mm_mul_ps(c0, splat<0>(x));
+			r = madd(c1, splat<1>(x), r);
+			r = madd(c2, splat<2>(x), r);
+			r = madd(c3, splat<3>(x), r);
+			_mm_storeu_ps(out, r);
+		}
+
+		// out = v * m (v as a row vector)
+		inline void vec4MulMat4(const float* v, const float* m, float* out) {
+			__m128 x = _mm_loadu_ps(v);
+			__m128 r = _mm_mul_ps(splat<0>(x), _mm_loadu_ps(m + 0));
+			r = madd(splat<1>(x), _mm_loadu_ps(m + 4), r);
+			r = madd(splat<2>(x), _mm_loadu_ps(m + 8), r);
+			r = madd(splat<3>(x), _mm_loadu_ps(m + 12), r);
+			_mm_storeu_ps(out, r);
+		}
+
+		// 3x4 AFFINE KERNELS (row-major, 12 contiguous floats, implicit last row 0 0 0 1)
+		// -------------------------------
+
+		// out = a * b as 4x4 matrices, without the multiplications by the constant last row
+		inline void affineMul(const float* a, const float* b, float* out) {
+			__m128 b0 = _mm_loadu_ps(b + 0);
+			__m128 b1 = _mm_loadu_ps(b + 4);
+			__m128 b2 = _mm_loadu_ps(b + 8);
+			__m128 translation = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+
+			for (int i = 0; i < 12; i += 4) {
+				__m128 row = _mm_loadu_ps(a + i);
+				__m128 r = _mm_mul_ps(splat<0>(row), b0);
+				r = madd(splat<1>(row), b1, r);
+				r = madd(splat<2>(row), b2, r);
+				r = _mm_add_ps(r, _mm_and_ps(row, translation));
+				_mm_storeu_ps(out + i, r);
+			}
+		}
+
+		// out[0..63] = rotation matrices of the four unit quaternions q[0..15], each stored as (w, x, y, z).
+		// The quaternions are transposed so every lane builds one matrix, and each group of rows (or
+		// columns, for ColumnMajor output) is transposed back on the way out.
+		template<bool ColumnMajor = false>
+		inline void quat4ToMat4(const float* q, float* out) {
+			__m128 w = _mm_loadu_ps(q + 0);
+			__m128 x = _mm_loadu_ps(q + 4);
+			__m128 y = _mm_loadu_ps(q + 8);
+			__m128 z = _mm_loadu_ps(q + 12);
+			_MM_TRANSPOSE4_PS(w, x, y, z);
+
+			const __m128 one = _mm_set1_ps(1.0f);
+			const __m128 two = _mm_set1_ps(2.0f);
+			__m128 x2 = _mm_mul_ps(x, two), y2 = _mm_mul_ps(y, two), z2 = _mm_mul_ps(z, two);
+			__m128 xx = _mm_mul_ps(x, x2), yy = _mm_mul_ps(y, y2), zz = _mm_mul_ps(z, z2);
+			__m128 xy = _mm_mul_ps(x, y2), xz = _mm_mul_ps(x, z2), yz = _mm_mul_ps(y, z2);
+			__m128 wx = _mm_mul_ps(w, x2), wy = _mm_mul_ps(w, y2), wz = _mm_mul_ps(w, z2);
+
+			__m128 rows[3][4] = {
+				{ _mm_sub_ps(one, _mm_add_ps(yy, zz)), _mm_sub_ps(xy, wz), _mm_add_ps(xz, wy), _mm_setzero_ps() },
+				{ _mm_add_ps(xy, wz), _mm_sub_ps(one, _mm_add_ps(xx, zz)), _mm_sub_ps(yz, wx), _mm_setzero_ps() },
+				{ _mm_sub_ps(xz, wy), _mm_add_ps(yz, wx), _mm_sub_ps(one, _mm_add_ps(xx, yy)), _mm_setzero_ps() }
+			};
+
+			if constexpr (ColumnMajor) {
+				for (int i = 0; i < 4; ++i) {
+					__m128 c0 = rows[0][i], c1 = rows[1][i], c2 = rows[2][i];
+					__m128 c3 = i == 3 ? one : _mm_setzero_ps();
+					_MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+					_mm_storeu_ps(out + 0 + 4 * i, c0);
+					_mm_storeu_ps(out + 16 + 4 * i, c1);
+					_mm_storeu_ps(out + 32 + 4 * i, c2);
+					_mm_storeu_ps(out + 48 + 4 * i, c3);
+				}
+			}
+			else {
+				const __m128 last_row = _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f);
+				for (int i = 0; i < 3; ++i) {
+					_MM_TRANSPOSE4_PS(rows[i][0], rows[i][1], rows[i][2], rows[i][3]);
+					for (int j = 0; j < 4; ++j) {
+						_mm_storeu_ps(out + 16 * j + 4 * i, rows[i][j]);
+					}
+				}
+				for (int j = 0; j < 4; ++j) {
+					_mm_storeu_ps(out + 16 * j + 12, last_row);
+				}
+			}
+		}
+
+		// QUATERNION KERNELS ((w, x, y, z), 4 contiguous floats)
+		// -------------------------------
+
+		// Hamilton product a * b: one broadcast component of a per step against a shuffled b,
+		// the signs are flipped with an xor on the broadcast
+		inline __m128 quatMul(__m128 a, __m128 b) {
+			__m128 r = _mm_mul_ps(splat<0>(a), b);
+			r = madd(_mm_xor_ps(splat<1>(a), _mm_setr_ps(-0.0f, 0.0f, -0.0f, 0.0f)), _mm_shuffle_ps(b, b, _MM_SHUFFLE(2, 3, 0, 1)), r);
+			r = madd(_mm_xor_ps(splat<2>(a), _mm_setr_ps(-0.0f, 0.0f, 0.0f, -0.0f)), _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 0, 3, 2)), r);
+			r = madd(_mm_xor_ps(splat<3>(a), _mm_setr_ps(-0.0f, -0.0f, 0.0f, 0.0f)), _mm_shuffle_ps(b, b, _MM_SHUFFLE(0, 1, 2, 3)), r);
+			return r;
+		}
+
+		inline void quatMul(const float* a, const float* b, float* out) {
+			_mm_storeu_ps(out, quatMul(_mm_loadu_ps(a), _mm_loadu_ps(b)));
+		}
+
+		// Dual quaternion product (real, dual) * (real, dual), each part 4 floats:
+		// (ar * br, ar * bd + ad * br)
+		inline void dualQuatMul(const float* ar, const float* ad, const float* br, const float* bd, float* out_real, float* out_dual) {
+			__m128 a_real = _mm_loadu_ps(ar), a_dual = _mm_loadu_ps(ad);
+			__m128 b_real = _mm_loadu_ps(br), b_dual = _mm_loadu_ps(bd);
+			_mm_storeu_ps(out_real, quatMul(a_real, b_real));
+			_mm_storeu_ps(out_dual, _mm_add_ps(quatMul(a_real, b_dual), quatMul(a_dual, b_real)));
+		}
+
+		// 4-WIDE PACKET OPERATIONS
+		// -------------------------------
+		// Building blocks for evaluating Vector<float, 4> expressions in registers.
+
+		using f32x4 = __m128;
+
+		inline f32x4 load(const float* p) { return _mm_loadu_ps(p); }
+		inline void store(float* p, f32x4 v) { _mm_storeu_ps(p, v); }
+		inline f32x4 broadcast(float s) { return _mm_set1_ps(s); }
+
+		inline f32x4 add(f32x4 a, f32x4 b) { return _mm_add_ps(a, b); }
+		inline f32x4 sub(f32x4 a, f32x4 b) { return _mm_sub_ps(a, b); }
+		inline f32x4 mul(f32x4 a, f32x4 b) { return _mm_mul_ps(a, b); }
+		inline f32x4 div(f32x4 a, f32x4 b) { return _mm_div_ps(a, b); }
+
+		inline float dot(f32x4 a, f32x4 b) {
+			__m128 m = _mm_mul_ps(a, b);
+			__m128 s = _mm_add_ps(m, _mm_shuffle_ps(m, m, _MM_SHUFFLE(2, 3, 0, 1)));
+			s = _mm_add_ps(s, _mm_shuffle_ps(s, s, _MM_SHUFFLE(1, 0, 3, 2)));
+			return _mm_cvtss_f32(s);
+		}
+
+		inline f32x4 sqrt(f32x4 a) { return _mm_sqrt_ps(a); }
+		inline f32x4 rsqrt(f32x4 a) { return _mm_rsqrt_ps(a); } // ~12 bits
+		inline f32x4 abs(f32x4 a) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+		inline f32x4 round(f32x4 a) { return _mm_cvtepi32_ps(_mm_cvtps_epi32(a)); }
+		inline f32x4 min(f32x4 a, f32x4 b) { return _mm_min_ps(a, b); }
+		inline f32x4 max(f32x4 a, f32x4 b) { return _mm_max_ps(a, b); }
+
+		// Comparisons produce lane masks consumed by select(mask, a, b).
+		inline f32x4 less(f32x4 a, f32x4 b) { return _mm_cmplt_ps(a, b); }
+		inline f32x4 equal(f32x4 a, f32x4 b) { return _mm_cmpeq_ps(a, b); }
+		inline f32x4 select(f32x4 mask, f32x4 a, f32x4 b) { return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)); }
+		inline f32x4 maskAnd(f32x4 a, f32x4 b) { return _mm_and_ps(a, b); }
+		inline f32x4 maskOr(f32x4 a, f32x4 b) { return _mm_or_ps(a, b); }
+		inline f32x4 maskNot(f32x4 a) { return _mm_xor_ps(a, _mm_castsi128_ps(_mm_set1_epi32(-1))); }
+		inline int maskBits(f32x4 mask) { return _mm_movemask_ps(mask); } // bit i set when lane i is set
+#else
+		// SCALAR FALLBACK
+		// -------------------------------
+
+		inline void mat4Mul(const float* a, const float* b, float* out) {
+			for (int i = 0; i < 4; ++i) {
+				for (int j = 0; j < 4; ++j) {
+					out[i * 4 + j] = a[i * 4 + 0] * b[0 + j] + a[i * 4 + 1] * b[4 + j] + a[i * 4 + 2] * b[8 + j] + a[i * 4 + 3] * b[12 + j];
+				}
+			}
+		}
+
+		inline void mat4Transpose(const float* m, float* out) {
+			for (int i = 0; i < 4; ++i) {
+				for (int j = 0; j < 4; ++j) {
+					out[i * 4 + j] = m[j * 4 + i];
+				}
+			}
+		}
+
+		inline void mat4MulVec4(const float* m, const float* v, float* out) {
+			for (int i = 0; i < 4; ++i) {
+				out[i] = m[i * 4 + 0] * v[0] + m[i * 4 + 1] * v[1] + m[i * 4 + 2] * v[2] + m[i * 4 + 3] * v[3];
+			}
+		}
+
+		inline void vec4MulMat4(const float* v, const float* m, float* out) {
+			for (int j = 0; j < 4; ++j) {
+				out[j] = v[0] * m[0 + j] + v[1] * m[4 + j] + v[2] * m[8 + j] + v[3] * m[12 + j];
+			}
+		}
+
+		inline void affineMul(const float* a, const float* b, float* out) {
+			for (int i = 0; i < 3; ++i) {
+				for (int j = 0; j < 4; ++j) {
+					out[i * 4 + j] = a[i * 4 + 0] * b[0 + j] + a[i * 4 + 1] * b[4 + j] + a[i * 4 + 2] * b[8 + j] + (j == 3 ? a[i * 4 + 3] : 0.0f);
+				}
+			}
+		}
+
+		template<bool ColumnMajor = false>
+		inline void quat4ToMat4(const float* q, float* out) {
+			for (int j = 0; j < 4; ++j) {
+				float w = q[4 * j + 0], x = q[4 * j + 1], y = q[4 * j + 2], z = q[4 * j + 3];
+				float m[16] = {
+					1 - 2 * (y * y + z * z), 2 * (x * y - w * z), 2 * (x * z + w * y), 0,
+					2 * (x * y + w * z), 1 - 2 * (x * x + z * z), 2 * (y * z - w * x), 0,
+					2 * (x * z - w * y), 2 * (y * z + w * x), 1 - 2 * (x * x + y * y), 0,
+					0, 0, 0, 1
+				};
+
+				if constexpr (ColumnMajor) mat4Transpose(m, out + 16 * j);
+				else for (int i = 0; i < 16; ++i) out[16 * j + i] = m[i];
+			}
+		}
+
+		inline void quatMul(const float* a, const float* b, float* out) {
+			float r[4] = {
+				a[0] * b[0] - a[1] * b[1] - a[2] * b[2] - a[3] * b[3],
+				a[0] * b[1] + a[1] * b[0] + a[2] * b[3] - a[3] * b[2],
+				a[0] * b[2] - a[1] * b[3] + a[2] * b[0] + a[3] * b[1],
+				a[0] * b[3] + a[1] * b[2] - a[2] * b[1] + a[3] * b[0]
+			};
+			for (int i = 0; i < 4; ++i) out[i] = r[i];
+		}
+
+		inline void dualQuatMul(const float* ar, const float* ad, const float* br, const float* bd, float* out_real, float* out_dual) {
+			float real[4], cross0[4], cross1[4];
+			quatMul(ar, br, real);
+			quatMul(ar, bd, cross0);
+			quatMul(ad, br, cross1);
+			for (int i = 0; i < 4; ++i) {
+				out_real[i] = real[i];
+				out_dual[i] = cross0[i] + cross1[i];
+			}
+		}
+
+		struct f32x4 {
+			float v[4];
+		};
+
+		inline f32x4 load(const float* p) { return f32x4{ { p[0], p[1], p[2], p[3] } }; }
+		inline void store(float* p, f32x4 v) { for (int i = 0; i < 4; ++i) p[i] = v.v[i]; }
+		inline f32x4 broadcast(float s) { return f32x4{ { s, s, s, s } }; }
+
+		inline f32x4 add(f32x4 a, f32x4 b) { for (int i = 0; i < 4; ++i) a.v[i] += b.v[i]; return a; }
+		inline f32x4 sub(f32x4 a, f32x4 b) { for (int i = 0; i < 4; ++i) a.v[i] -= b.v[i]; return a; }
+		inline f32x4 mul(f32x4 a, f32x4 b) { for (int i = 0; i < 4; ++i) a.v[i] *= b.v[i]; return a; }
+		inline f32x4 div(f32x4 a, f32x4 b) { for (int i = 0; i < 4; ++i) a.v[i] /= b.v[i]; return a; }
+
+		inline float dot(f32x4 a, f32x4 b) {
+			return a.v[0] * b.v[0] + a.v[1] * b.v[1] + a.v[2] * b.v[2] + a.v[3] * b.v[3];
+		}
+
+		inline f32x4 madd(f32x4 a, f32x4 b, f32x4 c) { for (int i = 0; i < 4; ++i) c.v[i] += a.v[i] * b.v[i]; return c; }
+		inline f32x4 sqrt(f32x4 a) { for (int i = 0; i < 4; ++i) a.v[i] = std::sqrt(a.v[i]); return a; }
+		inline f32x4 rsqrt(f32x4 a) { for (int i = 0; i < 4; ++i) a.v[i] = 1.0f / std::sqrt(a.v[i]); return a; }
+		inline f32x4 abs(f32x4 a) { for (int i = 0; i < 4; ++i) a.v[i] = std::fabs(a.v[i]); return a; }
+		inline f32x4 round(f32x4 a) { for (int i = 0; i < 4; ++i) a.v[i] = std::nearbyint(a.v[i]); return a; }
+		inline f32x4 min(f32x4 a, f32x4 b) { for (int i = 0; i < 4; ++i) a.v[i] = a.v[i] < b.v[i] ? a.v[i] : b.v[i]; return a; }
+		inline f32x4 max(f32x4 a, f32x4 b) { for (int i = 0; i < 4; ++i) a.v[i] = a.v[i] > b.v[i] ? a.v[i] : b.v[i]; return a; }
+
+		inline f32x4 less(f32x4 a, f32x4 b) { for (int i = 0; i < 4; ++i) a.v[i] = a.v[i] < b.v[i] ? 1.0f : 0.0f; return a; }
+		inline f32x4 equal(f32x4 a, f32x4 b) { for (int i = 0; i < 4; ++i) a.v[i] = a.v[i] == b.v[i] ? 1.0f : 0.0f; return a; }
+		inline f32x4 select(f32x4 mask, f32x4 a, f32x4 b) { for (int i = 0; i < 4; ++i) a.v[i] = mask.v[i] != 0.0f ? a.v[i] : b.v[i]; return a; }
+		inline f32x4 maskAnd(f32x4 a, f32x4 b) { for (int i = 0; i < 4; ++i) a.v[i] = a.v[i] != 0.0f && b.v[i] != 0.0f ? 1.0f : 0.0f; return a; }
+		inline f32x4 maskOr(f32x4 a, f32x4 b) { for (int i = 0; i < 4; ++i) a.v[i] = a.v[i] != 0.0f || b.v[i] != 0.0f ? 1.0f : 0.0f; return a; }
+		inline f32x4 maskNot(f32x4 a) { for (int i = 0; i < 4; ++i) a.v[i] = a.v[i] != 0.0f ? 0.0f : 1.0f; return a; }
+		inline int maskBits(f32x4 mask) { int bits = 0; for (int i = 0; i < 4; ++i) bits |= (mask.v[i] != 0.0f ? 1 : 0) << i; return bits; }
+#endif
+	}
+}
@@ -0,0 +1,3 @@
+#include "spline.hpp"
+
+namespace gem {}
\ No newline at end of file
@@ -0,0 +1,366 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include "math.hpp"
+#include "fast_math.hpp"
+#include "vector.hpp"
+#include "quaternion.hpp"
+#include "interpolation.hpp"
+
+namespace gem {
+	// CUBIC SEGMENT
+	// -------------------------------
+	// Every spline kind below is converted once into the power basis
+	// p(t) = c0 + c1 * t + c2 * t^2 + c3 * t^3, t in [0, 1], so evaluation is a Horner
+	// step per component and uniform sampling can use forward differences.
+
+	template<typename T, size_t N>
+	struct CubicSegment {
+		Vector<T, N> c0, c1, c2, c3;
+
+		// Curve through p0 and p3, pulled towards p1 and p2
+		static constexpr CubicSegment bezier(const Vector<T, N>& p0, const Vector<T, N>& p1, const Vector<T, N>& p2, const Vector<T, N>& p3) {
+			return CubicSegment{
+				p0,
+				(p1 - p0) * static_cast<T>(3),
+				(p0 - p1 * static_cast<T>(2) + p2) * static_cast<T>(3),
+				p3 - p0 + (p1 - p2) * static_cast<T>(3)
+			};
+		}
+
+		// Curve from p0 to p1 leaving with tangent m0 and arriving with tangent m1
+		static constexpr CubicSegment hermite(const Vector<T, N>& p0, const Vector<T, N>& m0, const Vector<T, N>& p1, const Vector<T, N>& m1) {
+			return CubicSegment{
+				p0,
+				m0,
+				(p1 - p0) * static_cast<T>(3) - m0 * static_cast<T>(2) - m1,
+				(p0 - p1) * static_cast<T>(2) + m0 + m1
+			};
+		}
+
+		// Uniform Catmull-Rom segment from p1 to p2, p0 and p3 shape the tangents
+		static constexpr CubicSegment catmullRom(const Vector<T, N>& p0, const Vector<T, N>& p1, const Vector<T, N>& p2, const Vector<T, N>& p3) {
+			return hermite(p1, (p2 - p0) * static_cast<T>(0.5), p2, (p3 - p1) * static_cast<T>(0.5));
+		}
+
+		constexpr Vector<T, N> evaluate(T t) const {
+			return ((c3 * t + c2) * t + c1) * t + c0;
+		}
+
+		constexpr Vector<T, N> derivative(T t) const {
+			return (c3 * (3 * t) + c2 * static_cast<T>(2)) * t + c1;
+		}
+
+		// Writes steps + 1 points at t = 0, 1 / steps, ..., 1. After the setup every point
+		// costs three vector additions, the rounding error grows with `steps`.
+		void forwardDifference(size_t steps, Vector<T, N>* out) const {
+			T h = static_cast<T>(1) / static_cast<T>(steps);
+			T h2 = h * h;
+			T h3 = h2 * h;
+
+			Vector<T, N> p = c0;
+			Vector<T, N> d1 = c1 * h + c2 * h2 + c3 * h3;
+			Vector<T, N> d2 = c2 * (2 * h2) + c3 * (6 * h3);
+			Vector<T, N> d3 = c3 * (6 * h3);
+
+			out[0] = p;
+			for (size_t i = 1; i <= steps; ++i) {
+				p += d1;
+				d1 += d2;
+				d2 += d3;
+				out[i] = p;
+			}
+		}
+
+		// Tangents at the same steps + 1 parameters, the derivative is a quadratic
+		void forwardDifferenceDerivative(size_t steps, Vector<T, N>* out) const {
+			T h = static_cast<T>(1) / static_cast<T>(steps);
+			T h2 = h * h;
+
+			Vector<T, N> d = c1;
+			Vector<T, N> d1 = c2 * (2 * h) + c3 * (3 * h2);
+			Vector<T, N> d2 = c3 * (6 * h2);
+
+			out[0] = d;
+			for (size_t i = 1; i <= steps; ++i) {
+				d += d1;
+				d1 += d2;
+				out[i] = d;
+			}
+		}
+	};
+
+	// CUBIC SPLINE
+	// -------------------------------
+	// Piecewise cubic curve. The spline parameter u runs over [0, 1] for the whole curve,
+	// every segment covers an equal share of it.
+
+	template<typename T, size_t N>
+	class CubicSpline {
+	public:
+		CubicSpline() = default;
+		explicit CubicSpline(std::vector<CubicSegment<T, N>> segments) : segments_(std::move(segments)) {}
+
+		// Passes through every point. Open curves extend the end tangents by mirroring the
+		// neighbouring point, closed curves wrap around to the first point.
+		static CubicSpline catmullRom(const std::vector<Vector<T, N>>& points, bool closed = false) {
+			if (points.size() < 2) {
+				throw std::runtime_error("Catmull-Rom spline needs at least 2 points");
+			}
+
+			size_t count = points.size();
+			auto point = [&](ptrdiff_t i) -> Vector<T, N> {
+				if (closed) return points[(i + count) % count];
+				if (i < 0) return points[0] * static_cast<T>(2) - points[1];
+				if (i >= static_cast<ptrdiff_t>(count)) return points[count - 1] * static_cast<T>(2) - points[count - 2];
+				return points[i];
+			};
+
+			std::vector<CubicSegment<T, N>> segments;
+			size_t segment_count = closed ? count : count - 1;
+			for (size_t i = 0; i < segment_count; ++i) {
+				ptrdiff_t k = static_cast<ptrdiff_t>(i);
+				segments.push_back(CubicSegment<T, N>::catmullRom(point(k - 1), point(k), point(k + 1), point(k + 2)));
+			}
+			return CubicSpline(std::move(segments));
+		}
+
+		// Control points p0, p1, p2, p3, p4, ... where every third point is on the curve
+		static CubicSpline bezier(const std::vector<Vector<T, N>>& points) {
+			if (points.size() < 4 || (points.size() - 1) % 3 != 0) {
+				throw std::runtime_error("Bezier spline needs 3 * n + 1 control points");
+			}
+
+			std::vector<CubicSegment<T, N>> segments;
+			for (size_t i = 0; i + 3 < points.size(); i += 3) {
+				segments.push_back(CubicSegment<T, N>::bezier(points[i], points[i + 1], points[i + 2], points[i + 3]));
+			}
+			return CubicSpline(std::move(segments));
+		}
+
+		static CubicSpline hermite(const std::vector<Vector<T, N>>& points, const std::vector<Vector<T, N>>& tangents) {
+			if (points.size() < 2 || points.size() != tangents.size()) {
+				throw std::runtime_error("Hermite spline needs at least 2 points with one tangent each");
+			}
+
+			std::vector<CubicSegment<T, N>> segments;
+			for (size_t i = 0; i + 1 < points.size(); ++i) {
+				segments.push_back(CubicSegment<T, N>::hermite(points[i], tangents[i], points[i + 1], tangents[i + 1]));
+			}
+			return CubicSpline(std::move(segments));
+		}
+
+		size_t segmentCount() const { return segments_.size(); }
+		const CubicSegment<T, N>& segment(size_t index) const { return segments_[index]; }
+
+		Vector<T, N> evaluate(T u) const {
+			T t;
+			const CubicSegment<T, N>& s = locate(u, t);
+			return s.evaluate(t);
+		}
+
+		// Derivative with respect to u
+		Vector<T, N> derivative(T u) const {
+			T t;
+			const CubicSegment<T, N>& s = locate(u, t);
+			return s.derivative(t) * static_cast<T>(segments_.size());
+		}
+
+		// steps_per_segment + 1 points per segment at uniform t, shared end points written once.
+		// `out` is resized to segmentCount() * steps_per_segment + 1.
+		void tessellate(size_t steps_per_segment, std::vector<Vector<T, N>>& out) const {
+			requireSampling(steps_per_segment);
+			out.resize(segments_.size() * steps_per_segment + 1);
+			for (size_t i = 0; i < segments_.size(); ++i) {
+				segments_[i].forwardDifference(steps_per_segment, out.data() + i * steps_per_segment);
+			}
+		}
+
+		// Derivatives with respect to u at the points tessellate() writes
+		void tessellateDerivatives(size_t steps_per_segment, std::vector<Vector<T, N>>& out) const {
+			requireSampling(steps_per_segment);
+			out.resize(segments_.size() * steps_per_segment + 1);
+			for (size_t i = 0; i < segments_.size(); ++i) {
+				segments_[i].forwardDifferenceDerivative(steps_per_segment, out.data() + i * steps_per_segment);
+			}
+
+			T scale = static_cast<T>(segments_.size());
+			for (auto& d : out) d *= scale;
+		}
+
+	private:
+		void requireSampling(size_t steps_per_segment) const {
+			if (segments_.empty() || steps_per_segment == 0) {
+				throw std::runtime_error("Cannot tessellate a spline without segments or steps");
+			}
+		}
+
+		const CubicSegment<T, N>& locate(T u, T& t) const {
+			if (segments_.empty()) {
+				throw std::runtime_error("Cannot evaluate a spline without segments");
+			}
+
+			T scaled = std::clamp(u, static_cast<T>(0), static_cast<T>(1)) * static_cast<T>(segments_.size());
+			size_t index = std::min(static_cast<size_t>(scaled), segments_.size() - 1);
+			t = scaled - static_cast<T>(index);
+			return segments_[index];
+		}
+
+		std::vector<CubicSegment<T, N>> segments_;
+	};
+
+	// ARC LENGTH
+	// -------------------------------
+	// The spline parameter does not move at constant speed along the curve. The table maps
+	// distance along the curve back to u from a polyline approximation, so cameras and
+	// previews can travel at constant speed and points can be spaced evenly.
+
+	template<typename T>
+	class ArcLengthTable {
+	public:
+		ArcLengthTable() = default;
+
+		template<size_t N>
+		ArcLengthTable(const CubicSpline<T, N>& spline, size_t samples_per_segment = 32) {
+			std::vector<Vector<T, N>> points;
+			spline.tessellate(samples_per_segment, points);
+
+			parameters_.resize(points.size());
+			lengths_.resize(points.size());
+
+			T length = 0;
+			T step = static_cast<T>(1) / static_cast<T>(points.size() - 1);
+			for (size_t i = 0; i < points.size(); ++i) {
+				if (i > 0) length += Vector<T, N>(points[i] - points[i - 1]).magnitude();
+				parameters_[i] = step * static_cast<T>(i);
+				lengths_[i] = length;
+			}
+			parameters_.back() = 1;
+		}
+
+		T length() const { return lengths_.empty() ? 0 : lengths_.back(); }
+
+		// Spline parameter at `distance` along the curve, clamped to the ends
+		T parameter(T distance) const {
+			if (lengths_.empty()) {
+				throw std::runtime_error("Arc length table is empty");
+			}
+
+			size_t i = static_cast<size_t>(std::upper_bound(lengths_.begin(), lengths_.end(), distance) - lengths_.begin());
+			return interpolate(i, distance);
+		}
+
+		// `count` parameters evenly spaced by distance from the start to the end of the curve.
+		// The distances only grow, so the table is walked once instead of searched per point.
+		void parameters(size_t count, std::vector<T>& out) const {
+			if (lengths_.empty()) {
+				throw std::runtime_error("Arc length table is empty");
+			}
+
+			out.resize(count);
+			T spacing = count > 1 ? length() / static_cast<T>(count - 1) : 0;
+
+			size_t i = 1;
+			for (size_t k = 0; k < count; ++k) {
+				T distance = spacing * static_cast<T>(k);
+				while (i < lengths_.size() && lengths_[i] <= distance) ++i;
+				out[k] = interpolate(i, distance);
+			}
+		}
+
+	private:
+		// Parameter between table entries i - 1 and i
+		T interpolate(size_t i, T distance) const {
+			if (i == 0) return parameters_.front();
+			if (i >= lengths_.size()) return parameters_.back();
+
+			T span = lengths_[i] - lengths_[i - 1];
+			T f = span > 0 ? (distance - lengths_[i - 1]) / span : 0;
+			return parameters_[i - 1] + (parameters_[i] - parameters_[i - 1]) * f;
+		}
+
+		std::vector<T> parameters_;
+		std::vector<T> lengths_;
+	};
+
+	// QUATERNION SPLINE
+	// -------------------------------
+
+	namespace detail {
+		// log of a unit quaternion, a pure quaternion (0, axis * angle / 2)
+		template<typename T>
+		Quaternion<T> log(const Quaternion<T>& q) {
+			T w = std::clamp(q.w(), static_cast<T>(-1), static_cast<T>(1));
+			T half_angle = math::acos(w);
+			T s = math::sin(half_angle);
+			T k = s > static_cast<T>(1e-6) ? half_angle / s : 1;
+			return Quaternion<T>(0, q.x() * k, q.y() * k, q.z() * k);
+		}
+
+		// exp of a pure quaternion, the inverse of log
+		template<typename T>
+		Quaternion<T> exp(const Quaternion<T>& q) {
+			T half_angle = math::sqrt(q.x() * q.x() + q.y() * q.y() + q.z() * q.z());
+			T s = math::sin(half_angle);
+			T k = half_angle > static_cast<T>(1e-6) ? s / half_angle : 1;
+			return Quaternion<T>(math::cos(half_angle), q.x() * k, q.y() * k, q.z() * k);
+		}
+	}
+
+	// Spherical cubic interpolation between q0 and q1 with the inner control points a0 and a1
+	template<typename T>
+	Quaternion<T> squad(const Quaternion<T>& q0, const Quaternion<T>& a0, const Quaternion<T>& a1, const Quaternion<T>& q1, float t) {
+		return slerp(slerp(q0, q1, t), slerp(a0, a1, t), 2 * t * (1 - t));
+	}
+
+	// Smooth rotation curve through unit quaternion keys, evaluated with squad. The inner
+	// control points are computed once so that the angular velocity is continuous at the keys.
+	template<typename T>
+	class QuaternionSpline {
+	public:
+		QuaternionSpline() = default;
+
+		explicit QuaternionSpline(const std::vector<Quaternion<T>>& keys) : keys_(keys) {
+			if (keys_.size() < 2) {
+				throw std::runtime_error("Quaternion spline needs at least 2 keys");
+			}
+
+			// Neighbouring keys in one hemisphere, the controls then stay close to the keys
+			for (size_t i = 1; i < keys_.size(); ++i) {
+				if (keys_[i - 1].dot(keys_[i]) < 0) keys_[i] = -keys_[i];
+			}
+
+			// The end keys act as their own controls, as if the curve continued with the same turn
+			controls_ = keys_;
+			for (size_t i = 1; i + 1 < keys_.size(); ++i) {
+				Quaternion<T> inverse = keys_[i].conjugate();
+				Quaternion<T> to_next = detail::log(inverse * keys_[i + 1]);
+				Quaternion<T> to_previous = detail::log(inverse * keys_[i - 1]);
+				Quaternion<T> sum(0, -(to_next.x() + to_previous.x()) / 4, -(to_next.y() + to_previous.y()) / 4, -(to_next.z() + to_previous.z()) / 4);
+				controls_[i] = keys_[i] * detail::exp(sum);
+			}
+		}
+
+		size_t segmentCount() const { return keys_.empty() ? 0 : keys_.size() - 1; }
+
+		Quaternion<T> evaluate(T u) const {
+			if (keys_.empty()) {
+				throw std::runtime_error("Cannot evaluate a spline without keys");
+			}
+
+			T scaled = std::clamp(u, static_cast<T>(0), static_cast<T>(1)) * static_cast<T>(segmentCount());
+			size_t i = std::min(static_cast<size_t>(scaled), segmentCount() - 1);
+			T t = scaled - static_cast<T>(i);
+			return squad(keys_[i], controls_[i], controls_[i + 1], keys_[i + 1], static_cast<float>(t));
+		}
+
+	private:
+		std::vector<Quaternion<T>> keys_;
+		std::vector<Quaternion<T>> controls_;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,3 @@
+#include "transform.hpp"
+
+namespace gem {}
\ No newline at end of file
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <cmath>
+#include <stdexcept>
+
+#include "matrix.hpp"
+
+namespace gem {
+	template <typename T, size_t N>
+	struct Vector; // Forward declaration
+
+	template <typename T>
+	struct Quaternion; // Forward declaration
+
+	template<typename T>
+	constexpr Quaternion<T> slerp(Quaternion<T> a, Quaternion<T> b, float t); // Forward declaration
+
+	// Translation * Rotation * Scale kept as its parts (10 values instead of 16).
+	// Composition is exact as long as a parent with a non-uniform scale does not rotate
+	// its children, since TRS cannot represent the resulting shear.
+	template<typename T>
+	struct Transform {
+		Vector<T, 3> position;
+		Quaternion<T> rotation;
+		Vector<T, 3> scale;
+
+		constexpr Transform() : position{ 0, 0, 0 }, rotation(), scale{ 1, 1, 1 } {}
+		constexpr Transform(const Vector<T, 3>& position, const Quaternion<T>& rotation, const Vector<T, 3>& scale)
+			: position(position), rotation(rotation), scale(scale) {}
+
+		static constexpr Transform<T> identity() {
+			return Transform<T>();
+		}
+
+		// COMPOSITION OPERATOR
+		// -------------------------------
+
+		// Returns the transform of `child` expressed in the space this transform lives in (parent * child)
+		constexpr Transform<T> operator*(const Transform<T>& child) const {
+			return Transform<T>(
+				position + rotation.rotate(scale * child.position),
+				rotation * child.rotation,
+				scale * child.scale
+			);
+		}
+
+		// INVERSE FUNCTION
+		// -------------------------------
+
+		// The inverse S^-1 * R^-1 * T^-1 is a TRS again only for a uniform scale, other
+		// scales throw: use inverseMatrix() or inverseTransformPoint() for those
+		constexpr Transform<T> inverse() const {
+			if (scale[0] == 0 || scale[1] == 0 || scale[2] == 0) {
+				throw std::runtime_error("Transform is not invertible");
+			}
+			if (scale[0] != scale[1] || scale[0] != scale[2]) {
+				throw std::runtime_error("Transform with a non-uniform scale has no TRS inverse");
+			}
+
+			Vector<T, 3> invScale = static_cast<T>(1) / scale;
+			Quaternion<T> invRotation = rotation.conjugate();
+
+			return Transform<T>(
+				invScale * invRotation.rotate(-position),
+				invRotation,
+				invScale
+			);
+		}
+
+		// Inverse of toMatrix(), exact for any scale
+		constexpr Matrix4<T> inverseMatrix() const {
+			return Matrix4<T>::inverseTRS(position, rotation, scale);
+		}
+
+		// TRANSFORMATION FUNCTIONS
+		// -------------------------------
+
+		// Applies scale, rotation and translation to a point
+		constexpr Vector<T, 3> transformPoint(const Vector<T, 3>& point) const {
+			return position + rotation.rotate(scale * point);
+		}
+
+		// Applies scale and rotation to a vector (no translation)
+		constexpr Vector<T, 3> transformVector(const Vector<T, 3>& vec) const {
+			return rotation.rotate(scale * vec);
+		}
+
+		// Applies only the rotation, keeps the length of the direction
+		constexpr Vector<T, 3> transformDirection(const Vector<T, 3>& dir) const {
+			return rotation.rotate(dir);
+		}
+
+		// Maps a point back into the local space, exact for any scale
+		constexpr Vector<T, 3> inverseTransformPoint(const Vector<T, 3>& point) const {
+			return rotation.conjugate().rotate(point - position) / scale;
+		}
+
+		// CONVERSION FUNCTIONS
+		// -------------------------------
+
+		// Same result as translation(position) * rotation(rotation) * scale(scale), built directly
+		constexpr Matrix4<T> toMatrix() const {
+			return toTransformMatrix<4>();
+		}
+
+		// toMatrix() without its constant last row
+		constexpr Matrix3x4<T> toAffine() const {
+			return toTransformMatrix<3>();
+		}
+
+	private:
+		template<size_t R>
+		constexpr Matrix<T, R, 4> toTransformMatrix() const {
+			Matrix<T, R, 4> result = Matrix<T, R, 4>::rotation(rotation);
+
+			for (int i = 0; i < 3; ++i) {
+				result(i, 0) *= scale[0];
+				result(i, 1) *= scale[1];
+				result(i, 2) *= scale[2];
+				result(i, 3) = position[i];
+			}
+
+			return result;
+		}
+	};
+
+	// Interpolates position and scale linearly and the rotation spherically
+	template<typename T>
+	constexpr Transform<T> interpolate(const Transform<T>& a, const Transform<T>& b, float t) {
+		return Transform<T>(
+			a.position + (b.position - a.position) * t,
+			slerp(a.rotation, b.rotation, t),
+			a.scale + (b.scale - a.scale) * t
+		);
+	}
+}
\ No newline at end of file
@@ -2,106 +2,233 @@
 
 #include <cmath>
 #include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "math.hpp"
+#include "simd.hpp"
 
 namespace gem {
 	template<typename T, size_t N>
-	struct Vector {
-		T data[N];
+	struct Vector; // Forward declaration
+
+	// EXPRESSION TRAITS
+	// -------------------------------
+	// Arithmetic on vectors does not compute anything by itself. Every operator returns a
+	// lightweight expression node and the whole tree is evaluated element by element in a
+	// single pass once it is assigned to (or converted into) a Vector.
+
+	namespace detail {
+		struct VectorExprTag {};
+
+		template<typename E>
+		struct IsVector : std::false_type {};
+
+		template<typename T, size_t N>
+		struct IsVector<Vector<T, N>> : std::true_type {};
+
+		template<typename E>
+		struct IsVectorExpression : std::bool_constant<IsVector<E>::value || std::is_base_of_v<VectorExprTag, E>> {};
+	}
+
+	template<typename E>
+	concept VectorExpression = detail::IsVectorExpression<std::remove_cvref_t<E>>::value;
+
+	template<typename E>
+	concept Scalar = std::is_arithmetic_v<std::remove_cvref_t<E>>;
+
+	template<typename L, typename R>
+	concept CompatibleVectorExpressions = VectorExpression<L> && VectorExpression<R> &&
+		std::is_same_v<typename std::remove_cvref_t<L>::value_type, typename std::remove_cvref_t<R>::value_type> &&
+		std::remove_cvref_t<L>::extent == std::remove_cvref_t<R>::extent;
+
+	namespace detail {
+		// Lvalue vectors are referenced, temporaries and nested expressions are held by value
+		template<typename E>
+		using Operand = std::conditional_t<
+			std::is_lvalue_reference_v<E> && IsVector<std::remove_cvref_t<E>>::value,
+			const std::remove_cvref_t<E>&,
+			std::remove_cvref_t<E>>;
+
+		template<typename E>
+		using ValueType = typename std::remove_cvref_t<E>::value_type;
+
+		template<typename A, typename B>
+		constexpr ValueType<A> dot(const A& a, const B& b) {
+			if constexpr (std::is_same_v<ValueType<A>, float> && std::remove_cvref_t<A>::extent == 4) {
+				if (!std::is_constant_evaluated()) {
+					return simd::dot(a.packet(), b.packet());
+				}
+			}
 
-		T& operator[](size_t index) { return data[index]; }
-		const T& operator[](size_t index) const { return data[index]; }
+			ValueType<A> sum = a[0] * b[0];
+			for (size_t i = 1; i < std::remove_cvref_t<A>::extent; ++i) {
+				sum += a[i] * b[i];
+			}
+			return sum;
+		}
 
-		// ADDITION OPERATORS
+		// ELEMENT-WISE OPERATIONS
 		// -------------------------------
 
-		Vector<T, N> operator+(const Vector<T, N>& other) const {
-			Vector<T, N> result;
-			VectorAdd<N>::compute(data, other.data, result.data);
-			return result;
-		}
+		struct Add {
+			template<typename T> static constexpr T apply(T a, T b) { return a + b; }
+			static simd::f32x4 apply(simd::f32x4 a, simd::f32x4 b) { return simd::add(a, b); }
+		};
 
-		Vector<T, N> operator+(T scalar) const {
-			Vector<T, N> result;
-			VectorAddScalar<N>::compute(data, scalar, result.data);
-			return result;
-		}
+		struct Sub {
+			template<typename T> static constexpr T apply(T a, T b) { return a - b; }
+			static simd::f32x4 apply(simd::f32x4 a, simd::f32x4 b) { return simd::sub(a, b); }
+		};
 
-		friend Vector<T, N> operator+(T scalar, const Vector<T, N>& v) {
-			return v + scalar;
-		}
+		struct Mul {
+			template<typename T> static constexpr T apply(T a, T b) { return a * b; }
+			static simd::f32x4 apply(simd::f32x4 a, simd::f32x4 b) { return simd::mul(a, b); }
+		};
 
-		// SUBTRACTION OPERATORS
-		// --------------------------------
+		struct Div {
+			template<typename T> static constexpr T apply(T a, T b) { return a / b; }
+			static simd::f32x4 apply(simd::f32x4 a, simd::f32x4 b) { return simd::div(a, b); }
+		};
 
-		Vector<T, N> operator-(const Vector<T, N>& other) const {
-			Vector<T, N> result;
-			VectorSub<N>::compute(data, other.data, result.data);
-			return result;
-		}
+		struct Negate {
+			template<typename T> static constexpr T apply(T a) { return a * -1; }
+			static simd::f32x4 apply(simd::f32x4 a) { return simd::mul(a, simd::broadcast(-1.0f)); }
+		};
+	}
 
-		Vector<T, N> operator-(T scalar) const {
-			Vector<T, N> result;
-			VectorSubScalar<N>::compute(data, scalar, result.data);
-			return result;
-		}
+	// EXPRESSION NODES
+	// -------------------------------
 
-		friend Vector<T, N> operator-(T scalar, const Vector<T, N>& v) {
-			Vector<T, N> result;
-			ScalarSubVector<N>::compute(scalar, v.data, result.data);
-			return result;
-		}
+	// Common interface of all expression nodes, so that an unevaluated expression can be
+	// used wherever a Vector was used before (indexing, size, dot, magnitude, ...).
+	template<typename Derived, typename T, size_t N>
+	struct VectorExprBase : detail::VectorExprTag {
+		using value_type = T;
+		static constexpr size_t extent = N;
 
-		// MULTIPLICATION OPERATORS
-		// --------------------------------
+		constexpr const Derived& self() const { return static_cast<const Derived&>(*this); }
 
-		Vector<T, N> operator*(const Vector<T, N>& other) const {
-			Vector<T, N> result;
-			VectorMul<N>::compute(data, other.data, result.data);
-			return result;
-		}
+		constexpr size_t size() const { return N; }
 
-		Vector<T, N> operator*(T scalar) const {
+		// Evaluates the expression into a Vector
+		constexpr Vector<T, N> eval() const {
 			Vector<T, N> result;
-			VectorMulScalar<N>::compute(data, scalar, result.data);
+			result = self();
 			return result;
 		}
 
-		friend Vector<T, N> operator*(T scalar, const Vector<T, N>& v) {
-			return v * scalar;
-		}
+		constexpr operator Vector<T, N>() const { return eval(); }
 
-		// DIVISION OPERATORS
-		// --------------------------------
+		constexpr T dot(const Vector<T, N>& other) const { return detail::dot(self(), other); }
+		constexpr T magnitude() const { return math::sqrt(detail::dot(self(), self())); }
+		constexpr Vector<T, N> normalize() const { return eval().normalize(); }
+		constexpr Vector<T, N> negate() const { return eval().negate(); }
+		constexpr Vector<T, 3> cross(const Vector<T, 3>& other) const { return eval().cross(other); }
+	};
 
-		Vector<T, N> operator/(const Vector<T, N>& other) const {
-			Vector<T, N> result;
-			VectorDiv<N>::compute(data, other.data, result.data);
-			return result;
-		}
+	// Scalar operand broadcast to every element
+	template<typename T>
+	struct ScalarExpr {
+		T value;
 
-		Vector<T, N> operator/(T scalar) const {
-			Vector<T, N> result;
-			VectorDivScalar<N>::compute(data, scalar, result.data);
-			return result;
-		}
+		constexpr T operator[](size_t) const { return value; }
+		simd::f32x4 packet() const { return simd::broadcast(value); }
+	};
 
-		friend Vector<T, N> operator/(T scalar, const Vector<T, N>& v) {
-			Vector<T, N> result;
-			ScalarDivVector<N>::compute(scalar, v.data, result.data);
-			return result;
-		}
+	template<typename Op, typename L, typename R>
+	struct VectorBinaryExpr : VectorExprBase<
+		VectorBinaryExpr<Op, L, R>,
+		typename std::conditional_t<detail::IsVectorExpression<std::remove_cvref_t<L>>::value, std::remove_cvref_t<L>, std::remove_cvref_t<R>>::value_type,
+		std::conditional_t<detail::IsVectorExpression<std::remove_cvref_t<L>>::value, std::remove_cvref_t<L>, std::remove_cvref_t<R>>::extent>
+	{
+		L lhs;
+		R rhs;
+
+		template<typename A, typename B>
+		constexpr VectorBinaryExpr(A&& a, B&& b) : lhs(std::forward<A>(a)), rhs(std::forward<B>(b)) {}
+
+		constexpr auto operator[](size_t index) const { return Op::apply(lhs[index], rhs[index]); }
+		simd::f32x4 packet() const { return Op::apply(lhs.packet(), rhs.packet()); }
+	};
+
+	template<typename Op, typename E>
+	struct VectorUnaryExpr : VectorExprBase<VectorUnaryExpr<Op, E>, typename std::remove_cvref_t<E>::value_type, std::remove_cvref_t<E>::extent> {
+		E operand;
+
+		template<typename A>
+		constexpr explicit VectorUnaryExpr(A&& a) : operand(std::forward<A>(a)) {}
+
+		constexpr auto operator[](size_t index) const { return Op::apply(operand[index]); }
+		simd::f32x4 packet() const { return Op::apply(operand.packet()); }
+	};
+
+	template<typename T, size_t N>
+	struct Vector {
+		T data[N];
+
+		using value_type = T;
+		static constexpr size_t extent = N;
+
+		// Vector<float, 4> evaluates its expressions as a single gem::simd packet,
+		// constant evaluation always takes the scalar path
+		static constexpr bool USE_SIMD = std::is_same_v<T, float> && N == 4;
+
+		constexpr T& operator[](size_t index) { return data[index]; }
+		constexpr const T& operator[](size_t index) const { return data[index]; }
+
+		simd::f32x4 packet() const { return simd::load(data); }
 
-		// NEGATION OPERATOR & FUNCTION
+		// EXPRESSION ASSIGNMENT
 		// -------------------------------
 
-		Vector<T, N> operator-() const {
-			Vector<T, N> result;
-			VectorMulScalar<N>::compute(data, -1, result.data);
-			return result;
+		// Evaluates the whole expression tree in one pass, without intermediate vectors.
+		// Expressions are element-wise, so the target may also appear as an operand.
+		template<typename E> requires CompatibleVectorExpressions<Vector<T, N>, E> && (!detail::IsVector<std::remove_cvref_t<E>>::value)
+		constexpr Vector<T, N>& operator=(const E& expr) {
+			if constexpr (USE_SIMD) {
+				if (!std::is_constant_evaluated()) {
+					simd::store(data, expr.packet());
+					return *this;
+				}
+			}
+
+			for (size_t i = 0; i < N; ++i) {
+				data[i] = expr[i];
+			}
+			return *this;
 		}
 
+		// COMPOUND ASSIGNMENT OPERATORS
+		// -------------------------------
+
+		template<typename E> requires CompatibleVectorExpressions<Vector<T, N>, E>
+		constexpr Vector<T, N>& operator+=(const E& other) { return *this = *this + other; }
+
+		template<typename E> requires CompatibleVectorExpressions<Vector<T, N>, E>
+		constexpr Vector<T, N>& operator-=(const E& other) { return *this = *this - other; }
+
+		template<typename E> requires CompatibleVectorExpressions<Vector<T, N>, E>
+		constexpr Vector<T, N>& operator*=(const E& other) { return *this = *this * other; }
+
+		template<typename E> requires CompatibleVectorExpressions<Vector<T, N>, E>
+		constexpr Vector<T, N>& operator/=(const E& other) { return *this = *this / other; }
+
+		template<Scalar S>
+		constexpr Vector<T, N>& operator+=(S scalar) { return *this = *this + scalar; }
+
+		template<Scalar S>
+		constexpr Vector<T, N>& operator-=(S scalar) { return *this = *this - scalar; }
+
+		template<Scalar S>
+		constexpr Vector<T, N>& operator*=(S scalar) { return *this = *this * scalar; }
+
+		template<Scalar S>
+		constexpr Vector<T, N>& operator/=(S scalar) { return *this = *this / scalar; }
+
 		// Returns the negated version of the vector
-		Vector<T, N> negate() const {
+		constexpr Vector<T, N> negate() const {
 			return -*this;
 		}
 
@@ -109,15 +236,21 @@ namespace gem {
 		// -------------------------------
 
 		// Returns the dot product of this vector with another vector
-		T dot(const Vector<T, N>& other) const {
-			return VectorDotProduct<N>::compute(data, other.data);
+		constexpr T dot(const Vector<T, N>& other) const {
+			return detail::dot(*this, other);
+		}
+
+		// Returns the dot product of this vector with an unevaluated expression
+		template<typename E> requires CompatibleVectorExpressions<Vector<T, N>, E> && (!detail::IsVector<std::remove_cvref_t<E>>::value)
+		constexpr T dot(const E& other) const {
+			return detail::dot(*this, other);
 		}
 
 		// CROSS PRODUCT FUNCTION (Only for 3D Vectors)
 		// -------------------------------
 
 		// Returns the cross product of this vector with another vector (only for 3D vectors)
-		Vector<T, 3> cross(const Vector<T, 3>& other) const {
+		constexpr Vector<T, 3> cross(const Vector<T, 3>& other) const {
 			static_assert(N == 3, "gem: Cross product is only defined for 3D vectors.");
 			Vector<T, 3> result;
 			result[0] = data[1] * other.data[2] - data[2] * other.data[1];
@@ -130,225 +263,106 @@ namespace gem {
 		// -------------------------------
 
 		// Returns the magnitude (length) of the vector
-		T magnitude() const {
-			return std::sqrt(VectorSquareSum<N>::compute(data));
+		constexpr T magnitude() const {
+			return math::sqrt(detail::dot(*this, *this));
 		}
 
 		// Returns a normalized (unit length) version of the vector
-		Vector<T, N> normalize() const {
+		constexpr Vector<T, N> normalize() const {
 			T mag = magnitude();
 			if (mag == 0) return *this;
 
-			Vector<T, N> result;
-			VectorDivScalar<N>::compute(data, mag, result.data);
-
-			return result;
+			return *this / mag;
 		}
 
-		size_t size() const { return N; }
-
-	private:
-		// Template for Vector Addition Cases
-		template<size_t N>
-		struct VectorAdd {
-			static inline void compute(const T* a, const T* b, T* result) {
-				VectorAdd<N - 1>::compute(a, b, result);
-				result[N - 1] = a[N - 1] + b[N - 1];
-			}
-		};
-
-		// Template for Vector Addition Cases (Base Case)
-		template<>
-		struct VectorAdd<1> {
-			static inline void compute(const T* a, const T* b, T* result) {
-				result[0] = a[0] + b[0];
-			}
-		};
-
-		// Template for Vector and Scalar Addition Cases
-		template<size_t N>
-		struct VectorAddScalar {
-			static inline void compute(const T* a, const T b, T* result) {
-				VectorAddScalar<N - 1>::compute(a, b, result);
-				result[N - 1] = a[N - 1] + b;
-			}
-		};
-
-		// Template for Vector and Scalar Addition Cases (Base Case)
-		template<>
-		struct VectorAddScalar<1> {
-			static inline void compute(const T* a, const T b, T* result) {
-				result[0] = a[0] + b;
-			}
-		};
-
-		// Template for Vector Subtraction Cases
-		template<size_t N>
-		struct VectorSub {
-			static inline void compute(const T* a, const T* b, T* result) {
-				VectorSub<N - 1>::compute(a, b, result);
-				result[N - 1] = a[N - 1] - b[N - 1];
-			}
-		};
-		
-		// Template for Vector Subtraction Cases (Base Case)
-		template<>
-		struct VectorSub<1> {
-			static inline void compute(const T* a, const T* b, T* result) {
-				result[0] = a[0] - b[0];
-			}
-		};
-
-		// Template for Vector and Scalar Subtraction Cases
-		template<size_t N>
-		struct VectorSubScalar {
-			static inline void compute(const T* a, const T b, T* result) {
-				VectorSubScalar<N - 1>::compute(a, b, result);
-				result[N - 1] = a[N - 1] - b;
-			}
-		};
-
-		// Template for Vector and Scalar Subtraction Cases (Base Case)
-		template<>
-		struct VectorSubScalar<1> {
-			static inline void compute(const T* a, const T b, T* result) {
-				result[0] = a[0] - b;
-			}
-		};
-
-		// Template for Scalar and Vector Subtraction Cases
-		template<size_t N>
-		struct ScalarSubVector {
-			static inline void compute(const T a, const T* b, T* result) {
-				ScalarSubVector<N - 1>::compute(a, b, result);
-				result[N - 1] = a - b[N - 1];
-			}
-		};
-
-		// Template for Scalar and Vector Subtraction Cases (Base Case)
-		template<>
-		struct ScalarSubVector<1> {
-			static inline void compute(const T a, const T* b, T* result) {
-				result[0] = a - b[0];
-			}
-		};
-
-		// Template for Vector Multiplcation Cases
-		template<size_t N>
-		struct VectorMul {
-			static inline void compute(const T* a, const T* b, T* result) {
-				VectorMul<N - 1>::compute(a, b, result);
-				result[N - 1] = a[N - 1] * b[N - 1];
-			}
-		};
-
-		// Template for Vector Multiplcation Cases (Base Case)
-		template<>
-		struct VectorMul<1> {
-			static inline void compute(const T* a, const T* b, T* result) {
-				result[0] = a[0] * b[0];
-			}
-		};
-
-		// Template for Vector and Scalar Multiplication Cases
-		template<size_t N>
-		struct VectorMulScalar {
-			static inline void compute(const T* a, const T b, T* result) {
-				VectorMulScalar<N - 1>::compute(a, b, result);
-				result[N - 1] = a[N - 1] * b;
-			}
-		};
-
-		// Template for Vector and Scalar Multiplication Cases (Base Case)
-		template<>
-		struct VectorMulScalar<1> {
-			static inline void compute(const T* a, const T b, T* result) {
-				result[0] = a[0] * b;
-			}
-		};
-
-		// Template for Vector Division Cases
-		template<size_t N>
-		struct VectorDiv {
-			static inline void compute(const T* a, const T* b, T* result) {
-				VectorDiv<N - 1>::compute(a, b, result);
-				result[N - 1] = a[N - 1] / b[N - 1];
-			}
-		};
-
-		// Template for Vector Multiplcation Cases (Base Case)
-		template<>
-		struct VectorDiv<1> {
-			static inline void compute(const T* a, const T* b, T* result) {
-				result[0] = a[0] / b[0];
-			}
-		};
-
-		// Template for Vector and Scalar Division Cases
-		template<size_t N>
-		struct VectorDivScalar {
-			static inline void compute(const T* a, const T b, T* result) {
-				VectorDivScalar<N - 1>::compute(a, b, result);
-				result[N - 1] = a[N - 1] / b;
-			}
-		};
-
-		// Template for Vector and Scalar Division Cases (Base Case)
-		template<>
-		struct VectorDivScalar<1> {
-			static inline void compute(const T* a, const T b, T* result) {
-				result[0] = a[0] / b;
-			}
-		};
-
-		// Template for Scalar and Vector Division Cases
-		template<size_t N>
-		struct ScalarDivVector {
-			static inline void compute(const T a, const T* b, T* result) {
-				ScalarDivVector<N - 1>::compute(a, b, result);
-				result[N - 1] = a / b[N - 1];
-			}
-		};
-
-		// Template for Scalar and Vector Division Cases (Base Case)
-		template<>
-		struct ScalarDivVector<1> {
-			static inline void compute(const T a, const T* b, T* result) {
-				result[0] = a / b[0];
-			}
-		};
-
-
-		// Template for Vector Square Sum Cases
-		template<size_t N>
-		struct VectorSquareSum {
-			static inline T compute(const T* a) {
-				return a[N - 1] * a[N - 1] + VectorSquareSum<N - 1>::compute(a);
-			}
-		};
-
-		// Template for Vector Square Sum Cases (Base Case)
-		template<>
-		struct VectorSquareSum<1> {
-			static inline T compute(const T* a) {
-				return a[0] * a[0];
-			}
-		};
-
-		// Template for Vector Dot Product Cases
-		template<size_t N>
-		struct VectorDotProduct {
-			static inline T compute(const T* a, const T* b) {
-				return a[N - 1] * b[N - 1] + VectorDotProduct<N - 1>::compute(a, b);
-			}
-		};
-
-		// Template for Vector Dot Product Cases (Base Case)
-		template<>
-		struct VectorDotProduct<1> {
-			static inline T compute(const T* a, const T* b) {
-				return a[0] * b[0];
-			}
-		};
+		constexpr size_t size() const { return N; }
 	};
+
+	// ADDITION OPERATORS
+	// -------------------------------
+
+	template<typename L, typename R> requires CompatibleVectorExpressions<L, R>
+	constexpr auto operator+(L&& lhs, R&& rhs) {
+		return VectorBinaryExpr<detail::Add, detail::Operand<L>, detail::Operand<R>>(std::forward<L>(lhs), std::forward<R>(rhs));
+	}
+
+	template<VectorExpression E, Scalar S>
+	constexpr auto operator+(E&& v, S scalar) {
+		using T = detail::ValueType<E>;
+		return VectorBinaryExpr<detail::Add, detail::Operand<E>, ScalarExpr<T>>(std::forward<E>(v), ScalarExpr<T>{ static_cast<T>(scalar) });
+	}
+
+	template<Scalar S, VectorExpression E>
+	constexpr auto operator+(S scalar, E&& v) {
+		using T = detail::ValueType<E>;
+		return VectorBinaryExpr<detail::Add, ScalarExpr<T>, detail::Operand<E>>(ScalarExpr<T>{ static_cast<T>(scalar) }, std::forward<E>(v));
+	}
+
+	// SUBTRACTION OPERATORS
+	// --------------------------------
+
+	template<typename L, typename R> requires CompatibleVectorExpressions<L, R>
+	constexpr auto operator-(L&& lhs, R&& rhs) {
+		return VectorBinaryExpr<detail::Sub, detail::Operand<L>, detail::Operand<R>>(std::forward<L>(lhs), std::forward<R>(rhs));
+	}
+
+	template<VectorExpression E, Scalar S>
+	constexpr auto operator-(E&& v, S scalar) {
+		using T = detail::ValueType<E>;
+		return VectorBinaryExpr<detail::Sub, detail::Operand<E>, ScalarExpr<T>>(std::forward<E>(v), ScalarExpr<T>{ static_cast<T>(scalar) });
+	}
+
+	template<Scalar S, VectorExpression E>
+	constexpr auto operator-(S scalar, E&& v) {
+		using T = detail::ValueType<E>;
+		return VectorBinaryExpr<detail::Sub, ScalarExpr<T>, detail::Operand<E>>(ScalarExpr<T>{ static_cast<T>(scalar) }, std::forward<E>(v));
+	}
+
+	// MULTIPLICATION OPERATORS
+	// --------------------------------
+
+	template<typename L, typename R> requires CompatibleVectorExpressions<L, R>
+	constexpr auto operator*(L&& lhs, R&& rhs) {
+		return VectorBinaryExpr<detail::Mul, detail::Operand<L>, detail::Operand<R>>(std::forward<L>(lhs), std::forward<R>(rhs));
+	}
+
+	template<VectorExpression E, Scalar S>
+	constexpr auto operator*(E&& v, S scalar) {
+		using T = detail::ValueType<E>;
+		return VectorBinaryExpr<detail::Mul, detail::Operand<E>, ScalarExpr<T>>(std::forward<E>(v), ScalarExpr<T>{ static_cast<T>(scalar) });
+	}
+
+	template<Scalar S, VectorExpression E>
+	constexpr auto operator*(S scalar, E&& v) {
+		using T = detail::ValueType<E>;
+		return VectorBinaryExpr<detail::Mul, ScalarExpr<T>, detail::Operand<E>>(ScalarExpr<T>{ static_cast<T>(scalar) }, std::forward<E>(v));
+	}
+
+	// DIVISION OPERATORS
+	// --------------------------------
+
+	template<typename L, typename R> requires CompatibleVectorExpressions<L, R>
+	constexpr auto operator/(L&& lhs, R&& rhs) {
+		return VectorBinaryExpr<detail::Div, detail::Operand<L>, detail::Operand<R>>(std::forward<L>(lhs), std::forward<R>(rhs));
+	}
+
+	template<VectorExpression E, Scalar S>
+	constexpr auto operator/(E&& v, S scalar) {
+		using T = detail::ValueType<E>;
+		return VectorBinaryExpr<detail::Div, detail::Operand<E>, ScalarExpr<T>>(std::forward<E>(v), ScalarExpr<T>{ static_cast<T>(scalar) });
+	}
+
+	template<Scalar S, VectorExpression E>
+	constexpr auto operator/(S scalar, E&& v) {
+		using T = detail::ValueType<E>;
+		return VectorBinaryExpr<detail::Div, ScalarExpr<T>, detail::Operand<E>>(ScalarExpr<T>{ static_cast<T>(scalar) }, std::forward<E>(v));
+	}
+
+	// NEGATION OPERATOR
+	// -------------------------------
+
+	template<VectorExpression E>
+	constexpr auto operator-(E&& v) {
+		return VectorUnaryExpr<detail::Negate, detail::Operand<E>>(std::forward<E>(v));
+	}
 }
\ No newline at end of file
@@ -0,0 +1,3 @@
+#include "vector_array.hpp"
+
+namespace gem {}
\ No newline at end of file
@@ -0,0 +1,460 @@
+#pragma once
+
+#include <cmath>
+#include <array>
+#include <cstddef>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "vector.hpp"
+#include "matrix.hpp"
+#include "simd.hpp"
+#include "fast_math.hpp"
+
+// std::array<__m128, N> drops the vector type's may_alias attribute, which is harmless here
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wignored-attributes"
+#endif
+
+namespace gem {
+	template<typename T>
+	struct Quaternion; // Forward declaration
+
+	// ALIGNED ALLOCATOR
+	// -------------------------------
+
+	template<typename T, size_t Alignment>
+	struct AlignedAllocator {
+		using value_type = T;
+
+		template<typename U>
+		struct rebind { using other = AlignedAllocator<U, Alignment>; };
+
+		AlignedAllocator() = default;
+
+		template<typename U>
+		AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept {}
+
+		T* allocate(size_t count) {
+			return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t(Alignment)));
+		}
+
+		void deallocate(T* pointer, size_t) noexcept {
+			::operator delete(pointer, std::align_val_t(Alignment));
+		}
+
+		template<typename U>
+		bool operator==(const AlignedAllocator<U, Alignment>&) const noexcept { return true; }
+	};
+
+	// VECTOR ARRAY
+	// -------------------------------
+	// Structure-of-arrays storage for many vectors: component k of every element lives in
+	// its own contiguous, 32-byte aligned array. The batch kernels below stream over these
+	// arrays four elements at a time, which the per-element Vector<T, N> layout cannot do.
+
+	template<typename T, size_t N>
+	class VectorArray {
+	public:
+		using value_type = T;
+		static constexpr size_t extent = N;
+		static constexpr size_t ALIGNMENT = 32;
+
+		VectorArray() = default;
+		explicit VectorArray(size_t count) { resize(count); }
+
+		size_t size() const { return components_[0].size(); }
+		bool empty() const { return components_[0].empty(); }
+
+		void resize(size_t count) {
+			for (auto& component : components_) component.resize(count);
+		}
+
+		void reserve(size_t count) {
+			for (auto& component : components_) component.reserve(count);
+		}
+
+		void clear() {
+			for (auto& component : components_) component.clear();
+		}
+
+		void push_back(const Vector<T, N>& v) {
+			for (size_t k = 0; k < N; ++k) components_[k].push_back(v[k]);
+		}
+
+		Vector<T, N> get(size_t index) const {
+			Vector<T, N> result;
+			for (size_t k = 0; k < N; ++k) result[k] = components_[k][index];
+			return result;
+		}
+
+		void set(size_t index, const Vector<T, N>& v) {
+			for (size_t k = 0; k < N; ++k) components_[k][index] = v[k];
+		}
+
+		T* component(size_t k) { return components_[k].data(); }
+		const T* component(size_t k) const { return components_[k].data(); }
+
+	private:
+		std::array<std::vector<T, AlignedAllocator<T, ALIGNMENT>>, N> components_;
+	};
+
+	namespace detail {
+		inline void requireSameSize(size_t a, size_t b) {
+			if (a != b) {
+				throw std::runtime_error("VectorArray sizes do not match");
+			}
+		}
+
+		template<typename T, size_t N>
+		std::array<const T*, N> streams(const VectorArray<T, N>& a) {
+			std::array<const T*, N> result;
+			for (size_t k = 0; k < N; ++k) result[k] = a.component(k);
+			return result;
+		}
+
+		template<typename T, size_t N>
+		std::array<T*, N> streams(VectorArray<T, N>& a) {
+			std::array<T*, N> result;
+			for (size_t k = 0; k < N; ++k) result[k] = a.component(k);
+			return result;
+		}
+
+		template<typename T, size_t A, size_t B>
+		std::array<const T*, A + B> concat(const std::array<const T*, A>& a, const std::array<const T*, B>& b) {
+			std::array<const T*, A + B> result;
+			for (size_t k = 0; k < A; ++k) result[k] = a[k];
+			for (size_t k = 0; k < B; ++k) result[A + k] = b[k];
+			return result;
+		}
+
+		// Runs a batch kernel over `count` elements. Every input stream is read and every
+		// output stream written at the same index, so outputs may alias inputs.
+		//
+		// For float the packet kernel sees four elements per call (the last, partial group is
+		// padded through a stack buffer), any other type goes element by element through the
+		// scalar kernel. Both take an std::array of inputs and return an std::array of outputs.
+		template<typename T, size_t In, size_t Out, typename PacketKernel, typename ScalarKernel>
+		void runBatch(const std::array<const T*, In>& in, const std::array<T*, Out>& out, size_t count, PacketKernel packet_kernel, ScalarKernel scalar_kernel) {
+			if constexpr (std::is_same_v<T, float>) {
+				size_t i = 0;
+				for (; i + 4 <= count; i += 4) {
+					std::array<simd::f32x4, In> x;
+					for (size_t k = 0; k < In; ++k) x[k] = simd::load(in[k] + i);
+
+					std::array<simd::f32x4, Out> y = packet_kernel(x);
+					for (size_t k = 0; k < Out; ++k) simd::store(out[k] + i, y[k]);
+				}
+
+				if (i < count) {
+					size_t rest = count - i;
+					float buffer[4] = {};
+
+					std::array<simd::f32x4, In> x;
+					for (size_t k = 0; k < In; ++k) {
+						for (size_t j = 0; j < rest; ++j) buffer[j] = in[k][i + j];
+						x[k] = simd::load(buffer);
+					}
+
+					std::array<simd::f32x4, Out> y = packet_kernel(x);
+					for (size_t k = 0; k < Out; ++k) {
+						simd::store(buffer, y[k]);
+						for (size_t j = 0; j < rest; ++j) out[k][i + j] = buffer[j];
+					}
+				}
+			}
+			else {
+				for (size_t i = 0; i < count; ++i) {
+					std::array<T, In> x;
+					for (size_t k = 0; k < In; ++k) x[k] = in[k][i];
+
+					std::array<T, Out> y = scalar_kernel(x);
+					for (size_t k = 0; k < Out; ++k) out[k][i] = y[k];
+				}
+			}
+		}
+	}
+
+	// ELEMENT-WISE KERNELS
+	// -------------------------------
+	// Every kernel resizes `out` to the input size. `out` may be one of the inputs.
+
+	// out[i] = a[i] + b[i]
+	template<typename T, size_t N>
+	void add(const VectorArray<T, N>& a, const VectorArray<T, N>& b, VectorArray<T, N>& out) {
+		detail::requireSameSize(a.size(), b.size());
+		out.resize(a.size());
+
+		for (size_t k = 0; k < N; ++k) {
+			detail::runBatch<T, 2, 1>({ a.component(k), b.component(k) }, { out.component(k) }, a.size(),
+				[](const auto& x) { return std::array{ simd::add(x[0], x[1]) }; },
+				[](const auto& x) { return std::array{ x[0] + x[1] }; });
+		}
+	}
+
+	// out[i] = a[i] - b[i]
+	template<typename T, size_t N>
+	void sub(const VectorArray<T, N>& a, const VectorArray<T, N>& b, VectorArray<T, N>& out) {
+		detail::requireSameSize(a.size(), b.size());
+		out.resize(a.size());
+
+		for (size_t k = 0; k < N; ++k) {
+			detail::runBatch<T, 2, 1>({ a.component(k), b.component(k) }, { out.component(k) }, a.size(),
+				[](const auto& x) { return std::array{ simd::sub(x[0], x[1]) }; },
+				[](const auto& x) { return std::array{ x[0] - x[1] }; });
+		}
+	}
+
+	// out[i] = a[i] * b[i] (component-wise)
+	template<typename T, size_t N>
+	void mul(const VectorArray<T, N>& a, const VectorArray<T, N>& b, VectorArray<T, N>& out) {
+		detail::requireSameSize(a.size(), b.size());
+		out.resize(a.size());
+
+		for (size_t k = 0; k < N; ++k) {
+			detail::runBatch<T, 2, 1>({ a.component(k), b.component(k) }, { out.component(k) }, a.size(),
+				[](const auto& x) { return std::array{ simd::mul(x[0], x[1]) }; },
+				[](const auto& x) { return std::array{ x[0] * x[1] }; });
+		}
+	}
+
+	// out[i] = a[i] * scalar
+	template<typename T, size_t N>
+	void mul(const VectorArray<T, N>& a, T scalar, VectorArray<T, N>& out) {
+		out.resize(a.size());
+
+		for (size_t k = 0; k < N; ++k) {
+			detail::runBatch<T, 1, 1>({ a.component(k) }, { out.component(k) }, a.size(),
+				[scalar](const auto& x) { return std::array{ simd::mul(x[0], simd::broadcast(scalar)) }; },
+				[scalar](const auto& x) { return std::array{ x[0] * scalar }; });
+		}
+	}
+
+	// out[i] = a[i] * b[i] + c[i] (component-wise)
+	template<typename T, size_t N>
+	void fma(const VectorArray<T, N>& a, const VectorArray<T, N>& b, const VectorArray<T, N>& c, VectorArray<T, N>& out) {
+		detail::requireSameSize(a.size(), b.size());
+		detail::requireSameSize(a.size(), c.size());
+		out.resize(a.size());
+
+		for (size_t k = 0; k < N; ++k) {
+			detail::runBatch<T, 3, 1>({ a.component(k), b.component(k), c.component(k) }, { out.component(k) }, a.size(),
+				[](const auto& x) { return std::array{ simd::madd(x[0], x[1], x[2]) }; },
+				[](const auto& x) { return std::array{ x[0] * x[1] + x[2] }; });
+		}
+	}
+
+	// out[i] = a[i] * scalar + c[i], e.g. position += velocity * dt for a whole batch
+	template<typename T, size_t N>
+	void fma(const VectorArray<T, N>& a, T scalar, const VectorArray<T, N>& c, VectorArray<T, N>& out) {
+		detail::requireSameSize(a.size(), c.size());
+		out.resize(a.size());
+
+		for (size_t k = 0; k < N; ++k) {
+			detail::runBatch<T, 2, 1>({ a.component(k), c.component(k) }, { out.component(k) }, a.size(),
+				[scalar](const auto& x) { return std::array{ simd::madd(x[0], simd::broadcast(scalar), x[1]) }; },
+				[scalar](const auto& x) { return std::array{ x[0] * scalar + x[1] }; });
+		}
+	}
+
+	// GEOMETRIC KERNELS
+	// -------------------------------
+
+	// out[i] = dot(a[i], b[i])
+	template<typename T, size_t N>
+	void dot(const VectorArray<T, N>& a, const VectorArray<T, N>& b, std::vector<T>& out) {
+		detail::requireSameSize(a.size(), b.size());
+		out.resize(a.size());
+
+		detail::runBatch<T, 2 * N, 1>(detail::concat(detail::streams(a), detail::streams(b)), { out.data() }, a.size(),
+			[](const auto& x) {
+				simd::f32x4 sum = simd::mul(x[0], x[N]);
+				for (size_t k = 1; k < N; ++k) sum = simd::madd(x[k], x[N + k], sum);
+				return std::array{ sum };
+			},
+			[](const auto& x) {
+				T sum = 0;
+				for (size_t k = 0; k < N; ++k) sum += x[k] * x[N + k];
+				return std::array{ sum };
+			});
+	}
+
+	// out[i] = normalize(a[i]), zero-length vectors are left unchanged like Vector::normalize
+	template<typename T, size_t N>
+	void normalize(const VectorArray<T, N>& a, VectorArray<T, N>& out) {
+		out.resize(a.size());
+
+		detail::runBatch<T, N, N>(detail::streams(a), detail::streams(out), a.size(),
+			[](const auto& x) {
+				simd::f32x4 sum = simd::mul(x[0], x[0]);
+				for (size_t k = 1; k < N; ++k) sum = simd::madd(x[k], x[k], sum);
+
+				simd::f32x4 magnitude = simd::sqrt(sum);
+				simd::f32x4 degenerate = simd::equal(magnitude, simd::broadcast(0.0f));
+
+				std::array<simd::f32x4, N> result;
+				for (size_t k = 0; k < N; ++k) result[k] = simd::select(degenerate, x[k], simd::div(x[k], magnitude));
+				return result;
+			},
+			[](const auto& x) {
+				T sum = 0;
+				for (size_t k = 0; k < N; ++k) sum += x[k] * x[k];
+
+				T magnitude = std::sqrt(sum);
+				std::array<T, N> result = x;
+				if (magnitude != 0) {
+					for (size_t k = 0; k < N; ++k) result[k] = x[k] / magnitude;
+				}
+				return result;
+			});
+	}
+
+	// out[i] = cross(a[i], b[i])
+	template<typename T>
+	void cross(const VectorArray<T, 3>& a, const VectorArray<T, 3>& b, VectorArray<T, 3>& out) {
+		detail::requireSameSize(a.size(), b.size());
+		out.resize(a.size());
+
+		detail::runBatch<T, 6, 3>(detail::concat(detail::streams(a), detail::streams(b)), detail::streams(out), a.size(),
+			[](const auto& x) {
+				return std::array{
+					simd::sub(simd::mul(x[1], x[5]), simd::mul(x[2], x[4])),
+					simd::sub(simd::mul(x[2], x[3]), simd::mul(x[0], x[5])),
+					simd::sub(simd::mul(x[0], x[4]), simd::mul(x[1], x[3]))
+				};
+			},
+			[](const auto& x) {
+				return std::array{
+					x[1] * x[5] - x[2] * x[4],
+					x[2] * x[3] - x[0] * x[5],
+					x[0] * x[4] - x[1] * x[3]
+				};
+			});
+	}
+
+	// out[i] = m * (points[i], 1), without the perspective divide
+	template<typename T>
+	void transformPoints(const Matrix4<T>& m, const VectorArray<T, 3>& points, VectorArray<T, 3>& out) {
+		out.resize(points.size());
+
+		detail::runBatch<T, 3, 3>(detail::streams(points), detail::streams(out), points.size(),
+			[&m](const auto& x) {
+				std::array<simd::f32x4, 3> result;
+				for (int i = 0; i < 3; ++i) {
+					simd::f32x4 r = simd::madd(x[0], simd::broadcast(m(i, 0)), simd::broadcast(m(i, 3)));
+					r = simd::madd(x[1], simd::broadcast(m(i, 1)), r);
+					result[i] = simd::madd(x[2], simd::broadcast(m(i, 2)), r);
+				}
+				return result;
+			},
+			[&m](const auto& x) {
+				std::array<T, 3> result;
+				for (int i = 0; i < 3; ++i) result[i] = m(i, 0) * x[0] + m(i, 1) * x[1] + m(i, 2) * x[2] + m(i, 3);
+				return result;
+			});
+	}
+
+	// out[i] = m * v[i]
+	template<typename T>
+	void transform(const Matrix4<T>& m, const VectorArray<T, 4>& v, VectorArray<T, 4>& out) {
+		out.resize(v.size());
+
+		detail::runBatch<T, 4, 4>(detail::streams(v), detail::streams(out), v.size(),
+			[&m](const auto& x) {
+				std::array<simd::f32x4, 4> result;
+				for (int i = 0; i < 4; ++i) {
+					simd::f32x4 r = simd::mul(x[0], simd::broadcast(m(i, 0)));
+					r = simd::madd(x[1], simd::broadcast(m(i, 1)), r);
+					r = simd::madd(x[2], simd::broadcast(m(i, 2)), r);
+					result[i] = simd::madd(x[3], simd::broadcast(m(i, 3)), r);
+				}
+				return result;
+			},
+			[&m](const auto& x) {
+				std::array<T, 4> result;
+				for (int i = 0; i < 4; ++i) result[i] = m(i, 0) * x[0] + m(i, 1) * x[1] + m(i, 2) * x[2] + m(i, 3) * x[3];
+				return result;
+			});
+	}
+
+	// out[i] = q.rotate(v[i]), expects a unit quaternion.
+	// Uses v' = v + w * t + q.xyz x t with t = 2 * (q.xyz x v), which is cheaper than the sandwich product.
+	template<typename T>
+	void rotate(const Quaternion<T>& q, const VectorArray<T, 3>& v, VectorArray<T, 3>& out) {
+		out.resize(v.size());
+
+		detail::runBatch<T, 3, 3>(detail::streams(v), detail::streams(out), v.size(),
+			[&q](const auto& x) {
+				simd::f32x4 qw = simd::broadcast(q.w());
+				simd::f32x4 qx = simd::broadcast(q.x()), qy = simd::broadcast(q.y()), qz = simd::broadcast(q.z());
+				simd::f32x4 two = simd::broadcast(2.0f);
+
+				simd::f32x4 tx = simd::mul(two, simd::sub(simd::mul(qy, x[2]), simd::mul(qz, x[1])));
+				simd::f32x4 ty = simd::mul(two, simd::sub(simd::mul(qz, x[0]), simd::mul(qx, x[2])));
+				simd::f32x4 tz = simd::mul(two, simd::sub(simd::mul(qx, x[1]), simd::mul(qy, x[0])));
+
+				return std::array{
+					simd::add(simd::madd(qw, tx, x[0]), simd::sub(simd::mul(qy, tz), simd::mul(qz, ty))),
+					simd::add(simd::madd(qw, ty, x[1]), simd::sub(simd::mul(qz, tx), simd::mul(qx, tz))),
+					simd::add(simd::madd(qw, tz, x[2]), simd::sub(simd::mul(qx, ty), simd::mul(qy, tx)))
+				};
+			},
+			[&q](const auto& x) {
+				T tx = 2 * (q.y() * x[2] - q.z() * x[1]);
+				T ty = 2 * (q.z() * x[0] - q.x() * x[2]);
+				T tz = 2 * (q.x() * x[1] - q.y() * x[0]);
+
+				return std::array{
+					x[0] + q.w() * tx + (q.y() * tz - q.z() * ty),
+					x[1] + q.w() * ty + (q.z() * tx - q.x() * tz),
+					x[2] + q.w() * tz + (q.x() * ty - q.y() * tx)
+				};
+			});
+	}
+
+	// COORDINATE KERNELS
+	// -------------------------------
+	// Polar coordinates are stored as (r, theta) pairs, matching Polar<T>::data.
+
+	// out[i] = Polar<T>::fromCartesian(cartesian[i]), theta normalized to [0, 2 * PI)
+	template<typename T>
+	void toPolar(const VectorArray<T, 2>& cartesian, VectorArray<T, 2>& out) {
+		out.resize(cartesian.size());
+
+		detail::runBatch<T, 2, 2>(detail::streams(cartesian), detail::streams(out), cartesian.size(),
+			[](const auto& x) {
+				simd::f32x4 r = simd::sqrt(simd::madd(x[0], x[0], simd::mul(x[1], x[1])));
+				simd::f32x4 theta = fast::atan2(x[1], x[0]);
+				theta = simd::select(simd::less(theta, simd::broadcast(0.0f)), simd::add(theta, simd::broadcast(static_cast<float>(2 * math::PI))), theta);
+				return std::array{ r, theta };
+			},
+			[](const auto& x) {
+				T theta = std::atan2(x[1], x[0]);
+				if (theta < 0) theta += static_cast<T>(2 * math::PI);
+				return std::array{ static_cast<T>(std::sqrt(x[0] * x[0] + x[1] * x[1])), theta };
+			});
+	}
+
+	// out[i] = Polar<T>(polar[i]).toCartesian()
+	template<typename T>
+	void toCartesian(const VectorArray<T, 2>& polar, VectorArray<T, 2>& out) {
+		out.resize(polar.size());
+
+		detail::runBatch<T, 2, 2>(detail::streams(polar), detail::streams(out), polar.size(),
+			[](const auto& x) {
+				simd::f32x4 s, c;
+				fast::sincos(x[1], s, c);
+				return std::array{ simd::mul(x[0], c), simd::mul(x[0], s) };
+			},
+			[](const auto& x) {
+				return std::array{ x[0] * std::cos(x[1]), x[0] * std::sin(x[1]) };
+			});
+	}
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
\ No newline at end of file
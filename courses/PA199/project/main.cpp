@@ -18,6 +18,8 @@ int main(int argc, char** argv) {
 
     ApplicationManager manager;
     manager.init(initial_width, initial_height, "PA199 Project", 4, 5);
+    // Simulates at a fixed rate independent of the frame rate.
+    manager.set_fixed_update_rate(120.0);
     if (!manager.is_fail()) {
         // Note that the application has to be created after the manager is initialized.
         Application application(initial_width, initial_height, arguments);
@@ -0,0 +1,70 @@
+#include <gtest/gtest.h>
+
+#include "../../gel/animation/animator_component.hpp"
+#include "../../gel/game_entity.hpp"
+#include "../../gel/game_scene.hpp"
+
+#include <algorithm>
+#include <vector>
+
+// Clips keyed in seconds play at the speed of the scene's millisecond steps and loop
+TEST(gel_animator_test_suite, anim_scene_step_test) {
+	gel::AnimatorComponent::Clip clip;
+	clip.position.addKey(0.0f, { 0.0f, 0.0f, 0.0f });
+	clip.position.addKey(2.0f, { 4.0f, 0.0f, 0.0f });
+	clip.rotation.addKey(0.0f, gem::Quaternion<float>());
+	clip.rotation.addKey(2.0f, gem::AxisAngle<float>(1.0f, 0.0f, 1.0f, 0.0f).toQuaternion());
+
+	gel::GameScene scene;
+	auto* target = scene.createEntity();
+	auto* animator = scene.createComponent<gel::AnimatorComponent>();
+	auto* holder = scene.createEntity();
+	holder->addComponent(animator);
+	scene.addEntity(target);
+	scene.addEntity(holder);
+
+	animator->play(target, &clip);
+	EXPECT_TRUE(animator->isPlaying(target));
+
+	// Half a second at 120 steps per second
+	for (int i = 0; i < 60; ++i) scene.update(1000.0f / 120.0f);
+	EXPECT_NEAR(target->getPosition()[0], 1.0f, 1e-3f);
+	gem::AxisAngle<float> turned = target->getOrientation().toAxisAngle();
+	// Nlerp runs slightly behind a uniform turn away from the ends
+	EXPECT_NEAR(turned.angle() * turned.axis()[1], 0.25f, 1e-2f);
+
+	// Past the end the clip starts over
+	for (int i = 0; i < 210; ++i) scene.update(1000.0f / 120.0f);
+	EXPECT_NEAR(target->getPosition()[0], 0.5f, 1e-2f);
+
+	animator->stop(target);
+	EXPECT_FALSE(animator->isPlaying(target));
+	scene.update(500.0f);
+	EXPECT_NEAR(target->getPosition()[0], 0.5f, 1e-2f);
+}
+
+
+// The per-track nlerp and the batched slerp both turn every bound entity
+TEST(gel_animator_test_suite, anim_rotation_paths_test) {
+	gel::AnimatorComponent::Clip clip;
+	clip.rotation.addKey(0.0f, gem::Quaternion<float>());
+	clip.rotation.addKey(2.0f, gem::AxisAngle<float>(1.0f, 0.0f, 1.0f, 0.0f).toQuaternion());
+
+	for (auto interpolation : { gem::RotationInterpolation::Nlerp, gem::RotationInterpolation::Slerp }) {
+		gel::GameScene scene;
+		gel::AnimatorComponent animator(interpolation);
+		std::vector<gel::GameEntity*> targets;
+		for (int i = 0; i < 5; ++i) {
+			targets.push_back(scene.createEntity());
+			animator.play(targets.back(), &clip, false, 0.25f * i);
+		}
+
+		animator.update(500.0f);
+		for (int i = 0; i < 5; ++i) {
+			gem::AxisAngle<float> turned = targets[i]->getOrientation().toAxisAngle();
+			float expected = 0.5f * std::min(0.5f + 0.25f * i, 2.0f);
+			float tolerance = interpolation == gem::RotationInterpolation::Slerp ? 1e-4f : 1e-2f;
+			EXPECT_NEAR(turned.angle() * turned.axis()[1], expected, tolerance);
+		}
+	}
+}
\ No newline at end of file
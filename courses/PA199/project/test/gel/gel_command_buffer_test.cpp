@@ -0,0 +1,154 @@
+#include <gtest/gtest.h>
+
+#include "../../gel/ecs/command_buffer.hpp"
+#include "../../gel/game_entity.hpp"
+#include "../../gel/game_scene.hpp"
+#include "../../gel/jobs/job_system.hpp"
+#include "../../gel/control/paddle_controller_component.hpp"
+#include "../../gel/physics/rigidbody_component.hpp"
+
+#include <vector>
+
+namespace {
+	// Spawns a child under its entity on every update and destroys the one of the last
+	// update, through the scene's command buffer
+	class Spawner : public gel::GameComponent {
+	public:
+		explicit Spawner(gel::GameScene* scene) : scene_(scene) {}
+
+		void update(float delta_time) override {
+			gel::CommandBuffer& commands = scene_->getCommands();
+			if (last_) commands.destroy(last_);
+			last_ = scene_->createEntity();
+			commands.spawn(last_, getEntity());
+		}
+		uint8_t getAccess() const override { return gel::ACCESS_OWN_READ; }
+		void render() override {}
+
+	private:
+		gel::GameScene* scene_;
+		gel::GameEntity* last_ = nullptr;
+	};
+}
+
+// Nothing changes until the commands are applied, then each type in recording order
+TEST(gel_command_buffer_test_suite, cb_apply_test) {
+	gel::GameScene scene;
+	auto* a = scene.createEntity();
+	auto* b = scene.createEntity();
+	auto* c = scene.createEntity();
+	for (auto* root : { a, b, c }) scene.addEntity(root);
+
+	gel::CommandBuffer& commands = scene.getCommands();
+	auto* spawned = scene.createEntity();
+	auto* body = scene.createComponent<gel::RigidbodyComponent>(1.0f);
+	commands.spawn(spawned, a);
+	commands.reparent(c, a);
+	commands.reparent(c, b);
+	commands.setEnabled(a, false);
+	commands.removeComponent(spawned, body);
+	commands.addComponent(spawned, body);
+	EXPECT_EQ(commands.size(), 6);
+	EXPECT_EQ(scene.getEntitySize(), 3);
+	EXPECT_TRUE(a->getChildren().empty());
+
+	scene.applyCommands();
+	EXPECT_TRUE(commands.empty());
+	EXPECT_EQ(scene.getEntities(), (std::vector<gel::GameEntity*>{ a, b }));
+	EXPECT_EQ(a->getChildren(), std::vector<gel::GameEntity*>{ spawned });
+	EXPECT_EQ(c->getParent(), b);
+	EXPECT_FALSE(a->isEnabled());
+	EXPECT_TRUE(spawned->getComponents().empty());
+	EXPECT_EQ(spawned->getComponent<gel::RigidbodyComponent>(), nullptr);
+	EXPECT_EQ(scene.getMemoryStats<gel::RigidbodyComponent>().live, 0);
+
+	// Only the reparent closing a cycle is dropped, the rest of the batch applies
+	auto* doomed = scene.createEntity();
+	scene.addEntity(doomed);
+	commands.reparent(a, spawned);
+	commands.reparent(c, a);
+	commands.setEnabled(a, true);
+	commands.destroy(doomed);
+	EXPECT_NO_THROW(scene.applyCommands());
+	EXPECT_EQ(a->getParent(), nullptr);
+	EXPECT_EQ(c->getParent(), a);
+	EXPECT_TRUE(a->isEnabled());
+	EXPECT_EQ(scene.getEntities(), (std::vector<gel::GameEntity*>{ a, b }));
+	EXPECT_EQ(scene.getMemoryStats<gel::GameEntity>().live, 4);
+	EXPECT_TRUE(commands.empty());
+}
+
+// A spawned subtree listens to input even when a later reparent places it
+TEST(gel_command_buffer_test_suite, cb_spawn_input_test) {
+	gel::GameScene scene;
+	gel::InputSystem& input = scene.getInput();
+	input.bindKey(input.action("paddle_left"), GLFW_KEY_A);
+	auto* root = scene.createEntity();
+	scene.addEntity(root);
+
+	auto* paddle = scene.createEntity();
+	auto* child = scene.createEntity();
+	paddle->addChild(child);
+	child->addComponent(scene.createComponent<gel::PaddleControllerComponent>(2.0f));
+	scene.getCommands().spawn(paddle);
+	scene.getCommands().reparent(paddle, root);
+	scene.applyCommands();
+	EXPECT_EQ(paddle->getParent(), root);
+
+	input.pushKeyEvent(GLFW_KEY_A, 0, GLFW_PRESS, 0);
+	scene.update(500.0f);
+	gem::AxisAngle<float> turned = child->getOrientation().toAxisAngle();
+	EXPECT_NEAR(turned.angle() * turned.axis()[1], -1.0f, 1e-4f);
+}
+
+// Destroying many entities at once, some inside each other's subtrees or twice, frees each once
+TEST(gel_command_buffer_test_suite, cb_destroy_test) {
+	gel::GameScene scene;
+	std::vector<gel::GameEntity*> roots;
+	for (int i = 0; i < 100; ++i) {
+		auto* root = scene.createEntity();
+		auto* child = scene.createEntity();
+		child->addComponent(scene.createComponent<gel::RigidbodyComponent>(1.0f));
+		root->addChild(child);
+		scene.addEntity(root);
+		roots.push_back(root);
+	}
+
+	gel::CommandBuffer& commands = scene.getCommands();
+	for (int i = 0; i < 100; i += 2) {
+		commands.destroy(roots[i]->getChildren()[0]);
+		commands.destroy(roots[i]);
+		commands.destroy(roots[i]);
+	}
+	commands.destroy(roots[1]->getChildren()[0]);
+	scene.applyCommands();
+
+	ASSERT_EQ(scene.getEntitySize(), 50);
+	for (int i = 0; i < 50; ++i) EXPECT_EQ(scene.getEntities()[i], roots[2 * i + 1]);
+	EXPECT_TRUE(roots[1]->getChildren().empty());
+	EXPECT_EQ(roots[3]->getChildren().size(), 1);
+	EXPECT_EQ(scene.getMemoryStats<gel::GameEntity>().live, 99);
+	EXPECT_EQ(scene.getMemoryStats<gel::RigidbodyComponent>().live, 49);
+}
+
+// Updates on worker threads record concurrently and the changes land after the update
+TEST(gel_command_buffer_test_suite, cb_parallel_update_test) {
+	gel::JobSystem jobs(3);
+	gel::GameScene scene;
+	scene.setJobSystem(&jobs);
+
+	std::vector<gel::GameEntity*> spawners;
+	for (int i = 0; i < 64; ++i) {
+		auto* entity = scene.createEntity();
+		entity->addComponent(scene.createComponent<Spawner>(&scene));
+		scene.addEntity(entity);
+		spawners.push_back(entity);
+	}
+
+	for (int step = 0; step < 10; ++step) {
+		scene.update(16.0f);
+		for (auto* spawner : spawners) ASSERT_EQ(spawner->getChildren().size(), 1);
+	}
+	EXPECT_TRUE(scene.getCommands().empty());
+	EXPECT_EQ(scene.getMemoryStats<gel::GameEntity>().live, 128);
+}
\ No newline at end of file
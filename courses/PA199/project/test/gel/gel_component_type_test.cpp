@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+
+#include "../../gel/game_entity.hpp"
+#include "../../gel/game_component.hpp"
+#include "../../gel/camera/camera_component.hpp"
+#include "../../gel/renderer/renderer_component.hpp"
+#include "../../gel/light/point_light_component.hpp"
+#include "../../gel/light/directional_light_component.hpp"
+#include "../../gel/physics/rigidbody_component.hpp"
+
+namespace {
+	// Derived without GEL_COMPONENT, so it is only found through dynamic_cast
+	class UntypedLight : public gel::PointLightComponent {
+	public:
+		UntypedLight() : PointLightComponent({ 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f }) {}
+	};
+
+	const gem::Vector<float, 3> GREY{ 0.5f, 0.5f, 0.5f };
+}
+
+static_assert(gel::PointLightComponent::TYPE_MASK == (gel::componentBit(gel::ComponentType::PointLightComponent) | gel::componentBit(gel::ComponentType::LightComponent)));
+static_assert(gel::TypedComponent<gel::LightComponent> && !gel::TypedComponent<UntypedLight>);
+static_assert(gel::componentRank(0b10110, gel::ComponentType::PointLightComponent) == 3);
+
+// Base class queries find the first component of any subtype
+TEST(gel_component_type_test_suite, ct_lookup_test) {
+	gel::GameEntity e;
+	gel::RigidbodyComponent rb;
+	gel::PointLightComponent point(GREY, GREY, GREY);
+	gel::DirectionalLightComponent sun(GREY, GREY, GREY);
+	gel::CameraComponent camera;
+
+	e.addComponent(&rb);
+	e.addComponent(&point);
+	e.addComponent(&sun);
+
+	EXPECT_EQ(e.getComponent<gel::RigidbodyComponent>(), &rb);
+	EXPECT_EQ(e.getComponent<gel::LightComponent>(), &point);
+	EXPECT_EQ(e.getComponent<gel::PointLightComponent>(), &point);
+	EXPECT_EQ(e.getComponent<gel::DirectionalLightComponent>(), &sun);
+	EXPECT_EQ(e.getComponent<gel::CameraComponent>(), nullptr);
+	EXPECT_EQ(e.getComponent<gel::RendererComponent>(), nullptr);
+
+	// Adding a lower type bit later shifts the slots of the others
+	e.addComponent(&camera);
+	EXPECT_EQ(e.getComponent<gel::CameraComponent>(), &camera);
+	EXPECT_EQ(e.getComponent<gel::DirectionalLightComponent>(), &sun);
+	EXPECT_EQ(e.getComponentMask(), rb.getTypeMask() | point.getTypeMask() | sun.getTypeMask() | camera.getTypeMask());
+
+	// Removing the first light hands the base class slot to the next one
+	e.removeComponent(&point);
+	EXPECT_EQ(e.getComponent<gel::LightComponent>(), &sun);
+	EXPECT_EQ(e.getComponent<gel::PointLightComponent>(), nullptr);
+	EXPECT_EQ(e.getComponent<gel::RigidbodyComponent>(), &rb);
+}
+
+// Subclasses without their own ID still answer typed and dynamic_cast queries
+TEST(gel_component_type_test_suite, ct_untyped_test) {
+	gel::GameEntity e;
+	gel::RigidbodyComponent rb;
+	UntypedLight light;
+	e.addComponent(&rb);
+	e.addComponent(&light);
+
+	EXPECT_EQ(e.getComponent<UntypedLight>(), &light);
+	EXPECT_EQ(e.getComponent<gel::PointLightComponent>(), &light);
+	EXPECT_EQ(e.getComponent<gel::LightComponent>(), &light);
+
+	EXPECT_EQ(gel::componentCast<gel::LightComponent>(&light), &light);
+	EXPECT_EQ(gel::componentCast<gel::DirectionalLightComponent>(&light), nullptr);
+	EXPECT_EQ(gel::componentCast<UntypedLight>(&rb), nullptr);
+	EXPECT_EQ(gel::componentCast<gel::RigidbodyComponent>(nullptr), nullptr);
+}
\ No newline at end of file
@@ -6,6 +6,14 @@
 #include "../../gel/game_entity.hpp"
 #include "../../gel/test_component.hpp"
 
+namespace {
+	// Rotation about x, then y, then z, the order of the expected matrices below
+	gem::Quaternion<float> eulerToQuaternion(const gem::Vector<float, 3>& euler) {
+		return gem::AxisAngle<float>(euler[2], 0.0f, 0.0f, 1.0f).toQuaternion()
+			* gem::AxisAngle<float>(euler[1], 0.0f, 1.0f, 0.0f).toQuaternion()
+			* gem::AxisAngle<float>(euler[0], 1.0f, 0.0f, 0.0f).toQuaternion();
+	}
+}
 
 TEST(gel_game_entity_test_suite, gent_basic_test) {
 	gel::GameEntity e1;
@@ -14,9 +22,10 @@ TEST(gel_game_entity_test_suite, gent_basic_test) {
 	EXPECT_FLOAT_EQ(e1.getPosition()[1], 0.0f);
 	EXPECT_FLOAT_EQ(e1.getPosition()[2], 0.0f);
 
-	EXPECT_FLOAT_EQ(e1.getOrientation()[0], 0.0f);
+	EXPECT_FLOAT_EQ(e1.getOrientation()[0], 1.0f);
 	EXPECT_FLOAT_EQ(e1.getOrientation()[1], 0.0f);
 	EXPECT_FLOAT_EQ(e1.getOrientation()[2], 0.0f);
+	EXPECT_FLOAT_EQ(e1.getOrientation()[3], 0.0f);
 
 	EXPECT_FLOAT_EQ(e1.getScale()[0], 1.0f);
 	EXPECT_FLOAT_EQ(e1.getScale()[1], 1.0f);
@@ -25,9 +34,10 @@ TEST(gel_game_entity_test_suite, gent_basic_test) {
 	EXPECT_EQ(e1.getParent(), nullptr);
 	EXPECT_EQ(e1.getChildren().size(), 0);
 
+	gem::Quaternion<float> orientation = eulerToQuaternion(gem::Vector<float, 3>{ M_PI, M_PI / 2.0f, M_PI / 4.0f });
 	gel::GameEntity e2(
 		gem::Vector<float, 3>{ 1.0f, 2.0f, 3.0f },
-		gem::Vector<float, 3>{ M_PI, M_PI / 2.0f, M_PI / 4.0f },
+		orientation,
 		gem::Vector<float, 3>{ 0.5f, 0.5f, 0.5f }
 	);
 
@@ -38,9 +48,7 @@ TEST(gel_game_entity_test_suite, gent_basic_test) {
 	EXPECT_FLOAT_EQ(e2.getPosition()[1], 2.0f);
 	EXPECT_FLOAT_EQ(e2.getPosition()[2], 3.0f);
 
-	EXPECT_FLOAT_EQ(e2.getOrientation()[0], M_PI);
-	EXPECT_FLOAT_EQ(e2.getOrientation()[1], M_PI / 2.0f);
-	EXPECT_FLOAT_EQ(e2.getOrientation()[2], M_PI / 4.0f);
+	for (int i = 0; i < 4; ++i) EXPECT_FLOAT_EQ(e2.getOrientation()[i], orientation[i]);
 
 	EXPECT_FLOAT_EQ(e2.getScale()[0], 0.5f);
 	EXPECT_FLOAT_EQ(e2.getScale()[1], 0.5f);
@@ -59,7 +67,7 @@ TEST(gel_game_entity_test_suite, gent_ls_test) {
 
 	gel::GameEntity e(
 		position,
-		rotation,
+		eulerToQuaternion(rotation),
 		scale
 	);
 
@@ -109,13 +117,13 @@ TEST(gel_game_entity_test_suite, gent_ws_test) {
 
 	gel::GameEntity e(
 		position,
-		rotation,
+		eulerToQuaternion(rotation),
 		scale
 	);
 
 	gel::GameEntity e2(
 		gem::Vector<float, 3>{ 1.0f, 1.0f, 1.0f },
-		gem::Vector<float, 3>{ 0.0f, 0.0f, 0.0f },
+		gem::Quaternion<float>(),
 		gem::Vector<float, 3>{ 2.0f, 2.0f, 2.0f }
 	);
 
@@ -131,3 +139,52 @@ TEST(gel_game_entity_test_suite, gent_ws_test) {
 		}
 	}
 }
+
+
+// Cached world matrices follow changes to the entity, its ancestors and its parent link
+TEST(gel_game_entity_test_suite, gent_cache_test) {
+	gel::GameEntity root(
+		gem::Vector<float, 3>{ 1.0f, 0.0f, 0.0f },
+		gem::Quaternion<float>{ 1.0f, 0.0f, 0.0f, 0.0f },
+		gem::Vector<float, 3>{ 1.0f, 1.0f, 1.0f });
+	gel::GameEntity middle(
+		gem::Vector<float, 3>{ 0.0f, 2.0f, 0.0f },
+		gem::AxisAngle<float>(static_cast<float>(M_PI / 2), 0.0f, 0.0f, 1.0f).toQuaternion(),
+		gem::Vector<float, 3>{ 2.0f, 2.0f, 2.0f });
+	gel::GameEntity leaf(
+		gem::Vector<float, 3>{ 1.0f, 0.0f, 0.0f },
+		gem::Quaternion<float>{ 1.0f, 0.0f, 0.0f, 0.0f },
+		gem::Vector<float, 3>{ 1.0f, 1.0f, 1.0f });
+
+	root.addChild(&middle);
+	middle.addChild(&leaf);
+
+	// The leaf's offset is rotated a quarter turn and doubled by its parent
+	EXPECT_NEAR(leaf.getWorldPosition()[0], 1.0f, 1e-5f);
+	EXPECT_NEAR(leaf.getWorldPosition()[1], 4.0f, 1e-5f);
+
+	root.setPosition({ 0.0f, 0.0f, 5.0f });
+	EXPECT_NEAR(leaf.getWorldPosition()[0], 0.0f, 1e-5f);
+	EXPECT_NEAR(leaf.getWorldPosition()[2], 5.0f, 1e-5f);
+
+	middle.setScale({ 1.0f, 1.0f, 1.0f });
+	EXPECT_NEAR(leaf.getWorldPosition()[1], 3.0f, 1e-5f);
+
+	middle.rotate(gem::AxisAngle<float>(static_cast<float>(-M_PI / 2), 0.0f, 0.0f, 1.0f));
+	EXPECT_NEAR(leaf.getWorldPosition()[0], 1.0f, 1e-5f);
+	EXPECT_NEAR(leaf.getWorldPosition()[1], 2.0f, 1e-5f);
+
+	gem::Matrix4<float> product = leaf.getInverseWorldTransform() * leaf.getWorldTransform();
+	for (int i = 0; i < 4; ++i) {
+		for (int j = 0; j < 4; ++j) EXPECT_NEAR(product(i, j), i == j ? 1.0f : 0.0f, 1e-5f);
+	}
+
+	// Re-parenting invalidates the whole subtree
+	middle.removeChild(&leaf);
+	EXPECT_NEAR(leaf.getWorldPosition()[0], 1.0f, 1e-5f);
+	EXPECT_NEAR(leaf.getWorldPosition()[2], 0.0f, 1e-5f);
+
+	root.addChild(&leaf);
+	EXPECT_NEAR(leaf.getWorldPosition()[0], 1.0f, 1e-5f);
+	EXPECT_NEAR(leaf.getWorldPosition()[2], 5.0f, 1e-5f);
+}
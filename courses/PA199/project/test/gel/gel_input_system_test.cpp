@@ -0,0 +1,171 @@
+#include <gtest/gtest.h>
+
+#include "../../gel/input/input_system.hpp"
+#include "../../gel/game_entity.hpp"
+#include "../../gel/game_scene.hpp"
+#include "../../gel/control/ball_reset_component.hpp"
+#include "../../gel/control/paddle_controller_component.hpp"
+
+#include <vector>
+
+namespace {
+	class KeyRecorder : public gel::GameComponent {
+	public:
+		void update(float delta_time) override {}
+		void render() override {}
+		void handleKeyPressed(int key, int scancode, int action, int mods) override {
+			keys.push_back(key);
+		}
+
+		std::vector<int> keys;
+	};
+
+	// Stops listening on its first event
+	class OneShot : public gel::GameComponent {
+	public:
+		explicit OneShot(gel::InputSystem* input) : input_(input) {}
+
+		void update(float delta_time) override {}
+		void render() override {}
+		void handleKeyPressed(int key, int scancode, int action, int mods) override {
+			++calls;
+			input_->unsubscribe(this);
+		}
+
+		int calls = 0;
+
+	private:
+		gel::InputSystem* input_;
+	};
+}
+
+// Events reach only the listeners of their key or action, and only once dispatched
+TEST(gel_input_system_test_suite, input_dispatch_test) {
+	gel::InputSystem input;
+	gel::InputSystem::ActionId jump = input.action("jump");
+	EXPECT_EQ(input.action("jump"), jump);
+	input.bindKey(jump, GLFW_KEY_A);
+	input.bindKey(jump, GLFW_KEY_D);
+
+	KeyRecorder on_key, on_action, deaf;
+	input.subscribeKey(GLFW_KEY_R, &on_key);
+	input.subscribeAction(jump, &on_action);
+	EXPECT_EQ(input.listenerCount(), 2);
+
+	input.pushKeyEvent(GLFW_KEY_A, 0, GLFW_PRESS, 0);
+	input.pushKeyEvent(GLFW_KEY_R, 0, GLFW_PRESS, 0);
+	input.pushKeyEvent(GLFW_KEY_D, 0, GLFW_REPEAT, 0);
+	input.pushKeyEvent(GLFW_KEY_UNKNOWN, 0, GLFW_PRESS, 0);
+	EXPECT_TRUE(on_action.keys.empty());
+
+	input.dispatch();
+	EXPECT_EQ(on_key.keys, std::vector<int>{ GLFW_KEY_R });
+	EXPECT_EQ(on_action.keys, (std::vector<int>{ GLFW_KEY_A, GLFW_KEY_D }));
+	EXPECT_TRUE(deaf.keys.empty());
+
+	input.unsubscribe(&on_action);
+	input.unsubscribe(&deaf);
+	EXPECT_EQ(input.listenerCount(), 1);
+	input.pushKeyEvent(GLFW_KEY_A, 0, GLFW_RELEASE, 0);
+	input.dispatch();
+	EXPECT_EQ(on_action.keys.size(), 2);
+
+	EXPECT_THROW(input.subscribeAction(jump + 1, &deaf), std::runtime_error);
+	EXPECT_THROW(input.bindKey(jump, GLFW_KEY_LAST + 1), std::runtime_error);
+}
+
+// A listener unsubscribing itself does not make the next one miss the event
+TEST(gel_input_system_test_suite, input_unsubscribe_in_dispatch_test) {
+	gel::InputSystem input;
+	OneShot first(&input), second(&input);
+	KeyRecorder last;
+	input.subscribeKey(GLFW_KEY_R, &first);
+	input.subscribeKey(GLFW_KEY_R, &second);
+	input.subscribeKey(GLFW_KEY_R, &last);
+
+	input.pushKeyEvent(GLFW_KEY_R, 0, GLFW_PRESS, 0);
+	input.pushKeyEvent(GLFW_KEY_R, 0, GLFW_RELEASE, 0);
+	input.dispatch();
+	EXPECT_EQ(first.calls, 1);
+	EXPECT_EQ(second.calls, 1);
+	EXPECT_EQ(last.keys.size(), 2);
+	EXPECT_EQ(input.listenerCount(), 1);
+
+	input.pushKeyEvent(GLFW_KEY_R, 0, GLFW_PRESS, 0);
+	input.dispatch();
+	EXPECT_EQ(first.calls, 1);
+	EXPECT_EQ(last.keys.size(), 3);
+}
+
+// Held keys stay down across dispatches, a tap released within one counts for that one only
+TEST(gel_input_system_test_suite, input_key_state_test) {
+	gel::InputSystem input;
+	gel::InputSystem::ActionId left = input.action("left");
+	input.bindKey(left, GLFW_KEY_A);
+	input.bindKey(left, GLFW_KEY_LEFT);
+
+	input.pushKeyEvent(GLFW_KEY_LEFT, 0, GLFW_PRESS, 0);
+	input.dispatch();
+	input.dispatch();
+	EXPECT_TRUE(input.isKeyDown(GLFW_KEY_LEFT));
+	EXPECT_TRUE(input.isActionDown(left));
+
+	input.pushKeyEvent(GLFW_KEY_LEFT, 0, GLFW_RELEASE, 0);
+	input.dispatch();
+	EXPECT_FALSE(input.isActionDown(left));
+
+	input.pushKeyEvent(GLFW_KEY_A, 0, GLFW_PRESS, 0);
+	input.pushKeyEvent(GLFW_KEY_A, 0, GLFW_RELEASE, 0);
+	input.dispatch();
+	EXPECT_TRUE(input.isActionDown(left));
+	input.dispatch();
+	EXPECT_FALSE(input.isActionDown(left));
+	EXPECT_FALSE(input.isKeyDown(GLFW_KEY_UNKNOWN));
+}
+
+// Paddles turn by their speed per second of held key, disabled subtrees and destroyed
+// components hear nothing
+TEST(gel_input_system_test_suite, input_scene_test) {
+	gel::GameScene scene;
+	gel::InputSystem& input = scene.getInput();
+	input.bindKey(input.action("paddle_right"), GLFW_KEY_D);
+	input.bindKey(input.action("reset_ball"), GLFW_KEY_R);
+
+	auto* paddle = scene.createEntity();
+	paddle->addComponent(scene.createComponent<gel::PaddleControllerComponent>(2.0f));
+	auto* holder = scene.createEntity();
+	auto* ball = scene.createEntity(gem::Vector<float, 3>{ 1.0f, 0.0f, 0.0f }, gem::Quaternion<float>(), gem::Vector<float, 3>{ 1.0f, 1.0f, 1.0f });
+	ball->addComponent(scene.createComponent<gel::BallResetComponent>(ball->getPosition()));
+	holder->addChild(ball);
+	auto* recorder = scene.createComponent<KeyRecorder>();
+	holder->addComponent(recorder);
+	scene.addEntity(paddle);
+	scene.addEntity(holder);
+
+	scene.bindInput();
+	scene.bindInput();
+	input.subscribeKey(GLFW_KEY_R, recorder);
+	EXPECT_EQ(input.listenerCount(), 2);
+
+	input.pushKeyEvent(GLFW_KEY_D, 0, GLFW_PRESS, 0);
+	scene.update(250.0f);
+	scene.update(250.0f);
+	gem::AxisAngle<float> turned = paddle->getOrientation().toAxisAngle();
+	EXPECT_NEAR(turned.angle() * turned.axis()[1], 1.0f, 1e-4f);
+
+	ball->setPosition({ 5.0f, 0.0f, 0.0f });
+	holder->setEnabled(false);
+	input.pushKeyEvent(GLFW_KEY_R, 0, GLFW_PRESS, 0);
+	scene.update(0.0f);
+	EXPECT_FLOAT_EQ(ball->getPosition()[0], 5.0f);
+	EXPECT_TRUE(recorder->keys.empty());
+
+	holder->setEnabled(true);
+	input.pushKeyEvent(GLFW_KEY_R, 0, GLFW_PRESS, 0);
+	scene.update(0.0f);
+	EXPECT_FLOAT_EQ(ball->getPosition()[0], 1.0f);
+	EXPECT_EQ(recorder->keys.size(), 1);
+
+	scene.destroyEntity(holder);
+	EXPECT_EQ(input.listenerCount(), 0);
+}
\ No newline at end of file
@@ -0,0 +1,62 @@
+#include <gtest/gtest.h>
+
+#include "../../gel/game_entity.hpp"
+#include "../../gel/game_scene.hpp"
+#include "../../gel/physics/rigidbody_component.hpp"
+
+namespace {
+	void expectMatrixEq(const gem::Matrix4<float>& a, const gem::Matrix4<float>& b) {
+		for (int i = 0; i < 4; ++i) {
+			for (int j = 0; j < 4; ++j) EXPECT_NEAR(a(i, j), b(i, j), 1e-5f);
+		}
+	}
+}
+
+// The interpolated local matrix runs from the stored transform to the current one
+TEST(gel_interpolation_test_suite, interp_entity_test) {
+	gel::GameEntity entity({ 1.0f, 0.0f, 0.0f }, gem::Quaternion<float>(), { 1.0f, 1.0f, 1.0f });
+	EXPECT_FALSE(entity.hasMoved());
+
+	entity.storePreviousTransform();
+	entity.setPosition({ 3.0f, 2.0f, 0.0f });
+	entity.setScale({ 2.0f, 2.0f, 2.0f });
+	EXPECT_TRUE(entity.hasMoved());
+
+	gem::Matrix4<float> half = entity.getInterpolatedLocalTransform(0.5f);
+	EXPECT_FLOAT_EQ(half(0, 3), 2.0f);
+	EXPECT_FLOAT_EQ(half(1, 3), 1.0f);
+	EXPECT_FLOAT_EQ(half(0, 0), 1.5f);
+	expectMatrixEq(entity.getInterpolatedLocalTransform(0.0f), entity.getPreviousTRS().toMatrix());
+	expectMatrixEq(entity.getInterpolatedLocalTransform(1.0f), entity.getLocalTransform());
+
+	// A teleport stores the new transform as the previous one
+	entity.storePreviousTransform();
+	EXPECT_FALSE(entity.hasMoved());
+	expectMatrixEq(entity.getInterpolatedLocalTransform(0.25f), entity.getLocalTransform());
+}
+
+// Every scene step starts from the transforms the previous step left, disabled entities included
+TEST(gel_interpolation_test_suite, interp_scene_step_test) {
+	gel::GameScene scene;
+	gel::RigidbodyComponent body;
+	body.setVelocity({ 1.0f, 0.0f, 0.0f });
+
+	gel::GameEntity root, child, idle;
+	root.addComponent(&body);
+	root.addChild(&child);
+	idle.setEnabled(false);
+	scene.addEntity(&root);
+	scene.addEntity(&idle);
+
+	scene.update(1.0f);
+	float after_first = root.getPosition()[0];
+	EXPECT_TRUE(root.hasMoved());
+	EXPECT_FALSE(child.hasMoved());
+
+	idle.setPosition({ 5.0f, 0.0f, 0.0f });
+	scene.update(1.0f);
+	EXPECT_FLOAT_EQ(root.getPreviousTRS().position[0], after_first);
+	EXPECT_GT(root.getPosition()[0], after_first);
+	EXPECT_FALSE(idle.hasMoved());
+	EXPECT_FLOAT_EQ(idle.getPreviousTRS().position[0], 5.0f);
+}
@@ -0,0 +1,193 @@
+#include <gtest/gtest.h>
+
+#include "../../gel/jobs/job_system.hpp"
+#include "../../gel/game_entity.hpp"
+#include "../../gel/game_scene.hpp"
+#include "../../gel/camera/camera_component.hpp"
+#include "../../gel/physics/rigidbody_component.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace {
+	// Counts its updates, declared as touching anything
+	class CountingComponent : public gel::GameComponent {
+	public:
+		void update(float delta_time) override { ++updates; }
+		void render() override {}
+
+		int updates = 0;
+	};
+
+	// Reads the transforms of another entity, anywhere in the scene
+	class Watcher : public gel::GameComponent {
+	public:
+		explicit Watcher(gel::GameEntity* target) : target_(target) {}
+
+		void update(float delta_time) override {
+			world = target_->getWorldTransform();
+			inverse_world = target_->getInverseWorldTransform();
+		}
+		void render() override {}
+		uint8_t getAccess() const override { return gel::ACCESS_OWN_READ | gel::ACCESS_SCENE_READ; }
+
+		gem::Matrix4<float> world;
+		gem::Matrix4<float> inverse_world;
+
+	private:
+		gel::GameEntity* target_;
+	};
+}
+
+// Jobs run after their dependencies, also across a chain and a fan-in
+TEST(gel_job_system_test_suite, js_dependency_test) {
+	gel::JobSystem jobs(3);
+	std::atomic<int> step{ 0 };
+	std::vector<int> order(4, -1);
+
+	auto a = jobs.schedule([&] { order[0] = step++; });
+	auto b = jobs.schedule([&] { order[1] = step++; }, { a });
+	auto c = jobs.schedule([&] { order[2] = step++; }, { a });
+	auto d = jobs.schedule([&] { order[3] = step++; }, { b, c });
+	jobs.wait(d);
+
+	EXPECT_TRUE(jobs.isDone(a) && jobs.isDone(b) && jobs.isDone(c));
+	EXPECT_EQ(order[0], 0);
+	EXPECT_LT(order[1], order[3]);
+	EXPECT_LT(order[2], order[3]);
+
+	// A finished dependency does not hold a new job back
+	auto e = jobs.schedule([&] { ++step; }, { d });
+	jobs.wait(e);
+	EXPECT_EQ(step.load(), 5);
+}
+
+// Every index is visited once, also from nested loops and without workers
+TEST(gel_job_system_test_suite, js_parallel_for_test) {
+	for (size_t workers : { 0, 1, 4 }) {
+		gel::JobSystem jobs(workers);
+		std::vector<int> visits(10007, 0);
+		jobs.parallelFor(visits.size(), 64, [&](size_t begin, size_t end) {
+			for (size_t i = begin; i < end; ++i) ++visits[i];
+		});
+		EXPECT_EQ(std::accumulate(visits.begin(), visits.end(), 0), 10007);
+		EXPECT_EQ(*std::min_element(visits.begin(), visits.end()), 1);
+
+		std::atomic<int> inner{ 0 };
+		jobs.parallelFor(8, 1, [&](size_t begin, size_t end) {
+			for (size_t i = begin; i < end; ++i) {
+				jobs.parallelFor(100, 10, [&](size_t b, size_t e) { inner += static_cast<int>(e - b); });
+			}
+		});
+		EXPECT_EQ(inner.load(), 800);
+	}
+}
+
+// An exception reaches the caller only after every started range finished, and the system
+// keeps working afterwards
+TEST(gel_job_system_test_suite, js_exception_test) {
+	for (size_t workers : { 0, 3 }) {
+		gel::JobSystem jobs(workers);
+		std::atomic<int> running{ 0 }, dependent_runs{ 0 };
+		EXPECT_THROW(jobs.parallelFor(64, 1, [&](size_t begin, size_t end) {
+			++running;
+			if (begin == 5) {
+				--running;
+				throw std::runtime_error("range failed");
+			}
+			std::this_thread::sleep_for(std::chrono::microseconds(200));
+			--running;
+		}), std::runtime_error);
+		EXPECT_EQ(running.load(), 0);
+
+		auto failing = jobs.schedule([] { throw std::runtime_error("job failed"); });
+		auto after = jobs.schedule([&] { ++dependent_runs; }, { failing });
+		EXPECT_THROW(jobs.wait(failing), std::runtime_error);
+		jobs.wait(after);
+		EXPECT_EQ(dependent_runs.load(), 1);
+
+		std::atomic<int> visited{ 0 };
+		jobs.parallelFor(100, 10, [&](size_t begin, size_t end) { visited += static_cast<int>(end - begin); });
+		EXPECT_EQ(visited.load(), 100);
+	}
+}
+
+// The parallel scene update matches the serial one
+TEST(gel_job_system_test_suite, js_scene_update_test) {
+	gel::JobSystem jobs(3);
+	std::vector<gel::RigidbodyComponent> bodies(64);
+	std::vector<CountingComponent> counters(64);
+	gel::CameraComponent camera;
+	gem::Matrix4<float> views[2];
+
+	for (bool parallel : { false, true }) {
+		gel::GameScene scene;
+		std::vector<gel::GameEntity> entities(64);
+		for (size_t i = 0; i < entities.size(); ++i) {
+			bodies[i].setVelocity({ static_cast<float>(i), 1.0f, 0.0f });
+			entities[i].setPosition({ 0.0f, 0.0f, 0.0f });
+			entities[i].addComponent(&bodies[i]);
+			entities[i].addComponent(&counters[i]);
+			counters[i].updates = 0;
+
+			// Every fourth entity hangs below the previous one
+			if (i % 4 != 0) entities[i - 1].addChild(&entities[i]);
+			else scene.addEntity(&entities[i]);
+		}
+		entities[0].addComponent(&camera);
+		camera.targetEntity = &entities[63];
+		entities[60].setEnabled(false);
+
+		scene.setJobSystem(parallel ? &jobs : nullptr);
+		scene.update(0.5f);
+		scene.update(0.5f);
+
+		for (size_t i = 0; i < entities.size(); ++i) {
+			bool active = i < 60;
+			EXPECT_FLOAT_EQ(entities[i].getPosition()[0], active ? static_cast<float>(i) : 0.0f);
+			EXPECT_EQ(counters[i].updates, active ? 2 : 0);
+		}
+		views[parallel] = camera.getViewMatrix();
+	}
+
+	for (int i = 0; i < 4; ++i) {
+		for (int j = 0; j < 4; ++j) EXPECT_FLOAT_EQ(views[0](i, j), views[1](i, j));
+	}
+}
+
+// Queries see current transforms also of entities below a disabled root
+TEST(gel_job_system_test_suite, js_query_disabled_test) {
+	gel::JobSystem jobs(3);
+	gel::GameScene scene;
+	scene.setJobSystem(&jobs);
+
+	auto* hidden = scene.createEntity();
+	auto* target = scene.createEntity();
+	hidden->addChild(target);
+	hidden->setEnabled(false);
+	scene.addEntity(hidden);
+
+	std::vector<Watcher*> watchers;
+	for (int i = 0; i < 16; ++i) {
+		auto* entity = scene.createEntity();
+		watchers.push_back(scene.createComponent<Watcher>(target));
+		entity->addComponent(watchers.back());
+		scene.addEntity(entity);
+	}
+
+	for (int step = 1; step <= 3; ++step) {
+		hidden->setPosition({ static_cast<float>(step), 0.0f, 0.0f });
+		target->setPosition({ 0.0f, 2.0f * step, 0.0f });
+		scene.update(16.0f);
+		for (auto* watcher : watchers) {
+			EXPECT_FLOAT_EQ(watcher->world(0, 3), static_cast<float>(step));
+			EXPECT_FLOAT_EQ(watcher->world(1, 3), 2.0f * step);
+			EXPECT_FLOAT_EQ(watcher->inverse_world(0, 3), -static_cast<float>(step));
+			EXPECT_FLOAT_EQ(watcher->inverse_world(1, 3), -2.0f * step);
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+
+#include "../../gel/memory/object_pool.hpp"
+#include "../../gel/game_entity.hpp"
+#include "../../gel/game_scene.hpp"
+#include "../../gel/light/point_light_component.hpp"
+#include "../../gel/physics/rigidbody_component.hpp"
+
+#include <vector>
+
+namespace {
+	struct Counted {
+		static inline int alive = 0;
+		int value;
+
+		explicit Counted(int value) : value(value) { ++alive; }
+		~Counted() { --alive; }
+	};
+
+	const gem::Vector<float, 3> GREY{ 0.5f, 0.5f, 0.5f };
+}
+
+// Freed slots are reused before new chunks, the pool destroys what is left
+TEST(gel_object_pool_test_suite, op_reuse_test) {
+	{
+		gel::ObjectPool<Counted, 64> pool;
+		std::vector<Counted*> objects;
+		for (int i = 0; i < 100; ++i) objects.push_back(pool.create(i));
+
+		gel::PoolStats stats = pool.stats();
+		EXPECT_EQ(stats.live, 100);
+		EXPECT_EQ(stats.chunks, 2);
+		EXPECT_EQ(stats.capacity, 128);
+		EXPECT_EQ(Counted::alive, 100);
+
+		// Slots are handed out in address order within a chunk
+		EXPECT_LT(objects[0], objects[1]);
+		for (int i = 0; i < 100; i += 2) pool.destroy(objects[i]);
+		EXPECT_EQ(Counted::alive, 50);
+		EXPECT_THROW(pool.destroy(objects[0]), std::runtime_error);
+
+		// Steady churn stays inside the two chunks
+		for (int round = 0; round < 10; ++round) {
+			std::vector<Counted*> spawned;
+			for (int i = 0; i < 78; ++i) spawned.push_back(pool.create(i));
+			for (auto* object : spawned) pool.destroy(object);
+		}
+		EXPECT_EQ(pool.stats().allocations, 2);
+		EXPECT_EQ(objects[1]->value, 1);
+	}
+	EXPECT_EQ(Counted::alive, 0);
+}
+
+// The scene frees what it created, with children, and only detaches what it did not
+TEST(gel_object_pool_test_suite, op_scene_ownership_test) {
+	gel::PointLightComponent external(GREY, GREY, GREY);
+	{
+		gel::GameScene scene;
+		gel::GameEntity* root = scene.createEntity();
+		gel::GameEntity* child = scene.createEntity();
+		root->addChild(child);
+		scene.addEntity(root);
+
+		auto* light = scene.createComponent<gel::PointLightComponent>(GREY, GREY, GREY);
+		child->addComponent(light);
+		child->addComponent(&external);
+		root->addComponent(scene.createComponent<gel::RigidbodyComponent>(2.0f));
+		scene.addExtraLight(light);
+
+		EXPECT_EQ(scene.getMemoryStats<gel::GameEntity>().live, 2);
+		EXPECT_EQ(scene.getMemoryStats().live, 4);
+
+		scene.destroyEntity(root);
+		EXPECT_EQ(scene.getEntitySize(), 0);
+		EXPECT_TRUE(scene.getExtraLights().empty());
+		EXPECT_EQ(external.getEntity(), nullptr);
+
+		gel::PoolStats stats = scene.getMemoryStats();
+		EXPECT_EQ(stats.live, 0);
+		EXPECT_EQ(stats.chunks, 3);
+
+		// Respawning reuses the freed slots
+		for (int i = 0; i < 2; ++i) scene.addEntity(scene.createEntity());
+		EXPECT_EQ(scene.getMemoryStats().allocations, 3);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+
+#include "../../gel/ecs/registry.hpp"
+#include "../../gel/game_entity.hpp"
+#include "../../gel/physics/rigidbody_component.hpp"
+
+#include <set>
+
+namespace {
+	struct Health {
+		int value = 0;
+	};
+}
+
+// Handles are reused with a new version, stale handles stay invalid
+TEST(gel_registry_test_suite, reg_entity_test) {
+	gel::Registry registry;
+	gel::EntityId a = registry.create();
+	gel::EntityId b = registry.create();
+	EXPECT_NE(a, b);
+	EXPECT_EQ(registry.size(), 2);
+
+	registry.emplace<Health>(a, 5);
+	registry.destroy(a);
+	EXPECT_FALSE(registry.valid(a));
+	EXPECT_EQ(registry.size(), 1);
+
+	gel::EntityId c = registry.create();
+	EXPECT_EQ(gel::entityIndex(c), gel::entityIndex(a));
+	EXPECT_NE(c, a);
+	EXPECT_FALSE(registry.has<Health>(c));
+	EXPECT_EQ(registry.tryGet<Health>(a), nullptr);
+
+	registry.destroy(a);
+	EXPECT_TRUE(registry.valid(c));
+	EXPECT_THROW(registry.emplace<Health>(a), std::runtime_error);
+	EXPECT_FALSE(registry.valid(gel::NULL_ENTITY));
+}
+
+// Pools stay dense across pages when components are removed from the middle
+TEST(gel_registry_test_suite, reg_pool_test) {
+	gel::Registry registry;
+	std::vector<gel::EntityId> ids;
+	for (int i = 0; i < 3000; ++i) {
+		ids.push_back(registry.create());
+		registry.emplace<Health>(ids.back(), i);
+	}
+	Health* first = registry.tryGet<Health>(ids[0]);
+	EXPECT_THROW(registry.emplace<Health>(ids[0]), std::runtime_error);
+
+	for (int i = 1; i < 3000; i += 2) registry.remove<Health>(ids[i]);
+	EXPECT_EQ(registry.pool<Health>().size(), 1500);
+	EXPECT_EQ(registry.tryGet<Health>(ids[0]), first);
+
+	std::set<int> seen;
+	registry.each<Health>([&](gel::EntityId id, Health& health) {
+		EXPECT_EQ(registry.tryGet<Health>(id), &health);
+		seen.insert(health.value);
+	});
+	EXPECT_EQ(seen.size(), 1500);
+	for (int value : seen) EXPECT_EQ(value % 2, 0);
+
+	int sum = 0;
+	registry.each<Health>([&](Health& health) { sum += health.value; });
+	EXPECT_EQ(sum, 1499 * 1500);
+}
+
+// Regrowing after a shrink fills the spare page at the right slots
+TEST(gel_registry_test_suite, reg_pool_regrow_test) {
+	gel::Registry registry;
+	std::vector<gel::EntityId> ids;
+	for (int i = 0; i < 1100; ++i) {
+		ids.push_back(registry.create());
+		registry.emplace<Health>(ids.back(), i);
+	}
+	for (int i = 1099; i >= 500; --i) registry.remove<Health>(ids[i]);
+
+	for (int i = 500; i < 1100; ++i) registry.emplace<Health>(ids[i], 12345 + i);
+	for (int i = 0; i < 1100; ++i) {
+		ASSERT_NE(registry.tryGet<Health>(ids[i]), nullptr);
+		EXPECT_EQ(registry.tryGet<Health>(ids[i])->value, i < 500 ? i : 12345 + i);
+	}
+
+	int count = 0;
+	registry.each<Health>([&](gel::EntityId id, Health& health) {
+		EXPECT_EQ(registry.tryGet<Health>(id), &health);
+		++count;
+	});
+	EXPECT_EQ(count, 1100);
+}
+
+// Entities find pooled components and the registry updates them like scene components
+TEST(gel_registry_test_suite, reg_entity_shim_test) {
+	gel::Registry registry;
+	{
+		gel::GameEntity parent;
+		gel::GameEntity child;
+		parent.addChild(&child);
+		child.bindRegistry(registry);
+		EXPECT_THROW(child.bindRegistry(registry), std::runtime_error);
+
+		auto& rb = child.emplaceComponent<gel::RigidbodyComponent>(2.0f);
+		EXPECT_EQ(child.getComponent<gel::RigidbodyComponent>(), &rb);
+		EXPECT_EQ(rb.getEntity(), &child);
+		EXPECT_EQ(parent.getComponent<gel::RigidbodyComponent>(), nullptr);
+
+		rb.setVelocity({ 1.0f, 0.0f, 0.0f });
+		registry.update(0.5f);
+		EXPECT_FLOAT_EQ(child.getPosition()[0], 0.5f);
+
+		// Disabled ancestors stop the update, as in the scene walk
+		parent.setEnabled(false);
+		registry.update(0.5f);
+		EXPECT_FLOAT_EQ(child.getPosition()[0], 0.5f);
+
+		child.eraseComponent<gel::RigidbodyComponent>();
+		EXPECT_EQ(child.getComponent<gel::RigidbodyComponent>(), nullptr);
+		child.emplaceComponent<gel::RigidbodyComponent>();
+	}
+	EXPECT_EQ(registry.size(), 0);
+	EXPECT_EQ(registry.pool<gel::RigidbodyComponent>().size(), 0);
+
+	gel::GameEntity unbound;
+	EXPECT_THROW(unbound.emplaceComponent<gel::RigidbodyComponent>(), std::runtime_error);
+}
\ No newline at end of file
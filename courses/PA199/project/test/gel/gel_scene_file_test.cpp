@@ -0,0 +1,196 @@
+#include <gtest/gtest.h>
+
+#include "../../gel/io/scene_file.hpp"
+#include "../../gel/game_entity.hpp"
+#include "../../gel/game_scene.hpp"
+#include "../../gel/camera/camera_component.hpp"
+#include "../../gel/control/ball_reset_component.hpp"
+#include "../../gel/control/paddle_controller_component.hpp"
+#include "../../gel/light/directional_light_component.hpp"
+#include "../../gel/light/point_light_component.hpp"
+#include "../../gel/physics/adhoc_paddle_broadphase_collision_component.hpp"
+#include "../../gel/physics/rigidbody_component.hpp"
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+namespace {
+	std::string tempPath(const std::string& name) {
+		return (std::filesystem::temp_directory_path() / name).string();
+	}
+
+	void writeBytes(const std::string& path, const std::vector<uint8_t>& bytes) {
+		std::ofstream out(path, std::ios::binary | std::ios::trunc);
+		out.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+	}
+
+	struct Unexported {
+		int value = 0;
+	};
+
+	void expectVectorEq(const gem::Vector<float, 3>& a, const gem::Vector<float, 3>& b) {
+		for (int i = 0; i < 3; ++i) EXPECT_FLOAT_EQ(a[i], b[i]);
+	}
+}
+
+// Hierarchy, transforms and component parameters survive an export and a load
+TEST(gel_scene_file_test_suite, sf_round_trip_test) {
+	std::string path = tempPath("gel_scene_file_round_trip.gels");
+	const gem::Quaternion<float> turned = gem::AxisAngle<float>{ 0.5f, 0.0f, 1.0f, 0.0f }.toQuaternion();
+	{
+		gel::GameScene scene;
+		auto* ball = scene.createEntity(gem::Vector<float, 3>{ 1.0f, 2.0f, 3.0f }, turned, gem::Vector<float, 3>{ 0.5f, 0.5f, 0.5f });
+		ball->bindRegistry(scene.getRegistry());
+		ball->emplaceComponent<gel::RigidbodyComponent>(10.0f).setVelocity({ 0.0f, 0.0f, 0.25f });
+		ball->addComponent(scene.createComponent<gel::BallResetComponent>(gem::Vector<float, 3>{ 1.0f, 2.0f, 3.0f }));
+
+		auto* paddle = scene.createEntity();
+		paddle->addComponent(scene.createComponent<gel::PaddleControllerComponent>(0.2f));
+		auto* hidden = scene.createEntity(gem::Vector<float, 3>{ 0.0f, 1.0f, 0.0f }, gem::Quaternion<float>(), gem::Vector<float, 3>{ 1.0f, 1.0f, 1.0f }, false);
+		paddle->addChild(hidden);
+
+		auto* sun = scene.createComponent<gel::DirectionalLightComponent>(gem::Vector<float, 3>{ 0.1f, 0.1f, 0.1f }, gem::Vector<float, 3>{ 0.5f, 0.5f, 0.5f }, gem::Vector<float, 3>{ 1.0f, 1.0f, 1.0f });
+		auto* lamp = scene.createComponent<gel::PointLightComponent>(gem::Vector<float, 3>{ 0.2f, 0.2f, 0.2f }, gem::Vector<float, 3>{ 0.4f, 0.4f, 0.4f }, gem::Vector<float, 3>{ 0.6f, 0.6f, 0.6f }, 10.0f);
+		auto* camera = scene.createComponent<gel::CameraComponent>(2.0f, 1.5f, 0.1f, 100.0f, true);
+		camera->targetEntity = ball;
+		auto* rig = scene.createEntity();
+		rig->addComponent(sun);
+		rig->addComponent(lamp);
+		rig->addComponent(camera);
+		rig->addComponent(scene.createComponent<gel::AdhocPaddleBroadphaseCollisionComponent>(ball, paddle, paddle));
+
+		for (auto* root : { ball, paddle, rig }) scene.addEntity(root);
+		scene.setMainCamera(camera);
+		scene.setMainLight(sun);
+		scene.addExtraLight(lamp);
+
+		gel::exportScene(scene, path);
+	}
+
+	gel::GameScene scene;
+	std::vector<gel::GameEntity*> entities = gel::loadScene(scene, path);
+	ASSERT_EQ(entities.size(), 4);
+	ASSERT_EQ(scene.getEntitySize(), 3);
+	gel::GameEntity* ball = entities[0];
+	gel::GameEntity* paddle = entities[1];
+	gel::GameEntity* hidden = entities[2];
+	gel::GameEntity* rig = entities[3];
+
+	expectVectorEq(ball->getPosition(), { 1.0f, 2.0f, 3.0f });
+	expectVectorEq(ball->getScale(), { 0.5f, 0.5f, 0.5f });
+	for (int i = 0; i < 4; ++i) EXPECT_FLOAT_EQ(ball->getOrientation()[i], turned[i]);
+	EXPECT_EQ(hidden->getParent(), paddle);
+	EXPECT_FALSE(hidden->isEnabled());
+	EXPECT_TRUE(paddle->isEnabled());
+
+	// The pooled rigidbody goes back into the registry
+	auto* body = ball->getComponent<gel::RigidbodyComponent>();
+	ASSERT_NE(body, nullptr);
+	EXPECT_EQ(ball->getComponents().size(), 1);
+	EXPECT_FLOAT_EQ(body->mass(), 10.0f);
+	expectVectorEq(body->velocity(), { 0.0f, 0.0f, 0.25f });
+	expectVectorEq(ball->getComponent<gel::BallResetComponent>()->initialPosition(), { 1.0f, 2.0f, 3.0f });
+	EXPECT_FLOAT_EQ(paddle->getComponent<gel::PaddleControllerComponent>()->speed(), 0.2f);
+
+	auto* camera = rig->getComponent<gel::CameraComponent>();
+	ASSERT_NE(camera, nullptr);
+	EXPECT_EQ(scene.getMainCamera(), camera);
+	EXPECT_EQ(camera->targetEntity, ball);
+	EXPECT_TRUE(camera->isOrthographic());
+	EXPECT_FLOAT_EQ(camera->fov(), 2.0f);
+	EXPECT_FLOAT_EQ(camera->far(), 100.0f);
+
+	EXPECT_EQ(scene.getMainLight(), rig->getComponent<gel::DirectionalLightComponent>());
+	ASSERT_EQ(scene.getExtraLights().size(), 1);
+	auto* lamp = gel::componentCast<gel::PointLightComponent>(scene.getExtraLights()[0]);
+	ASSERT_NE(lamp, nullptr);
+	EXPECT_FLOAT_EQ(lamp->getRange(), 10.0f);
+	expectVectorEq(lamp->getSpecular(), { 0.6f, 0.6f, 0.6f });
+
+	auto* collision = rig->getComponent<gel::AdhocPaddleBroadphaseCollisionComponent>();
+	ASSERT_NE(collision, nullptr);
+	EXPECT_EQ(collision->getBallEntity(), ball);
+	EXPECT_EQ(collision->getPaddleEntityA(), paddle);
+
+	// Pooled components of other types are refused rather than dropped
+	ball->emplaceComponent<Unexported>(1);
+	EXPECT_THROW(gel::exportScene(scene, path), std::runtime_error);
+
+	std::filesystem::remove(path);
+}
+
+// Mesh views point into the mapping and equal meshes are stored once
+TEST(gel_scene_file_test_suite, sf_mesh_test) {
+	std::string path = tempPath("gel_scene_file_mesh.gels");
+	std::vector<gel::MeshRendererVAO> vertices = {
+		{ 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f },
+		{ 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 1.0f, 0.0f },
+		{ 0.0f, 0.0f, 1.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f }
+	};
+	std::vector<unsigned int> indices = { 0, 1, 2 };
+	std::vector<gel::PackedMeshRendererVAO> packed;
+	for (const auto& vertex : vertices) packed.push_back(gel::PackVertex(vertex));
+
+	gel::SceneWriter writer;
+	uint32_t full = writer.addMesh(vertices.data(), 3, indices.data(), 3, gel::VertexLayout::Full);
+	EXPECT_EQ(writer.addMesh(vertices.data(), 3, indices.data(), 3, gel::VertexLayout::Full), full);
+	uint32_t small = writer.addMesh(packed.data(), 3, indices.data(), 3, gel::VertexLayout::Packed);
+	EXPECT_NE(small, full);
+	writer.write(path);
+
+	gel::SceneFile file(path);
+	EXPECT_EQ(file.header().mesh_count, 2);
+
+	gel::MeshView view = file.mesh(full);
+	const uint8_t* begin = file.data();
+	EXPECT_GE(static_cast<const uint8_t*>(view.vertices), begin);
+	EXPECT_LE(reinterpret_cast<const uint8_t*>(view.indices + view.index_count), begin + file.size());
+	EXPECT_EQ(reinterpret_cast<uintptr_t>(view.vertices) % 16, 0);
+	EXPECT_EQ(std::memcmp(view.vertices, vertices.data(), sizeof(gel::MeshRendererVAO) * 3), 0);
+	EXPECT_EQ(std::memcmp(view.indices, indices.data(), sizeof(unsigned int) * 3), 0);
+
+	gel::MeshView packed_view = file.mesh(small);
+	EXPECT_EQ(packed_view.layout, gel::VertexLayout::Packed);
+	EXPECT_EQ(std::memcmp(packed_view.vertices, packed.data(), sizeof(gel::PackedMeshRendererVAO) * 3), 0);
+
+	std::filesystem::remove(path);
+}
+
+// Files of another version, truncated or with records out of order are rejected on open
+TEST(gel_scene_file_test_suite, sf_reject_test) {
+	std::string path = tempPath("gel_scene_file_reject.gels");
+	EXPECT_THROW(gel::SceneFile("gel_scene_file_missing.gels"), std::runtime_error);
+
+	gel::SceneWriter writer;
+	writer.addEntity(gel::SceneFileEntity{ { 0, 0, 0 }, { 1, 0, 0, 0 }, { 1, 1, 1 }, gel::SCENE_FILE_NONE, gel::SCENE_ENTITY_ENABLED, 0, 0 });
+	writer.addEntity(gel::SceneFileEntity{ { 0, 0, 0 }, { 1, 0, 0, 0 }, { 1, 1, 1 }, 0, gel::SCENE_ENTITY_ENABLED, 0, 0 });
+	std::vector<uint8_t> bytes = writer.serialize();
+
+	writeBytes(path, bytes);
+	EXPECT_NO_THROW(gel::SceneFile{ path });
+
+	auto* header = reinterpret_cast<gel::SceneFileHeader*>(bytes.data());
+	auto* entities = reinterpret_cast<gel::SceneFileEntity*>(bytes.data() + header->entities);
+
+	std::vector<uint8_t> broken = bytes;
+	reinterpret_cast<gel::SceneFileHeader*>(broken.data())->version = gel::SCENE_FILE_VERSION + 1;
+	writeBytes(path, broken);
+	EXPECT_THROW(gel::SceneFile{ path }, std::runtime_error);
+
+	broken = bytes;
+	broken[0] = 'X';
+	writeBytes(path, broken);
+	EXPECT_THROW(gel::SceneFile{ path }, std::runtime_error);
+
+	broken.assign(bytes.begin(), bytes.begin() + header->entities + sizeof(gel::SceneFileEntity));
+	writeBytes(path, broken);
+	EXPECT_THROW(gel::SceneFile{ path }, std::runtime_error);
+
+	entities[0].parent = 1;
+	writeBytes(path, bytes);
+	EXPECT_THROW(gel::SceneFile{ path }, std::runtime_error);
+
+	std::filesystem::remove(path);
+}
\ No newline at end of file
@@ -0,0 +1,188 @@
+#include "../../gem/vector.hpp"
+#include "../../gem/quaternion.hpp"
+#include "../../gem/axis_angle.hpp"
+#include "../../gem/interpolation.hpp"
+#include "../../gem/vector_array.hpp"
+#include "../../gem/animation.hpp"
+#include "gem_test_helpers.hpp"
+#include <gtest/gtest.h>
+#include <cmath>
+
+using Vec3 = gem::Vector<float, 3>;
+using Quat = gem::Quaternion<float>;
+
+static Quat makeRotation(float angle, float x, float y, float z) {
+	return gem::AxisAngle<float>(angle, x, y, z).toQuaternion();
+}
+
+// Pairs of unit quaternions from nearly equal to opposite hemispheres, with blend factors in [0, 1]
+template<typename T>
+static void makeRotationPairs(gem::VectorArray<T, 4>& a, gem::VectorArray<T, 4>& b, std::vector<T>& t) {
+	for (size_t i = 0; i < BATCH_COUNT; ++i) {
+		T f = static_cast<T>(i);
+		gem::Quaternion<T> qa = gem::AxisAngle<T>(std::sin(T(0.7) * f) * 3, 1, std::cos(f), T(0.5)).toQuaternion();
+		gem::Quaternion<T> qb = gem::AxisAngle<T>(std::sin(T(0.7) * f) * 3 + T(0.4) * f * f / BATCH_COUNT, std::sin(f), 1, T(0.2)).toQuaternion();
+		if (i % 5 == 0) qb = qa;
+		if (i % 3 == 0) qb = -qb;
+
+		a.push_back(qa.data);
+		b.push_back(qb.data);
+		t.push_back(static_cast<T>(i % 8) / 7);
+	}
+}
+
+// Segments found by stepping the cursor forward, clamping at both ends and seeking backwards
+TEST(gem_animation_test_suite, an_track_cursor_test) {
+	gem::Track<float, 3> track;
+	track.addKey(0.0f, { 0.0f, 0.0f, 0.0f });
+	track.addKey(1.0f, { 1.0f, 0.0f, 0.0f });
+	track.addKey(3.0f, { 1.0f, 4.0f, 0.0f });
+	track.addKey(4.0f, { 1.0f, 4.0f, 2.0f });
+	EXPECT_FLOAT_EQ(track.duration(), 4.0f);
+
+	gem::TrackCursor cursor;
+	auto segment = track.locate(0.5f, cursor);
+	EXPECT_EQ(segment.from, 0u);
+	EXPECT_FLOAT_EQ(segment.t, 0.5f);
+
+	segment = track.locate(3.5f, cursor);
+	EXPECT_EQ(segment.from, 2u);
+	EXPECT_EQ(segment.to, 3u);
+	EXPECT_EQ(cursor.key, 2u);
+
+	// Seeking back restarts from the right key
+	segment = track.locate(1.5f, cursor);
+	EXPECT_EQ(segment.from, 1u);
+	EXPECT_FLOAT_EQ(segment.t, 0.25f);
+
+	// Exactly on a key blends from that key
+	segment = track.locate(3.0f, cursor);
+	EXPECT_EQ(segment.from, 2u);
+	EXPECT_FLOAT_EQ(segment.t, 0.0f);
+
+	segment = track.locate(-1.0f, cursor);
+	EXPECT_EQ(segment.from, 0u);
+	EXPECT_EQ(segment.to, 0u);
+
+	segment = track.locate(10.0f, cursor);
+	EXPECT_EQ(segment.from, 3u);
+	EXPECT_EQ(segment.to, 3u);
+
+	EXPECT_THROW(track.addKey(4.0f, { 0.0f, 0.0f, 0.0f }), std::runtime_error);
+
+	gem::Track<float, 3> empty;
+	EXPECT_THROW(empty.locate(0.0f, cursor), std::runtime_error);
+}
+
+// Sampling a position track frame by frame gives the same values as a fresh cursor
+TEST(gem_animation_test_suite, an_track_sample_test) {
+	gem::Track<float, 3> track;
+	track.addKey(0.0f, { 0.0f, 0.0f, 0.0f });
+	track.addKey(1.0f, { 2.0f, 0.0f, 0.0f });
+	track.addKey(2.0f, { 2.0f, 2.0f, 0.0f });
+
+	gem::TrackCursor cursor;
+	Vec3 v = track.sample(1.5f, cursor);
+	EXPECT_FLOAT_EQ(v[0], 2.0f);
+	EXPECT_FLOAT_EQ(v[1], 1.0f);
+
+	cursor = {};
+	for (int frame = 0; frame <= 150; ++frame) {
+		float time = frame / 60.0f;
+		gem::TrackCursor fresh;
+		Vec3 stepped = track.sample(time, cursor);
+		Vec3 searched = track.sample(time, fresh);
+		for (int k = 0; k < 3; ++k) EXPECT_FLOAT_EQ(stepped[k], searched[k]);
+	}
+
+	gem::TrackCursor end;
+	Vec3 last = track.sample(5.0f, end);
+	EXPECT_FLOAT_EQ(last[1], 2.0f);
+}
+
+// Rotation keys are kept in one hemisphere, so sampling takes the shorter arc
+TEST(gem_animation_test_suite, an_rotation_track_test) {
+	Quat q0 = makeRotation(0.0f, 0.0f, 1.0f, 0.0f);
+	Quat q1 = makeRotation(static_cast<float>(M_PI / 2), 0.0f, 1.0f, 0.0f);
+
+	gem::RotationTrack<float> track;
+	track.addKey(0.0f, q0);
+	track.addKey(1.0f, -q1);
+	EXPECT_GT(track.value(0).dot(track.value(1)), 0.0f);
+
+	Quat expected = makeRotation(static_cast<float>(M_PI / 4), 0.0f, 1.0f, 0.0f);
+	for (auto interpolation : { gem::RotationInterpolation::Nlerp, gem::RotationInterpolation::Slerp }) {
+		gem::TrackCursor cursor;
+		Quat q = track.sample(0.5f, cursor, interpolation);
+		EXPECT_NEAR(std::fabs(q.dot(expected)), 1.0f, 1e-5f);
+	}
+
+	// Slerp keeps constant angular velocity, a quarter of the way is a quarter of the angle
+	gem::TrackCursor cursor;
+	Quat quarter = track.sample(0.25f, cursor, gem::RotationInterpolation::Slerp);
+	EXPECT_NEAR(std::fabs(quarter.dot(makeRotation(static_cast<float>(M_PI / 8), 0.0f, 1.0f, 0.0f))), 1.0f, 1e-5f);
+
+	gem::AnimationClip<float> clip;
+	clip.rotation = track;
+	clip.position.addKey(2.0f, { 0.0f, 0.0f, 0.0f });
+	EXPECT_FLOAT_EQ(clip.duration(), 2.0f);
+}
+
+// Batch lerp against the scalar lerp
+TEST(gem_animation_test_suite, an_lerp_batch_test) {
+	gem::VectorArray<float, 3> a, b, out;
+	std::vector<float> t;
+	for (size_t i = 0; i < BATCH_COUNT; ++i) {
+		float f = static_cast<float>(i);
+		a.push_back({ f, -f, 2.0f * f });
+		b.push_back({ std::sin(f), 3.0f, -f });
+		t.push_back(static_cast<float>(i % 8) / 7.0f);
+	}
+
+	gem::lerp(a, b, t, out);
+	ASSERT_EQ(out.size(), BATCH_COUNT);
+	for (size_t i = 0; i < BATCH_COUNT; ++i) {
+		Vec3 expected = gem::lerp(a.get(i), b.get(i), t[i]);
+		expectNear<float, 3>(out.get(i), expected, 1e-5f);
+	}
+
+	t.pop_back();
+	EXPECT_THROW(gem::lerp(a, b, t, out), std::runtime_error);
+}
+
+// Batch nlerp and slerp against the scalar lerp and slerp, including equal and opposite pairs
+TEST(gem_animation_test_suite, an_quaternion_batch_test) {
+	gem::VectorArray<float, 4> a, b, nlerped, slerped;
+	std::vector<float> t;
+	makeRotationPairs(a, b, t);
+
+	gem::nlerp(a, b, t, nlerped);
+	gem::slerp(a, b, t, slerped);
+	ASSERT_EQ(slerped.size(), BATCH_COUNT);
+
+	for (size_t i = 0; i < BATCH_COUNT; ++i) {
+		Quat qa(a.get(i)), qb(b.get(i));
+		Quat shorter = qa.dot(qb) < 0 ? Quat(-qb) : qb;
+
+		Quat n(nlerped.get(i));
+		EXPECT_NEAR(n.dot(gem::lerp(qa, shorter, t[i])), 1.0f, 1e-5f);
+
+		Quat s(slerped.get(i));
+		EXPECT_NEAR(s.magnitude(), 1.0f, 1e-5f);
+		// q and -q are the same rotation, slerp returns the end keys as given at t = 0 and t = 1
+		EXPECT_NEAR(std::fabs(s.dot(gem::slerp(qa, qb, t[i]).normalize())), 1.0f, 1e-5f);
+	}
+}
+
+// The generic path for double gives the scalar answers as well
+TEST(gem_animation_test_suite, an_batch_double_test) {
+	gem::VectorArray<double, 4> a, b, slerped;
+	std::vector<double> t;
+	makeRotationPairs(a, b, t);
+
+	gem::slerp(a, b, t, slerped);
+	for (size_t i = 0; i < BATCH_COUNT; ++i) {
+		gem::Quaternion<double> s(slerped.get(i));
+		EXPECT_NEAR(std::fabs(s.dot(gem::slerp(gem::Quaternion<double>(a.get(i)), gem::Quaternion<double>(b.get(i)), static_cast<float>(t[i])).normalize())), 1.0, 1e-9);
+	}
+}
\ No newline at end of file
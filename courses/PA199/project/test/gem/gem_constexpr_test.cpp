@@ -0,0 +1,135 @@
+#include "../../gem/math.hpp"
+#include "../../gem/vector.hpp"
+#include "../../gem/matrix.hpp"
+#include "../../gem/quaternion.hpp"
+#include "../../gem/axis_angle.hpp"
+#include "../../gem/coordinates.hpp"
+#include "../../gem/interpolation.hpp"
+#include "../../gem/transform.hpp"
+#include <gtest/gtest.h>
+#include <cmath>
+
+namespace {
+	constexpr bool near(double a, double b, double eps = 1e-6) {
+		return gem::math::abs(a - b) <= eps;
+	}
+
+	constexpr float HALF_PI = static_cast<float>(gem::math::PI / 2);
+}
+
+// Compile-time tests for gem::Vector
+constexpr gem::Vector<float, 3> CX_A = { 1.0f, 2.0f, 3.0f };
+constexpr gem::Vector<float, 3> CX_B = { 4.0f, -5.0f, 6.0f };
+constexpr gem::Vector<float, 4> CX_C = { 1.0f, 2.0f, 3.0f, 4.0f };
+
+static_assert((CX_A + CX_B)[0] == 5.0f);
+static_assert((CX_A - CX_B)[1] == 7.0f);
+static_assert((CX_A * 2.0f)[2] == 6.0f);
+static_assert((CX_B / CX_A)[1] == -2.5f);
+static_assert((-CX_A)[0] == -1.0f);
+static_assert(CX_A.dot(CX_B) == 12.0f);
+static_assert(CX_A.cross(CX_B)[0] == 27.0f);
+static_assert(CX_A.cross(CX_B)[1] == 6.0f);
+static_assert(CX_A.cross(CX_B)[2] == -13.0f);
+static_assert(near(gem::Vector<float, 3>{ 3.0f, 4.0f, 0.0f }.magnitude(), 5.0));
+static_assert(near(gem::Vector<float, 3>{ 0.0f, 0.0f, 2.0f }.normalize()[2], 1.0));
+
+// Vector<float, 4> uses the SIMD kernels at runtime, but must still fold at compile time
+static_assert((CX_C + CX_C)[3] == 8.0f);
+static_assert((1.0f - CX_C)[1] == -1.0f);
+static_assert(CX_C.dot(CX_C) == 30.0f);
+
+// Compile-time tests for gem::Matrix4
+constexpr gem::Matrix4<float> CX_I = gem::Matrix4<float>::identity();
+constexpr gem::Matrix4<float> CX_T = gem::Matrix4<float>::translation({ 1.0f, 2.0f, 3.0f });
+constexpr gem::Matrix4<float> CX_M = {
+	{ 2.0f, 0.0f, 0.0f, 1.0f },
+	{ 0.0f, 4.0f, 0.0f, 2.0f },
+	{ 0.0f, 0.0f, 8.0f, 3.0f },
+	{ 0.0f, 0.0f, 0.0f, 1.0f }
+};
+
+static_assert(CX_I[0][0] == 1.0f && CX_I[0][1] == 0.0f && CX_I[3][3] == 1.0f);
+static_assert(gem::Matrix4<float>::zero()[2][2] == 0.0f);
+static_assert((CX_T * gem::Vector<float, 4>{ 0.0f, 0.0f, 0.0f, 1.0f })[1] == 2.0f);
+static_assert((CX_T * CX_T)[2][3] == 6.0f);
+static_assert(CX_T.transpose()[3][0] == 1.0f);
+static_assert(CX_M.det() == 64.0f);
+static_assert(CX_M.inverse()[1][1] == 0.25f);
+static_assert(CX_M.inverse()[2][3] == -0.375f);
+static_assert(CX_M.affineInverse()[0][3] == -0.5f);
+static_assert((CX_M * CX_M.inverse())[1][3] == 0.0f);
+static_assert(near(gem::Matrix4<float>::rotationZ(HALF_PI)[1][0], 1.0));
+
+// Compile-time tests for gem::Quaternion and gem::AxisAngle
+constexpr gem::Quaternion<float> CX_Q = gem::AxisAngle<float>(HALF_PI, 0.0f, 0.0f, 2.0f).toQuaternion();
+
+static_assert(near(CX_Q.w(), 0.70710678118654752));
+static_assert(near(CX_Q.z(), 0.70710678118654752));
+static_assert(near(CX_Q.rotate({ 1.0f, 0.0f, 0.0f })[1], 1.0));
+static_assert(near((CX_Q * CX_Q.conjugate()).w(), 1.0));
+static_assert(near(CX_Q.toAxisAngle().angle(), HALF_PI));
+static_assert(near(gem::Matrix4<float>::rotation(CX_Q)[0][1], -1.0));
+static_assert(near(gem::slerp(gem::Quaternion<float>(), CX_Q, 0.5f).z(), 0.38268343236508977));
+
+// Compile-time tests for gem::Polar
+static_assert(near(gem::Polar<float>(2.0f, HALF_PI).toCartesian()[1], 2.0));
+static_assert(near(gem::Polar<float>::fromCartesian(gem::Vector<float, 2>{ -1.0f, 0.0f }).theta(), gem::math::PI));
+static_assert(near(gem::Polar<float>(1.0f, -HALF_PI).normalize().theta(), 3 * gem::math::PI / 2));
+
+// Compile-time tests for gem::Transform
+constexpr gem::Transform<float> CX_TRS({ 1.0f, 0.0f, 0.0f }, CX_Q, { 2.0f, 2.0f, 2.0f });
+
+static_assert(near(CX_TRS.transformPoint({ 1.0f, 0.0f, 0.0f })[1], 2.0));
+static_assert(near((CX_TRS * CX_TRS.inverse()).position[0], 0.0));
+static_assert(near(CX_TRS.toMatrix()[0][3], 1.0));
+
+// consteval contexts
+consteval gem::Matrix4<float> makeView() {
+	return gem::Matrix4<float>::lookAt({ 0.0f, 0.0f, 5.0f }, { 0.0f, 0.0f, 0.0f }, { 0.0f, 1.0f, 0.0f });
+}
+
+static_assert(near(makeView()[2][3], -5.0));
+static_assert(near(gem::Matrix4<float>::perspective(90.0f, 1.0f, 1.0f, 3.0f)[1][1], 1.0));
+
+// The compile-time approximations should agree with <cmath>
+TEST(gem_constexpr_test_suite, cx_math_test) {
+	for (int i = -200; i <= 200; ++i) {
+		double x = i * 0.05;
+		EXPECT_NEAR(gem::math::detail::sin(x), std::sin(x), 1e-12) << "x = " << x;
+		EXPECT_NEAR(gem::math::detail::cos(x), std::cos(x), 1e-12) << "x = " << x;
+		EXPECT_NEAR(gem::math::detail::atan(x), std::atan(x), 1e-12) << "x = " << x;
+		EXPECT_NEAR(gem::math::detail::atan2(x, 1.5 - x), std::atan2(x, 1.5 - x), 1e-12) << "x = " << x;
+		EXPECT_NEAR(gem::math::detail::sqrt(std::abs(x) * 37.0), std::sqrt(std::abs(x) * 37.0), 1e-12) << "x = " << x;
+	}
+
+	for (int i = -100; i <= 100; ++i) {
+		double x = i * 0.01;
+		EXPECT_NEAR(gem::math::detail::acos(x), std::acos(x), 1e-12) << "x = " << x;
+		EXPECT_NEAR(gem::math::detail::asin(x), std::asin(x), 1e-12) << "x = " << x;
+	}
+
+	EXPECT_DOUBLE_EQ(gem::math::detail::fmod(7.5, 2.0), std::fmod(7.5, 2.0));
+	EXPECT_DOUBLE_EQ(gem::math::detail::fmod(-7.5, 2.0), std::fmod(-7.5, 2.0));
+}
+
+// Runtime calls go through <cmath> and the SIMD kernels and must match the folded values
+TEST(gem_constexpr_test_suite, cx_runtime_match_test) {
+	gem::Vector<float, 4> c = CX_C;
+	constexpr float folded = CX_C.dot(CX_C);
+	EXPECT_FLOAT_EQ(c.dot(c), folded);
+
+	gem::Quaternion<float> q = gem::AxisAngle<float>(HALF_PI, 0.0f, 0.0f, 2.0f).toQuaternion();
+	for (int i = 0; i < 4; ++i) {
+		EXPECT_NEAR(q[i], CX_Q[i], 1e-6);
+	}
+
+	gem::Matrix4<float> m = CX_M;
+	gem::Matrix4<float> inv = m.inverse();
+	constexpr gem::Matrix4<float> foldedInv = CX_M.inverse();
+	for (int i = 0; i < 4; ++i) {
+		for (int j = 0; j < 4; ++j) {
+			EXPECT_FLOAT_EQ(inv[i][j], foldedInv[i][j]);
+		}
+	}
+}
\ No newline at end of file
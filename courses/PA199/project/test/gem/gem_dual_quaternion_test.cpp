@@ -0,0 +1,128 @@
+#include "../../gem/vector.hpp"
+#include "../../gem/matrix.hpp"
+#include "../../gem/axis_angle.hpp"
+#include "../../gem/quaternion.hpp"
+#include "../../gem/dual_quaternion.hpp"
+#include "gem_test_helpers.hpp"
+#include <gtest/gtest.h>
+#include <cmath>
+
+using Vec3 = gem::Vector<float, 3>;
+using Quat = gem::Quaternion<float>;
+using DQ = gem::DualQuaternion<float>;
+
+static const Quat ROTATION = gem::AxisAngle<float>(1.1f, 0.3f, 1.0f, -0.4f).toQuaternion();
+static const Vec3 TRANSLATION{ 2.0f, -1.0f, 3.5f };
+
+constexpr gem::DualQuaternion<double> CX_DQ = gem::DualQuaternion<double>::fromTranslation({ 1.0, 2.0, 3.0 }) * gem::DualQuaternion<double>::fromTranslation({ 1.0, 0.0, -1.0 });
+static_assert(CX_DQ.translation()[0] == 2.0 && CX_DQ.translation()[2] == 2.0);
+
+// Construction, translation recovery and point transformation
+TEST(gem_dual_quaternion_test_suite, dq_basic_test) {
+	DQ identity;
+	expectNear(identity.transformPoint({ 1.0f, 2.0f, 3.0f }), { 1.0f, 2.0f, 3.0f }, 1e-6f);
+
+	DQ dq = DQ::fromRotationTranslation(ROTATION, TRANSLATION);
+	expectNear(dq.translation(), TRANSLATION, 1e-5f);
+	EXPECT_NEAR(dq.rotation().dot(ROTATION), 1.0f, 1e-6f);
+
+	Vec3 p{ 0.5f, -2.0f, 1.0f };
+	expectNear(dq.transformPoint(p), ROTATION.rotate(p) + TRANSLATION, 1e-5f);
+	expectNear(dq.transformVector(p), ROTATION.rotate(p), 1e-5f);
+
+	// Unit dual quaternion: the real part is orthogonal to the dual part
+	EXPECT_NEAR(dq.real.dot(dq.dual), 0.0f, 1e-6f);
+}
+
+// Conversion to and from Matrix4 and composition against matrix products
+TEST(gem_dual_quaternion_test_suite, dq_matrix_test) {
+	DQ a = DQ::fromRotationTranslation(ROTATION, TRANSLATION);
+	gem::Matrix4<float> ma = gem::Matrix4<float>::translation(TRANSLATION) * gem::Matrix4<float>::rotation(ROTATION);
+	expectNear(a.toMatrix(), ma, 1e-5f);
+
+	// Every branch of the rotation extraction
+	for (float angle : { 0.3f, 2.9f, 3.1f }) {
+		for (Vec3 axis : { Vec3{ 1.0f, 0.1f, 0.2f }, Vec3{ 0.1f, 1.0f, 0.2f }, Vec3{ 0.2f, 0.1f, 1.0f } }) {
+			DQ dq = DQ::fromRotationTranslation(gem::AxisAngle<float>(angle, axis[0], axis[1], axis[2]).toQuaternion(), TRANSLATION);
+			DQ back = DQ::fromMatrix(dq.toMatrix());
+			EXPECT_NEAR(std::fabs(back.real.dot(dq.real)), 1.0f, 1e-5f);
+			expectNear(back.translation(), TRANSLATION, 1e-4f);
+		}
+	}
+
+	DQ b = DQ::fromRotationTranslation(gem::AxisAngle<float>(-0.7f, 1.0f, 0.0f, 0.5f).toQuaternion(), { -3.0f, 0.0f, 1.0f });
+	expectNear((a * b).toMatrix(), a.toMatrix() * b.toMatrix(), 1e-4f);
+	expectNear((a * b * a).transformPoint({ 1.0f, 1.0f, 1.0f }), a.transformPoint(b.transformPoint(a.transformPoint({ 1.0f, 1.0f, 1.0f }))), 1e-4f);
+}
+
+// Conjugate and inverse undo the transform
+TEST(gem_dual_quaternion_test_suite, dq_inverse_test) {
+	DQ dq = DQ::fromRotationTranslation(ROTATION, TRANSLATION);
+	Vec3 p{ 4.0f, 1.0f, -2.0f };
+
+	expectNear(dq.conjugate().transformPoint(dq.transformPoint(p)), p, 1e-5f);
+	expectNear(dq.inverse().transformPoint(dq.transformPoint(p)), p, 1e-5f);
+
+	DQ product = dq * dq.inverse();
+	EXPECT_NEAR(product.real.w(), 1.0f, 1e-6f);
+	expectNear(product.translation(), { 0.0f, 0.0f, 0.0f }, 1e-5f);
+
+	// Normalization brings a scaled dual quaternion back to the same transform
+	DQ scaled = dq * 3.0f;
+	expectNear(scaled.normalize().transformPoint(p), dq.transformPoint(p), 1e-5f);
+
+	EXPECT_THROW(DQ(Quat(0.0f, 0.0f, 0.0f, 0.0f), Quat(0.0f, 0.0f, 0.0f, 0.0f)).normalize(), std::runtime_error);
+}
+
+// Screw interpolation moves at constant speed, DLB stays rigid and close to it
+TEST(gem_dual_quaternion_test_suite, dq_interpolation_test) {
+	DQ a = DQ::fromRotationTranslation(Quat(), { 0.0f, 0.0f, 0.0f });
+	DQ b = DQ::fromRotationTranslation(gem::AxisAngle<float>(static_cast<float>(M_PI / 2), 0.0f, 0.0f, 1.0f).toQuaternion(), { 0.0f, 0.0f, 4.0f });
+
+	// A quarter turn about z while rising 4 along it: half way is an eighth turn at height 2
+	DQ half = gem::sclerp(a, b, 0.5f);
+	EXPECT_NEAR(std::fabs(half.real.dot(gem::AxisAngle<float>(static_cast<float>(M_PI / 4), 0.0f, 0.0f, 1.0f).toQuaternion())), 1.0f, 1e-5f);
+	expectNear(half.translation(), { 0.0f, 0.0f, 2.0f }, 1e-5f);
+
+	// Intermediate poses stay rigid and the last one lands on the target
+	DQ c = DQ::fromRotationTranslation(ROTATION, TRANSLATION);
+	for (float t : { 0.0f, 0.25f, 0.5f, 1.0f }) {
+		DQ s = gem::sclerp(a, c, t);
+		EXPECT_NEAR(s.real.magnitude(), 1.0f, 1e-5f);
+		EXPECT_NEAR(s.real.dot(s.dual), 0.0f, 1e-5f);
+	}
+	expectNear(gem::sclerp(a, c, 1.0f).transformPoint({ 1.0f, 2.0f, 3.0f }), c.transformPoint({ 1.0f, 2.0f, 3.0f }), 1e-4f);
+
+	// Pure translation
+	DQ moved = gem::sclerp(a, DQ::fromTranslation({ 2.0f, 4.0f, 0.0f }), 0.25f);
+	expectNear(moved.translation(), { 0.5f, 1.0f, 0.0f }, 1e-6f);
+
+	DQ blended = gem::dlb(a, b, 0.5f);
+	EXPECT_NEAR(blended.real.magnitude(), 1.0f, 1e-6f);
+	EXPECT_NEAR(std::fabs(blended.real.dot(half.real)), 1.0f, 1e-5f);
+
+	// The opposite sign of the same transform blends the same way
+	DQ flipped = b * -1.0f;
+	EXPECT_NEAR(std::fabs(gem::dlb(a, flipped, 0.5f).real.dot(blended.real)), 1.0f, 1e-6f);
+	expectNear(gem::sclerp(a, flipped, 0.5f).translation(), half.translation(), 1e-5f);
+
+	const DQ dqs[3] = { a, b, c };
+	const float weights[3] = { 0.2f, 0.3f, 0.5f };
+	DQ mixed = gem::blend(dqs, weights, 3);
+	EXPECT_NEAR(mixed.real.magnitude(), 1.0f, 1e-6f);
+	EXPECT_NEAR(mixed.real.dot(mixed.dual), 0.0f, 1e-6f);
+}
+
+// The simd product matches the scalar definition
+TEST(gem_dual_quaternion_test_suite, dq_simd_test) {
+	DQ a = DQ::fromRotationTranslation(ROTATION, TRANSLATION);
+	DQ b = DQ::fromRotationTranslation(gem::AxisAngle<float>(2.0f, -1.0f, 0.2f, 0.3f).toQuaternion(), { 0.5f, 7.0f, -2.0f });
+
+	DQ product = a * b;
+	Quat real = a.real * b.real;
+	Quat dual = a.real * b.dual + a.dual * b.real;
+	for (int k = 0; k < 4; ++k) {
+		EXPECT_NEAR(product.real[k], real[k], 1e-6f);
+		EXPECT_NEAR(product.dual[k], dual[k], 1e-5f);
+	}
+}
\ No newline at end of file
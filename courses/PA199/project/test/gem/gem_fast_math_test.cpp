@@ -0,0 +1,87 @@
+#include "../../gem/math.hpp"
+#include "../../gem/fast_math.hpp"
+#include <gtest/gtest.h>
+#include <cmath>
+
+// Largest deviation of a scalar approximation from <cmath> over evenly spaced samples
+template<typename F, typename G>
+static double maxError(F approx, G exact, double from, double to, int samples = 20001) {
+	double max_error = 0.0;
+	for (int i = 0; i < samples; ++i) {
+		float x = static_cast<float>(from + (to - from) * i / (samples - 1));
+		max_error = std::max(max_error, std::abs(static_cast<double>(approx(x)) - exact(static_cast<double>(x))));
+	}
+	return max_error;
+}
+
+// Largest deviation of the SIMD form from the scalar form, four samples at a time
+template<typename F, typename G>
+static double maxPacketDifference(F packet, G scalar, float from, float to, int samples = 4000) {
+	double max_difference = 0.0;
+	for (int i = 0; i < samples; i += 4) {
+		float x[4], out[4];
+		for (int j = 0; j < 4; ++j) x[j] = from + (to - from) * (i + j) / (samples - 1);
+		gem::simd::store(out, packet(gem::simd::load(x)));
+		for (int j = 0; j < 4; ++j) {
+			max_difference = std::max(max_difference, std::abs(static_cast<double>(out[j]) - static_cast<double>(scalar(x[j]))));
+		}
+	}
+	return max_difference;
+}
+
+// Maximum errors documented in fast_math.hpp
+TEST(gem_fast_math_test_suite, fm_accuracy_test) {
+	EXPECT_LT(maxError([](float x) { return gem::fast::sin(x); }, [](double x) { return std::sin(x); }, -100.0, 100.0), 3e-7);
+	EXPECT_LT(maxError([](float x) { return gem::fast::cos(x); }, [](double x) { return std::cos(x); }, -100.0, 100.0), 3e-7);
+	EXPECT_LT(maxError([](float x) { return gem::fast::acos(x); }, [](double x) { return std::acos(x); }, -1.0, 1.0), 5e-7);
+	EXPECT_LT(maxError([](float x) { return gem::fast::atan2(x, 0.75f); }, [](double x) { return std::atan2(x, 0.75); }, -50.0, 50.0), 3e-7);
+	EXPECT_LT(maxError([](float x) { return gem::fast::atan2(0.75f, x); }, [](double x) { return std::atan2(0.75, x); }, -50.0, 50.0), 3e-7);
+	EXPECT_LT(maxError([](float x) { return gem::fast::atan2(-0.75f, x); }, [](double x) { return std::atan2(-0.75, x); }, -50.0, 50.0), 3e-7);
+	EXPECT_LT(maxError([](float x) { return gem::fast::rsqrt(x) * std::sqrt(x); }, [](double) { return 1.0; }, 1e-6, 1e6), 3e-7);
+
+	float s = 0.0f, c = 0.0f;
+	gem::fast::sincos(2.5f, s, c);
+	EXPECT_NEAR(s, std::sin(2.5f), 3e-7f);
+	EXPECT_NEAR(c, std::cos(2.5f), 3e-7f);
+
+	EXPECT_NEAR(gem::fast::fmod(7.5f, 2.0f), 1.5f, 1e-6f);
+	EXPECT_NEAR(gem::fast::fmod(-7.5f, 2.0f), -1.5f, 1e-6f);
+	EXPECT_NEAR(gem::fast::fmod(20.0f, static_cast<float>(2 * gem::math::PI)), std::fmod(20.0f, static_cast<float>(2 * gem::math::PI)), 5e-6f);
+}
+
+// Quadrant and axis handling of atan2, which must match std::atan2 exactly on the axes
+TEST(gem_fast_math_test_suite, fm_atan2_axes_test) {
+	EXPECT_FLOAT_EQ(gem::fast::atan2(0.0f, 1.0f), 0.0f);
+	EXPECT_FLOAT_EQ(gem::fast::atan2(1.0f, 0.0f), std::atan2(1.0f, 0.0f));
+	EXPECT_FLOAT_EQ(gem::fast::atan2(-1.0f, 0.0f), std::atan2(-1.0f, 0.0f));
+	EXPECT_FLOAT_EQ(gem::fast::atan2(0.0f, -1.0f), std::atan2(0.0f, -1.0f));
+	EXPECT_FLOAT_EQ(gem::fast::atan2(0.0f, 0.0f), 0.0f);
+	EXPECT_NEAR(gem::fast::atan2(-1.0f, -1.0f), std::atan2(-1.0f, -1.0f), 3e-7f);
+	EXPECT_TRUE(std::isnan(gem::fast::acos(1.5f)));
+}
+
+// The SIMD forms evaluate the same polynomials as the scalar forms
+TEST(gem_fast_math_test_suite, fm_simd_test) {
+	using gem::simd::f32x4;
+
+	EXPECT_LT(maxPacketDifference([](f32x4 x) { return gem::fast::sin(x); }, [](float x) { return gem::fast::sin(x); }, -100.0f, 100.0f), 1e-6);
+	EXPECT_LT(maxPacketDifference([](f32x4 x) { return gem::fast::cos(x); }, [](float x) { return gem::fast::cos(x); }, -100.0f, 100.0f), 1e-6);
+	EXPECT_LT(maxPacketDifference([](f32x4 x) { return gem::fast::acos(x); }, [](float x) { return gem::fast::acos(x); }, -1.0f, 1.0f), 1e-6);
+	EXPECT_LT(maxPacketDifference([](f32x4 x) { return gem::fast::atan2(x, gem::simd::broadcast(-0.5f)); }, [](float x) { return gem::fast::atan2(x, -0.5f); }, -10.0f, 10.0f), 1e-6);
+	EXPECT_LT(maxPacketDifference([](f32x4 x) { return gem::fast::atan2(gem::simd::broadcast(0.5f), x); }, [](float x) { return gem::fast::atan2(0.5f, x); }, -10.0f, 10.0f), 1e-6);
+	EXPECT_LT(maxPacketDifference([](f32x4 x) { return gem::fast::rsqrt(x); }, [](float x) { return 1.0f / std::sqrt(x); }, 0.5f, 4.0f), 1e-6);
+
+	f32x4 s, c;
+	gem::fast::sincos(gem::simd::broadcast(-4.0f), s, c);
+	float sv[4], cv[4];
+	gem::simd::store(sv, s);
+	gem::simd::store(cv, c);
+	EXPECT_NEAR(sv[0], std::sin(-4.0f), 3e-7f);
+	EXPECT_NEAR(cv[3], std::cos(-4.0f), 3e-7f);
+}
+
+// The scalar forms are usable in constant expressions
+static_assert(gem::fast::sin(0.0f) == 0.0f);
+static_assert(gem::math::abs(gem::fast::cos(0.0f) - 1.0f) < 3e-7f);
+static_assert(gem::math::abs(gem::fast::atan2(1.0f, 1.0f) - static_cast<float>(gem::math::PI / 4)) < 3e-7f);
+static_assert(gem::math::abs(gem::fast::rsqrt(4.0f) - 0.5f) < 3e-7f);
\ No newline at end of file
@@ -0,0 +1,264 @@
+#include "../../gem/vector.hpp"
+#include "../../gem/matrix.hpp"
+#include "../../gem/vector_array.hpp"
+#include "../../gem/geometry.hpp"
+#include "gem_test_helpers.hpp"
+#include <gtest/gtest.h>
+#include <cmath>
+#include <limits>
+
+using Vec3 = gem::Vector<float, 3>;
+
+constexpr gem::AABB<float> CX_BOX{ Vec3{ -1.0f, -1.0f, -1.0f }, Vec3{ 1.0f, 2.0f, 3.0f } };
+static_assert(CX_BOX.contains(Vec3{ 0.0f, 1.5f, 2.5f }));
+static_assert(!CX_BOX.contains(Vec3{ 0.0f, 2.5f, 0.0f }));
+static_assert(CX_BOX.intersects(gem::Sphere<float>{ Vec3{ 0.0f, 3.0f, 0.0f }, 1.5f }));
+
+// Spheres and boxes scattered around the origin, some of them far away
+static void makeVolumes(gem::VectorArray<float, 4>& spheres, gem::VectorArray<float, 3>& mins, gem::VectorArray<float, 3>& maxs) {
+	for (size_t i = 0; i < BATCH_COUNT; ++i) {
+		float x = std::sin(0.9f * i) * 30.0f;
+		float y = std::sin(1.7f * i + 0.5f) * 10.0f;
+		float z = std::cos(0.6f * i) * 40.0f - 20.0f;
+		float r = 0.5f + std::fabs(std::sin(2.3f * i)) * 3.0f;
+
+		spheres.push_back({ x, y, z, r });
+		mins.push_back({ x - r, y - 0.5f * r, z - r });
+		maxs.push_back({ x + r, y + 0.5f * r, z + r });
+	}
+}
+
+// AABB construction, merging and containment
+TEST(gem_geometry_test_suite, ge_aabb_test) {
+	auto box = gem::AABB<float>::fromCenterExtents({ 1.0f, 2.0f, 3.0f }, { 1.0f, 1.0f, 2.0f });
+	EXPECT_FLOAT_EQ(box.min[2], 1.0f);
+	EXPECT_FLOAT_EQ(box.max[0], 2.0f);
+	EXPECT_FLOAT_EQ(box.center()[1], 2.0f);
+	EXPECT_FLOAT_EQ(box.extents()[2], 2.0f);
+
+	auto grown = box.expand({ -4.0f, 2.0f, 3.0f });
+	EXPECT_FLOAT_EQ(grown.min[0], -4.0f);
+	EXPECT_TRUE(grown.contains(box));
+	EXPECT_FALSE(box.contains(grown));
+
+	gem::AABB<float> other{ { 1.5f, 2.5f, 4.5f }, { 5.0f, 5.0f, 5.0f } };
+	EXPECT_TRUE(box.intersects(other));
+	EXPECT_TRUE(box.merge(other).contains(other));
+	EXPECT_FALSE(box.intersects(gem::AABB<float>{ { 2.5f, 0.0f, 0.0f }, { 3.0f, 1.0f, 1.0f } }));
+
+	// Rotating 90 degrees around Y swaps the X and Z extents
+	auto moved = box.transform(gem::Matrix4<float>::translation({ 10.0f, 0.0f, 0.0f }) * gem::Matrix4<float>::rotationY(static_cast<float>(M_PI / 2)));
+	EXPECT_NEAR(moved.extents()[0], 2.0f, 1e-5f);
+	EXPECT_NEAR(moved.extents()[2], 1.0f, 1e-5f);
+	EXPECT_NEAR(moved.center()[0], 13.0f, 1e-5f);
+}
+
+// Sphere containment and overlap with spheres and boxes
+TEST(gem_geometry_test_suite, ge_sphere_test) {
+	gem::Sphere<float> sphere{ { 0.0f, 0.0f, 0.0f }, 2.0f };
+	EXPECT_TRUE(sphere.contains(Vec3{ 1.0f, 1.0f, 1.0f }));
+	EXPECT_FALSE(sphere.contains(Vec3{ 2.0f, 1.0f, 0.0f }));
+	EXPECT_TRUE(sphere.contains(gem::Sphere<float>{ { 1.0f, 0.0f, 0.0f }, 1.0f }));
+	EXPECT_FALSE(sphere.contains(gem::Sphere<float>{ { 1.5f, 0.0f, 0.0f }, 1.0f }));
+	EXPECT_TRUE(sphere.intersects(gem::Sphere<float>{ { 3.5f, 0.0f, 0.0f }, 1.5f }));
+	EXPECT_FALSE(sphere.intersects(gem::Sphere<float>{ { 3.5f, 0.0f, 0.0f }, 1.4f }));
+
+	// The box corner (2, 2, 2) is sqrt(12) away, the face x = 2 only 2
+	EXPECT_FALSE(sphere.intersects(gem::AABB<float>{ { 2.0f, 2.0f, 2.0f }, { 3.0f, 3.0f, 3.0f } }));
+	EXPECT_TRUE(sphere.intersects(gem::AABB<float>{ { 2.0f, -1.0f, -1.0f }, { 3.0f, 1.0f, 1.0f } }));
+	EXPECT_TRUE(sphere.boundingBox().contains(Vec3{ 2.0f, -2.0f, 2.0f }));
+}
+
+// Plane construction, signed distances and overlap
+TEST(gem_geometry_test_suite, ge_plane_test) {
+	auto plane = gem::Plane<float>::fromPoints({ 0.0f, 1.0f, 0.0f }, { 0.0f, 1.0f, 1.0f }, { 1.0f, 1.0f, 0.0f });
+	EXPECT_NEAR(plane.normal[1], 1.0f, 1e-6f);
+	EXPECT_NEAR(plane.signedDistance({ 5.0f, 4.0f, -3.0f }), 3.0f, 1e-6f);
+	EXPECT_NEAR(plane.signedDistance({ 0.0f, -1.0f, 0.0f }), -2.0f, 1e-6f);
+
+	gem::Plane<float> scaled{ { 0.0f, 0.0f, 4.0f }, -8.0f };
+	EXPECT_NEAR(scaled.normalize().distance, -2.0f, 1e-6f);
+
+	EXPECT_TRUE(plane.intersects(gem::Sphere<float>{ { 0.0f, 2.0f, 0.0f }, 1.0f }));
+	EXPECT_FALSE(plane.intersects(gem::Sphere<float>{ { 0.0f, 2.5f, 0.0f }, 1.0f }));
+	EXPECT_TRUE(plane.intersects(gem::AABB<float>{ { 0.0f, 0.5f, 0.0f }, { 1.0f, 1.5f, 1.0f } }));
+	EXPECT_FALSE(plane.intersects(gem::AABB<float>{ { 0.0f, 1.5f, 0.0f }, { 1.0f, 2.5f, 1.0f } }));
+}
+
+// Ray hits, misses and hits from inside
+TEST(gem_geometry_test_suite, ge_ray_test) {
+	gem::Ray<float> ray{ { -5.0f, 0.5f, 0.5f }, { 1.0f, 0.0f, 0.0f } };
+	float t = -1.0f;
+
+	EXPECT_TRUE(ray.intersect(gem::AABB<float>{ { -1.0f, 0.0f, 0.0f }, { 1.0f, 1.0f, 1.0f } }, t));
+	EXPECT_FLOAT_EQ(t, 4.0f);
+	EXPECT_FALSE(ray.intersect(gem::AABB<float>{ { -1.0f, 2.0f, 0.0f }, { 1.0f, 3.0f, 1.0f } }, t));
+	EXPECT_FALSE(ray.intersect(gem::AABB<float>{ { -9.0f, 0.0f, 0.0f }, { -6.0f, 1.0f, 1.0f } }, t));
+
+	EXPECT_TRUE(ray.intersect(gem::Sphere<float>{ { 0.0f, 0.5f, 0.5f }, 2.0f }, t));
+	EXPECT_FLOAT_EQ(t, 3.0f);
+	EXPECT_FALSE(ray.intersect(gem::Sphere<float>{ { 0.0f, 3.0f, 0.5f }, 2.0f }, t));
+	EXPECT_FALSE(ray.intersect(gem::Sphere<float>{ { -10.0f, 0.5f, 0.5f }, 2.0f }, t));
+	EXPECT_TRUE(ray.intersect(gem::Sphere<float>{ { -5.0f, 0.5f, 0.5f }, 1.0f }, t));
+	EXPECT_FLOAT_EQ(t, 0.0f);
+
+	// Direction that is not unit length gives t in multiples of it
+	gem::Ray<float> slow{ { -5.0f, 0.5f, 0.5f }, { 2.0f, 0.0f, 0.0f } };
+	EXPECT_TRUE(slow.intersect(gem::Sphere<float>{ { 0.0f, 0.5f, 0.5f }, 2.0f }, t));
+	EXPECT_FLOAT_EQ(t, 1.5f);
+
+	EXPECT_TRUE(ray.intersect(gem::Plane<float>{ { -1.0f, 0.0f, 0.0f }, 2.0f }, t));
+	EXPECT_FLOAT_EQ(t, 7.0f);
+	EXPECT_FALSE(ray.intersect(gem::Plane<float>{ { 0.0f, 1.0f, 0.0f }, 0.0f }, t));
+}
+
+// Planes extracted from a perspective camera matrix
+TEST(gem_geometry_test_suite, ge_frustum_test) {
+	auto view = gem::Matrix4<float>::lookAt({ 0.0f, 0.0f, 10.0f }, { 0.0f, 0.0f, 0.0f }, { 0.0f, 1.0f, 0.0f });
+	auto projection = gem::Matrix4<float>::perspective(90.0f, 1.0f, 1.0f, 100.0f);
+	auto frustum = gem::Frustum<float>::fromMatrix(projection * view);
+
+	// The near plane faces away from the camera at distance 1
+	const auto& near_plane = frustum.planes[gem::Frustum<float>::NEAR];
+	EXPECT_NEAR(near_plane.normal[2], -1.0f, 1e-5f);
+	EXPECT_NEAR(near_plane.signedDistance({ 0.0f, 0.0f, 9.0f }), 0.0f, 1e-4f);
+
+	EXPECT_TRUE(frustum.contains(Vec3{ 0.0f, 0.0f, 0.0f }));
+	EXPECT_TRUE(frustum.contains(Vec3{ 8.0f, 0.0f, 0.0f })); // 10 deep, 90 degrees wide
+	EXPECT_FALSE(frustum.contains(Vec3{ 11.0f, 0.0f, 0.0f }));
+	EXPECT_FALSE(frustum.contains(Vec3{ 0.0f, 0.0f, 9.5f }));
+	EXPECT_FALSE(frustum.contains(Vec3{ 0.0f, 0.0f, -95.0f }));
+
+	EXPECT_TRUE(frustum.contains(gem::Sphere<float>{ { 0.0f, 0.0f, 0.0f }, 5.0f }));
+	EXPECT_FALSE(frustum.contains(gem::Sphere<float>{ { 0.0f, 0.0f, 0.0f }, 8.0f }));
+	EXPECT_TRUE(frustum.intersects(gem::Sphere<float>{ { 12.0f, 0.0f, 0.0f }, 2.0f }));
+	EXPECT_FALSE(frustum.intersects(gem::Sphere<float>{ { 15.0f, 0.0f, 0.0f }, 2.0f }));
+	EXPECT_FALSE(frustum.intersects(gem::Sphere<float>{ { 0.0f, 0.0f, 20.0f }, 2.0f }));
+
+	EXPECT_TRUE(frustum.intersects(gem::AABB<float>{ { 9.0f, -1.0f, -1.0f }, { 11.0f, 1.0f, 1.0f } }));
+	EXPECT_FALSE(frustum.intersects(gem::AABB<float>{ { 12.0f, -1.0f, -1.0f }, { 14.0f, 1.0f, 1.0f } }));
+}
+
+// Annular sector of an arc brick, both as built and rotated like in the scene
+TEST(gem_geometry_test_suite, ge_annular_sector_test) {
+	const float quarter = static_cast<float>(M_PI / 2);
+	auto sector = gem::AnnularSector<float>::fromArc({ 0.0f, 0.0f, 0.0f }, 2.0f, 3.0f, quarter, 0.0f);
+
+	// The mesh spans polar angles [0, PI / 2], that is +X towards +Z
+	EXPECT_TRUE(sector.contains(Vec3{ 1.8f, 5.0f, 1.8f }));
+	EXPECT_FALSE(sector.contains(Vec3{ 1.0f, 0.0f, 1.0f }));
+	EXPECT_FALSE(sector.contains(Vec3{ 2.5f, 0.0f, -0.1f }));
+	EXPECT_FALSE(sector.contains(Vec3{ -1.8f, 0.0f, 1.8f }));
+
+	// Discs that only touch the straight edge at angle 0
+	EXPECT_TRUE(sector.intersects(gem::Sphere<float>{ { 2.5f, 0.0f, -0.3f }, 0.4f }));
+	EXPECT_FALSE(sector.intersects(gem::Sphere<float>{ { 2.5f, 0.0f, -0.5f }, 0.4f }));
+	EXPECT_TRUE(sector.intersects(gem::Sphere<float>{ { 1.8f, 0.0f, 1.8f }, 0.1f }));
+	EXPECT_FALSE(sector.intersects(gem::Sphere<float>{ { 0.5f, 0.0f, 0.5f }, 0.5f }));
+
+	// Yaw of PI / 2 moves the span to [-PI / 2, 0], which wraps to [3 PI / 2, 2 PI]
+	auto rotated = gem::AnnularSector<float>::fromArc({ 10.0f, 0.0f, 0.0f }, 2.0f, 3.0f, quarter, quarter);
+	EXPECT_TRUE(rotated.contains(Vec3{ 11.8f, 0.0f, -1.8f }));
+	EXPECT_FALSE(rotated.contains(Vec3{ 11.8f, 0.0f, 1.8f }));
+
+	auto ring = gem::AnnularSector<float>::fromArc({ 0.0f, 0.0f, 0.0f }, 2.0f, 3.0f, static_cast<float>(2 * M_PI), 0.0f);
+	EXPECT_TRUE(ring.contains(Vec3{ -2.5f, 0.0f, 0.0f }));
+	EXPECT_TRUE(ring.intersects(gem::Sphere<float>{ { 0.0f, 0.0f, -3.5f }, 0.6f }));
+}
+
+// Frustum against many spheres and boxes, against the scalar tests
+TEST(gem_geometry_test_suite, ge_frustum_batch_test) {
+	gem::VectorArray<float, 4> spheres;
+	gem::VectorArray<float, 3> mins, maxs;
+	makeVolumes(spheres, mins, maxs);
+
+	auto view = gem::Matrix4<float>::lookAt({ 0.0f, 5.0f, 10.0f }, { 0.0f, 0.0f, -20.0f }, { 0.0f, 1.0f, 0.0f });
+	auto frustum = gem::Frustum<float>::fromMatrix(gem::Matrix4<float>::perspective(60.0f, 1.5f, 0.5f, 40.0f) * view);
+
+	std::vector<uint8_t> visible;
+	size_t visible_count = 0;
+
+	gem::intersects(frustum, spheres, visible);
+	ASSERT_EQ(visible.size(), BATCH_COUNT);
+	for (size_t i = 0; i < BATCH_COUNT; ++i) {
+		auto s = spheres.get(i);
+		EXPECT_EQ(visible[i] != 0, frustum.intersects(gem::Sphere<float>{ { s[0], s[1], s[2] }, s[3] })) << i;
+		visible_count += visible[i];
+	}
+
+	// Both outcomes are exercised
+	EXPECT_GT(visible_count, 0u);
+	EXPECT_LT(visible_count, BATCH_COUNT);
+
+	gem::intersects(frustum, mins, maxs, visible);
+	ASSERT_EQ(visible.size(), BATCH_COUNT);
+	for (size_t i = 0; i < BATCH_COUNT; ++i) {
+		EXPECT_EQ(visible[i] != 0, frustum.intersects(gem::AABB<float>{ mins.get(i), maxs.get(i) })) << i;
+	}
+
+	gem::VectorArray<float, 3> short_maxs(BATCH_COUNT - 1);
+	EXPECT_THROW(gem::intersects(frustum, mins, short_maxs, visible), std::runtime_error);
+}
+
+// Ray against many spheres and boxes, against the scalar tests
+TEST(gem_geometry_test_suite, ge_ray_batch_test) {
+	gem::VectorArray<float, 4> spheres;
+	gem::VectorArray<float, 3> mins, maxs;
+	makeVolumes(spheres, mins, maxs);
+
+	// Aimed through the center of one sphere so that there is at least one hit
+	auto target = spheres.get(5);
+	Vec3 origin{ -40.0f, 0.5f, -15.0f };
+	gem::Ray<float> ray{ origin, (Vec3{ target[0], target[1], target[2] } - origin).normalize() };
+	const float miss = std::numeric_limits<float>::infinity();
+
+	std::vector<float> hits;
+	size_t hit_count = 0;
+
+	gem::intersect(ray, spheres, hits);
+	ASSERT_EQ(hits.size(), BATCH_COUNT);
+	for (size_t i = 0; i < BATCH_COUNT; ++i) {
+		auto s = spheres.get(i);
+		float t = 0.0f;
+		if (ray.intersect(gem::Sphere<float>{ { s[0], s[1], s[2] }, s[3] }, t)) {
+			EXPECT_NEAR(hits[i], t, 1e-4f) << i;
+			++hit_count;
+		}
+		else {
+			EXPECT_EQ(hits[i], miss) << i;
+		}
+	}
+
+	EXPECT_GT(hit_count, 0u);
+	EXPECT_LT(hit_count, BATCH_COUNT);
+
+	gem::intersect(ray, mins, maxs, hits);
+	ASSERT_EQ(hits.size(), BATCH_COUNT);
+	for (size_t i = 0; i < BATCH_COUNT; ++i) {
+		float t = 0.0f;
+		if (ray.intersect(gem::AABB<float>{ mins.get(i), maxs.get(i) }, t)) {
+			EXPECT_NEAR(hits[i], t, 1e-4f) << i;
+		}
+		else {
+			EXPECT_EQ(hits[i], miss) << i;
+		}
+	}
+}
+
+// The generic path for double gives the scalar answers as well
+TEST(gem_geometry_test_suite, ge_batch_double_test) {
+	gem::VectorArray<double, 4> spheres;
+	spheres.push_back({ 0.0, 0.0, -5.0, 1.0 });
+	spheres.push_back({ 0.0, 50.0, -5.0, 1.0 });
+
+	auto frustum = gem::Frustum<double>::fromMatrix(gem::Matrix4<double>::perspective(90.0, 1.0, 1.0, 100.0));
+	std::vector<uint8_t> visible;
+	gem::intersects(frustum, spheres, visible);
+	EXPECT_EQ(visible[0], 1);
+	EXPECT_EQ(visible[1], 0);
+
+	std::vector<double> hits;
+	gem::intersect(gem::Ray<double>{ { 0.0, 0.0, 0.0 }, { 0.0, 0.0, -1.0 } }, spheres, hits);
+	EXPECT_DOUBLE_EQ(hits[0], 4.0);
+	EXPECT_EQ(hits[1], std::numeric_limits<double>::infinity());
+}
\ No newline at end of file
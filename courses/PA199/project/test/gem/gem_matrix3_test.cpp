@@ -0,0 +1,76 @@
+#define _USE_MATH_DEFINES
+
+#include "../../gem/matrix3.hpp"
+#include "../../gem/matrix.hpp"
+#include "../../gem/vector.hpp"
+#include "../../gem/quaternion.hpp"
+#include "../../gem/axis_angle.hpp"
+#include <cmath>
+#include <gtest/gtest.h>
+
+// Basic tests for gem::Matrix3
+TEST(gem_matrix3_test_suite, m3_basic_test) {
+	gem::Matrix3<float> m = { {1.0f, 2.0f, 3.0f}, {4.0f, 5.0f, 6.0f}, {7.0f, 8.0f, 10.0f} };
+	gem::Matrix3<float> mi = gem::Matrix3<float>::identity();
+
+	EXPECT_FLOAT_EQ(m[1][2], 6.0f);
+	EXPECT_FLOAT_EQ(m(2, 2), 10.0f);
+
+	for (int i = 0; i < 3; ++i) {
+		for (int j = 0; j < 3; ++j) {
+			EXPECT_FLOAT_EQ(mi[i][j], i == j ? 1.0f : 0.0f);
+			EXPECT_FLOAT_EQ((m * mi)[i][j], m[i][j]);
+			EXPECT_FLOAT_EQ((m + m)[i][j], (2.0f * m)[i][j]);
+			EXPECT_FLOAT_EQ((m - m)[i][j], 0.0f);
+			EXPECT_FLOAT_EQ(m.transpose()[i][j], m[j][i]);
+		}
+	}
+
+	gem::Vector<float, 3> v = { 1.0f, -1.0f, 2.0f };
+	gem::Vector<float, 3> mv = m * v;
+	gem::Vector<float, 3> vm = v * m;
+	EXPECT_FLOAT_EQ(mv[0], 5.0f);
+	EXPECT_FLOAT_EQ(mv[2], 19.0f);
+	EXPECT_FLOAT_EQ(vm[0], 11.0f);
+	EXPECT_FLOAT_EQ(vm[2], 17.0f);
+}
+
+// Determinant, inverse and inverse transpose
+TEST(gem_matrix3_test_suite, m3_inverse_test) {
+	gem::Matrix3<float> m = { {2.0f, -1.0f, 0.5f}, {0.0f, 3.0f, 1.0f}, {1.0f, 0.25f, -2.0f} };
+	EXPECT_NEAR(m.det(), -15.0f, 1e-5f);
+
+	gem::Matrix3<float> product = m * m.inverse();
+	gem::Matrix3<float> inverse_transpose = m.inverseTranspose();
+	for (int i = 0; i < 3; ++i) {
+		for (int j = 0; j < 3; ++j) {
+			EXPECT_NEAR(product[i][j], i == j ? 1.0f : 0.0f, 1e-5f);
+			EXPECT_NEAR(inverse_transpose[i][j], m.inverse()[j][i], 1e-6f);
+		}
+	}
+
+	gem::Matrix3<float> singular = { {1.0f, 2.0f, 3.0f}, {2.0f, 4.0f, 6.0f}, {0.0f, 1.0f, 1.0f} };
+	EXPECT_THROW(singular.inverse(), std::runtime_error);
+}
+
+// The normal matrix keeps transformed normals perpendicular to transformed tangents
+TEST(gem_matrix3_test_suite, m3_normal_matrix_test) {
+	gem::Quaternion<float> q = gem::AxisAngle<float>(0.8f, 1.0f, -0.5f, 0.25f).toQuaternion();
+	gem::Matrix4<float> model = gem::Matrix4<float>::translation({ 3.0f, -1.0f, 2.0f })
+		* gem::Matrix4<float>::rotation(q)
+		* gem::Matrix4<float>::scale({ 2.0f, 0.5f, 4.0f });
+
+	gem::Matrix3<float> normal_matrix = model.normalMatrix();
+	gem::Matrix4<float> expected = model.inverse().transpose();
+	for (int i = 0; i < 3; ++i) {
+		for (int j = 0; j < 3; ++j) {
+			EXPECT_NEAR(normal_matrix[i][j], expected[i][j], 1e-5f);
+		}
+	}
+
+	gem::Vector<float, 3> tangent = { 1.0f, 1.0f, 0.0f };
+	gem::Vector<float, 3> normal = { 1.0f, -1.0f, 0.5f };
+	gem::Vector<float, 3> transformed_tangent = model.toMatrix3() * tangent;
+	gem::Vector<float, 3> transformed_normal = normal_matrix * normal;
+	EXPECT_NEAR(transformed_tangent.dot(transformed_normal), 0.0f, 1e-5f);
+}
\ No newline at end of file
@@ -2,6 +2,8 @@
 
 #include "../../gem/matrix.hpp"
 #include "../../gem/vector.hpp"
+#include "../../gem/quaternion.hpp"
+#include "../../gem/axis_angle.hpp"
 #include <cmath>
 #include <gtest/gtest.h>
 
@@ -419,4 +421,211 @@ TEST(gem_matrix4_test_suite, m4_inv_test) {
 			EXPECT_EQ(m2_inv[i][j], m2[i][j]);
 		}
 	}
-}
\ No newline at end of file
+
+	gem::Matrix4<double> m3 = {
+		{1.0, 2.0, 0.5, 1.0},
+		{0.3, 1.0, 3.0, 2.0},
+		{4.0, 0.7, 1.0, 3.0},
+		{0.2, 0.9, 1.1, 1.7}
+	};
+	auto m3_id = m3 * m3.inverse();
+	for (size_t i = 0; i < 4; ++i) {
+		for (size_t j = 0; j < 4; ++j) {
+			EXPECT_NEAR(m3_id[i][j], i == j ? 1.0 : 0.0, 1e-12);
+		}
+	}
+}
+
+// Matrix4<float> goes through gem::simd, check it against the generic Matrix4<double> path
+TEST(gem_matrix4_test_suite, m4_simd_test) {
+	gem::Matrix4<float> m1 = { {1.5f, -2.0f, 3.0f, 0.5f}, {0.25f, 6.0f, -7.0f, 8.0f}, {9.0f, 1.0f, -1.5f, 2.0f}, {0.0f, 0.0f, 0.0f, 1.0f} };
+	gem::Matrix4<float> m2 = { {2.0f, 0.5f, -1.0f, 3.0f}, {-4.0f, 1.0f, 0.0f, 2.5f}, {0.75f, 3.0f, 2.0f, -1.0f}, {1.0f, -2.0f, 0.5f, 1.0f} };
+	gem::Vector<float, 4> v = { 1.0f, -2.0f, 0.5f, 1.0f };
+
+	gem::Matrix4<double> d1, d2;
+	gem::Vector<double, 4> dv = { 1.0, -2.0, 0.5, 1.0 };
+	for (int i = 0; i < 4; ++i) {
+		for (int j = 0; j < 4; ++j) {
+			d1[i][j] = m1[i][j];
+			d2[i][j] = m2[i][j];
+		}
+	}
+
+	gem::Matrix4<float> m1m2 = m1 * m2;
+	gem::Matrix4<double> d1d2 = d1 * d2;
+	gem::Matrix4<float> m1t = m1.transpose();
+
+	for (int i = 0; i < 4; ++i) {
+		for (int j = 0; j < 4; ++j) {
+			EXPECT_NEAR(m1m2[i][j], d1d2[i][j], 1e-5) << "Mismatch at element [" << i << "][" << j << "]";
+			EXPECT_EQ(m1t[i][j], m1[j][i]);
+		}
+	}
+
+	gem::Vector<float, 4> mv = m1 * v;
+	gem::Vector<double, 4> dmv = d1 * dv;
+	gem::Vector<float, 4> vm = v * m1;
+	gem::Vector<double, 4> dvm = dv * d1;
+
+	for (int i = 0; i < 4; ++i) {
+		EXPECT_NEAR(mv[i], dmv[i], 1e-5);
+		EXPECT_NEAR(vm[i], dvm[i], 1e-5);
+	}
+}
+
+
+TEST(gem_matrix4_test_suite, m4_affine_inv_test) {
+	gem::Vector<float, 3> position = { 1.0f, -2.0f, 3.0f };
+	gem::Quaternion<float> orientation = gem::AxisAngle<float>(0.75f, 1.0f, 2.0f, -0.5f).toQuaternion();
+	gem::Vector<float, 3> scale = { 2.0f, 0.5f, 3.0f };
+
+	gem::Matrix4<float> trs =
+		gem::Matrix4<float>::translation(position) *
+		gem::Matrix4<float>::rotation(orientation) *
+		gem::Matrix4<float>::scale(scale);
+
+	gem::Matrix4<float> expected = trs.inverse();
+	gem::Matrix4<float> affine = trs.affineInverse();
+	gem::Matrix4<float> direct = gem::Matrix4<float>::inverseTRS(position, orientation, scale);
+
+	for (int i = 0; i < 4; ++i) {
+		for (int j = 0; j < 4; ++j) {
+			EXPECT_NEAR(affine[i][j], expected[i][j], 1e-5) << "Mismatch at element [" << i << "][" << j << "]";
+			EXPECT_NEAR(direct[i][j], expected[i][j], 1e-5) << "Mismatch at element [" << i << "][" << j << "]";
+		}
+	}
+
+	gem::Matrix4<float> roundtrip = trs * direct;
+	for (int i = 0; i < 4; ++i) {
+		for (int j = 0; j < 4; ++j) {
+			EXPECT_NEAR(roundtrip[i][j], i == j ? 1.0f : 0.0f, 1e-5);
+		}
+	}
+
+	EXPECT_ANY_THROW(gem::Matrix4<float>::scale({ 1.0f, 0.0f, 1.0f }).affineInverse());
+	EXPECT_ANY_THROW(gem::Matrix4<float>::inverseTRS(position, orientation, { 1.0f, 0.0f, 1.0f }));
+}
+
+
+// The batched quaternion conversion must match Matrix4::rotation for every element, including the non-SIMD tail
+TEST(gem_matrix4_test_suite, m4_rotation_batch_test) {
+	std::vector<gem::Quaternion<float>> quaternions;
+	for (int i = 0; i < 11; ++i) {
+		quaternions.push_back(gem::AxisAngle<float>(0.3f * i, 1.0f, 0.5f * i, -0.25f).toQuaternion().normalize());
+	}
+
+	std::vector<gem::Matrix4<float>> matrices;
+	gem::Matrix4<float>::rotation(quaternions, matrices);
+	ASSERT_EQ(matrices.size(), quaternions.size());
+
+	for (size_t n = 0; n < quaternions.size(); ++n) {
+		gem::Matrix4<float> expected = gem::Matrix4<float>::rotation(quaternions[n]);
+		for (int i = 0; i < 4; ++i) {
+			for (int j = 0; j < 4; ++j) {
+				EXPECT_NEAR(matrices[n][i][j], expected[i][j], 1e-6f) << "Mismatch in matrix " << n << " at [" << i << "][" << j << "]";
+			}
+		}
+	}
+}
+
+// values() follows the storage layout while m(row, col) and m[row][col] stay logical
+TEST(gem_matrix4_test_suite, m4_layout_test) {
+	gem::Matrix4<float> m = { {1.0f, 2.0f, 3.0f, 4.0f}, {5.0f, 6.0f, 7.0f, 8.0f}, {9.0f, 10.0f, 11.0f, 12.0f}, {13.0f, 14.0f, 15.0f, 16.0f} };
+
+	for (int i = 0; i < 4; ++i) {
+		for (int j = 0; j < 4; ++j) {
+			float expected = static_cast<float>(4 * i + j + 1);
+			EXPECT_EQ(m(i, j), expected);
+			EXPECT_EQ(m[i][j], expected);
+
+			int index = gem::Matrix4<float>::COLUMN_MAJOR ? 4 * j + i : 4 * i + j;
+			EXPECT_EQ(m.values()[index], expected);
+		}
+	}
+
+	// Translation is always in the last column, i.e. values 12..14 when column-major like OpenGL
+	gem::Matrix4<float> t = gem::Matrix4<float>::translation({ 1.0f, 2.0f, 3.0f });
+	EXPECT_EQ(t.values()[gem::Matrix4<float>::COLUMN_MAJOR ? 12 : 3], 1.0f);
+	EXPECT_EQ(t.values()[gem::Matrix4<float>::COLUMN_MAJOR ? 14 : 11], 3.0f);
+
+	m[2][1] = -1.0f;
+	EXPECT_EQ(m(2, 1), -1.0f);
+}
+
+constexpr gem::Matrix<int, 2, 3> CX_A = { {1, 2, 3}, {4, 5, 6} };
+constexpr gem::Matrix<int, 3, 2> CX_B = { {1, 0}, {0, 1}, {1, 1} };
+static_assert((CX_A * CX_B)(0, 0) == 4 && (CX_A * CX_B)(1, 1) == 11 && CX_A.transpose()(2, 1) == 6);
+
+// Shapes other than 4x4 share the same unrolled operators
+TEST(gem_matrix4_test_suite, m4_generic_test) {
+	gem::Matrix<float, 2, 3> a = { {1.0f, 2.0f, 3.0f}, {4.0f, 5.0f, 6.0f} };
+	gem::Matrix<float, 3, 2> b = a.transpose();
+	EXPECT_EQ(b(2, 0), 3.0f);
+	EXPECT_EQ(b(0, 1), 4.0f);
+
+	gem::Matrix2<float> ab = a * b;
+	EXPECT_EQ(ab(0, 0), 14.0f);
+	EXPECT_EQ(ab(0, 1), 32.0f);
+	EXPECT_EQ(ab(1, 1), 77.0f);
+	EXPECT_FLOAT_EQ(ab.det(), 14.0f * 77.0f - 32.0f * 32.0f);
+
+	gem::Matrix2<float> product = ab * ab.inverse();
+	EXPECT_NEAR(product(0, 0), 1.0f, 1e-5f);
+	EXPECT_NEAR(product(0, 1), 0.0f, 1e-5f);
+	EXPECT_NEAR(product(1, 1), 1.0f, 1e-5f);
+
+	gem::Vector<float, 2> v = a * gem::Vector<float, 3>{ 1.0f, 0.0f, -1.0f };
+	EXPECT_EQ(v[0], -2.0f);
+	EXPECT_EQ(v[1], -2.0f);
+
+	gem::Vector<float, 3> w = gem::Vector<float, 2>{ 1.0f, 1.0f } * a;
+	EXPECT_EQ(w[2], 9.0f);
+
+	gem::Matrix<float, 2, 3> sum = (a + a) * 0.5f - a;
+	for (int i = 0; i < 2; ++i) {
+		for (int j = 0; j < 3; ++j) EXPECT_EQ(sum(i, j), 0.0f);
+	}
+
+	using Singular = gem::Matrix2<float>;
+	Singular singular = { {1.0f, 2.0f}, {2.0f, 4.0f} };
+	EXPECT_THROW(singular.inverse(), std::runtime_error);
+}
+
+// The affine 3x4 composes, transforms and inverts like the Matrix4 it stands for
+TEST(gem_matrix4_test_suite, m4_affine_3x4_test) {
+	gem::Quaternion<float> qa = gem::AxisAngle<float>(0.7f, 1.0f, 2.0f, 0.5f).toQuaternion();
+	gem::Quaternion<float> qb = gem::AxisAngle<float>(-1.3f, 0.0f, 1.0f, 1.0f).toQuaternion();
+
+	gem::Matrix4<float> ma = gem::Matrix4<float>::translation({ 1.0f, -2.0f, 3.0f }) * gem::Matrix4<float>::rotation(qa) * gem::Matrix4<float>::scale({ 2.0f, 1.0f, 0.5f });
+	gem::Matrix4<float> mb = gem::Matrix4<float>::translation({ -4.0f, 0.5f, 1.0f }) * gem::Matrix4<float>::rotation(qb);
+
+	gem::Matrix3x4<float> a = ma.toAffine();
+	gem::Matrix3x4<float> b = gem::Matrix3x4<float>::translation({ -4.0f, 0.5f, 1.0f }) * gem::Matrix3x4<float>::rotation(qb);
+
+	gem::Matrix4<float> expected = ma * mb;
+	gem::Matrix4<float> composed = (a * b).toMatrix4();
+	for (int i = 0; i < 4; ++i) {
+		for (int j = 0; j < 4; ++j) EXPECT_NEAR(composed(i, j), expected(i, j), 1e-5f);
+	}
+
+	gem::Vector<float, 3> p{ 0.5f, 1.5f, -2.0f };
+	gem::Vector<float, 4> expected_p = ma * gem::Vector<float, 4>{ p[0], p[1], p[2], 1.0f };
+	gem::Vector<float, 3> affine_p = a.transformPoint(p);
+	gem::Vector<float, 3> product_p = a * gem::Vector<float, 4>{ p[0], p[1], p[2], 1.0f };
+	for (int k = 0; k < 3; ++k) {
+		EXPECT_NEAR(affine_p[k], expected_p[k], 1e-5f);
+		EXPECT_NEAR(product_p[k], expected_p[k], 1e-5f);
+		EXPECT_NEAR(ma.transformPoint(p)[k], expected_p[k], 1e-5f);
+	}
+
+	gem::Matrix3x4<float> round_trip = a * a.inverse();
+	gem::Matrix3x4<float> identity = gem::Matrix3x4<float>::identity();
+	for (int i = 0; i < 3; ++i) {
+		for (int j = 0; j < 4; ++j) EXPECT_NEAR(round_trip(i, j), identity(i, j), 1e-5f);
+	}
+
+	// Constant evaluation takes the unrolled scalar path
+	constexpr gem::Matrix3x4<double> CX_T = gem::Matrix3x4<double>::translation({ 1.0, 2.0, 3.0 }) * gem::Matrix3x4<double>::scale({ 2.0, 2.0, 2.0 });
+	static_assert(CX_T(0, 0) == 2.0 && CX_T(2, 3) == 3.0);
+	EXPECT_EQ(sizeof(a), 12 * sizeof(float));
+}
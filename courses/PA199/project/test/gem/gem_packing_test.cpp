@@ -0,0 +1,90 @@
+#include "../../gem/vector.hpp"
+#include "../../gem/packing.hpp"
+#include <gtest/gtest.h>
+#include <cmath>
+#include <limits>
+
+using Vec2 = gem::Vector<float, 2>;
+using Vec3 = gem::Vector<float, 3>;
+
+static_assert(gem::packHalf(1.0f) == 0x3c00 && gem::unpackHalf(0xc000) == -2.0f);
+static_assert(gem::packSnorm16(-1.0f) == -32767 && gem::packUnorm16(1.0f) == 65535);
+
+// Half floats: exact values, rounding, denormals and the special values
+TEST(gem_packing_test_suite, pk_half_test) {
+	EXPECT_EQ(gem::packHalf(0.0f), 0x0000);
+	EXPECT_EQ(gem::packHalf(-0.0f), 0x8000);
+	EXPECT_EQ(gem::packHalf(0.5f), 0x3800);
+	EXPECT_EQ(gem::packHalf(65504.0f), 0x7bff);
+	EXPECT_EQ(gem::packHalf(std::ldexp(1.0f, -14)), 0x0400);
+	EXPECT_EQ(gem::packHalf(std::ldexp(1.0f, -24)), 0x0001);
+
+	// Ties round to even, overflow goes to infinity, tiny values to zero
+	EXPECT_EQ(gem::packHalf(1.0f + std::ldexp(1.0f, -11)), 0x3c00);
+	EXPECT_EQ(gem::packHalf(1.0f + 3 * std::ldexp(1.0f, -11)), 0x3c02);
+	EXPECT_EQ(gem::packHalf(65520.0f), 0x7c00);
+	EXPECT_EQ(gem::packHalf(-1e9f), 0xfc00);
+	EXPECT_EQ(gem::packHalf(std::ldexp(1.0f, -26)), 0x0000);
+	EXPECT_EQ(gem::packHalf(std::numeric_limits<float>::infinity()), 0x7c00);
+	EXPECT_TRUE(std::isnan(gem::unpackHalf(gem::packHalf(std::numeric_limits<float>::quiet_NaN()))));
+
+	// Every finite half survives a round trip through float
+	for (uint32_t h = 0; h < 0x10000; ++h) {
+		if ((h & 0x7c00) == 0x7c00) continue;
+		EXPECT_EQ(gem::packHalf(gem::unpackHalf(static_cast<uint16_t>(h))), h);
+	}
+
+	// Relative error of at most 2^-11 in the normal range
+	for (float value : { 0.1f, -3.7f, 123.456f, 0.001f, 2047.5f }) {
+		EXPECT_NEAR(gem::unpackHalf(gem::packHalf(value)), value, std::fabs(value) * 0.00049f);
+	}
+}
+
+// Normalized integers clamp and round to the nearest step
+TEST(gem_packing_test_suite, pk_norm_test) {
+	EXPECT_EQ(gem::packSnorm16(0.0f), 0);
+	EXPECT_EQ(gem::packSnorm16(1.0f), 32767);
+	EXPECT_EQ(gem::packSnorm16(2.0f), 32767);
+	EXPECT_EQ(gem::packSnorm16(-5.0f), -32767);
+	EXPECT_FLOAT_EQ(gem::unpackSnorm16(-32768), -1.0f);
+
+	EXPECT_EQ(gem::packUnorm16(-1.0f), 0);
+	EXPECT_EQ(gem::packUnorm16(0.5f), 32768);
+	EXPECT_FLOAT_EQ(gem::unpackUnorm16(65535), 1.0f);
+
+	for (float value : { -0.999f, -0.3f, 0.25f, 0.7071f }) {
+		EXPECT_NEAR(gem::unpackSnorm16(gem::packSnorm16(value)), value, 0.5f / 32767.0f);
+		EXPECT_NEAR(gem::unpackUnorm16(gem::packUnorm16(std::fabs(value))), std::fabs(value), 0.5f / 65535.0f);
+	}
+}
+
+// Octahedral encoding round-trips every direction, also through snorm16 storage
+TEST(gem_packing_test_suite, pk_octahedral_test) {
+	Vec2 up = gem::octEncode(Vec3{ 0.0f, 0.0f, 1.0f });
+	EXPECT_FLOAT_EQ(up[0], 0.0f);
+	EXPECT_FLOAT_EQ(up[1], 0.0f);
+
+	Vec2 down = gem::octEncode(Vec3{ 0.0f, 0.0f, -1.0f });
+	EXPECT_FLOAT_EQ(std::fabs(down[0]) + std::fabs(down[1]), 2.0f);
+
+	for (int i = 0; i < 16; ++i) {
+		for (int j = 0; j <= 8; ++j) {
+			float phi = static_cast<float>(i) / 16 * 2 * static_cast<float>(M_PI);
+			float theta = static_cast<float>(j) / 8 * static_cast<float>(M_PI);
+			Vec3 n{ std::sin(theta) * std::cos(phi), std::sin(theta) * std::sin(phi), std::cos(theta) };
+
+			Vec2 e = gem::octEncode(n);
+			EXPECT_LE(std::fabs(e[0]), 1.0f);
+			EXPECT_LE(std::fabs(e[1]), 1.0f);
+
+			Vec3 exact = gem::octDecode(e);
+			for (int k = 0; k < 3; ++k) EXPECT_NEAR(exact[k], n[k], 1e-5f);
+
+			Vec3 stored = gem::octDecode(Vec2{ gem::unpackSnorm16(gem::packSnorm16(e[0])), gem::unpackSnorm16(gem::packSnorm16(e[1])) });
+			EXPECT_NEAR(stored.magnitude(), 1.0f, 1e-6f);
+			EXPECT_GT(stored.dot(n), 0.99999f);
+		}
+	}
+
+	EXPECT_THROW(gem::octEncode(Vec3{ 0.0f, 0.0f, 0.0f }), std::runtime_error);
+}
\ No newline at end of file
@@ -349,4 +349,71 @@ TEST(gem_quaternion_test_suite, q_slerp_test) {
 	EXPECT_NEAR(q_slerp_05.x(), std::sqrt(2) / 2.0f, 1e-6f);
 	EXPECT_NEAR(q_slerp_05.y(), 0.0f, 1e-6f);
 	EXPECT_NEAR(q_slerp_05.z(), 0.0f, 1e-6f);
+}
+
+// Element-wise quaternion arithmetic is lazy and only evaluated when a Quaternion is needed
+TEST(gem_quaternion_test_suite, q_expression_test) {
+	gem::Quaternion<float> a(1.0f, 2.0f, 3.0f, 4.0f);
+	gem::Quaternion<float> b(0.5f, -1.0f, 0.0f, 2.0f);
+
+	auto expr = a * 0.5f + b - 1.0f;
+	static_assert(!std::is_same_v<decltype(expr), gem::Quaternion<float>>);
+	EXPECT_FLOAT_EQ(expr.w(), 0.0f);
+	EXPECT_FLOAT_EQ(expr.z(), 3.0f);
+
+	gem::Quaternion<float> q = expr;
+	EXPECT_FLOAT_EQ(q.x(), -1.0f);
+	EXPECT_FLOAT_EQ(q.y(), 0.5f);
+
+	// Hamilton products evaluate the expression first
+	gem::Quaternion<float> expected = q * b;
+	gem::Quaternion<float> product = (a * 0.5f + b - 1.0f) * b;
+	gem::Quaternion<float> product2 = b * (b + 0.0f);
+	gem::Quaternion<float> expected2 = b * b;
+	for (int i = 0; i < 4; ++i) {
+		EXPECT_FLOAT_EQ(product[i], expected[i]);
+		EXPECT_FLOAT_EQ(product2[i], expected2[i]);
+	}
+
+	EXPECT_FLOAT_EQ((a + b).magnitude(), gem::Quaternion<float>(a + b).magnitude());
+	EXPECT_FLOAT_EQ((-a).dot(b), -a.dot(b));
+}
+
+// rotate uses the cross-product form, it must agree with the sandwich product q * p * conj(q)
+TEST(gem_quaternion_test_suite, q_rotate_test) {
+	gem::Quaternion<float> q = gem::AxisAngle<float>(1.3f, 0.2f, -1.0f, 0.7f).toQuaternion().normalize();
+	gem::Vector<float, 3> v = { 1.5f, -2.0f, 0.25f };
+
+	gem::Quaternion<float> sandwich = q * gem::Quaternion<float>(0.0f, v[0], v[1], v[2]) * q.conjugate();
+	gem::Vector<float, 3> rotated = q.rotate(v);
+	EXPECT_NEAR(rotated[0], sandwich.x(), 1e-5f);
+	EXPECT_NEAR(rotated[1], sandwich.y(), 1e-5f);
+	EXPECT_NEAR(rotated[2], sandwich.z(), 1e-5f);
+	EXPECT_NEAR(rotated.magnitude(), v.magnitude(), 1e-5f);
+
+	gem::Vector<float, 3> x_to_y = gem::AxisAngle<float>(static_cast<float>(M_PI / 2), 0.0f, 0.0f, 1.0f).toQuaternion().rotate({ 1.0f, 0.0f, 0.0f });
+	EXPECT_NEAR(x_to_y[0], 0.0f, 1e-6f);
+	EXPECT_NEAR(x_to_y[1], 1.0f, 1e-6f);
+}
+
+// basis returns the rotated axes, also for quaternions that are not unit length
+TEST(gem_quaternion_test_suite, q_basis_test) {
+	gem::Quaternion<float> q = gem::AxisAngle<float>(0.9f, 1.0f, 2.0f, -0.5f).toQuaternion().normalize();
+	gem::Basis<float> basis = q.basis();
+	gem::Basis<float> scaled = (q * 3.0f).basis();
+
+	gem::Vector<float, 3> axes[3] = { { 1.0f, 0.0f, 0.0f }, { 0.0f, 1.0f, 0.0f }, { 0.0f, 0.0f, 1.0f } };
+	gem::Vector<float, 3> columns[3] = { basis.right, basis.up, basis.forward };
+	gem::Vector<float, 3> scaled_columns[3] = { scaled.right, scaled.up, scaled.forward };
+
+	for (int i = 0; i < 3; ++i) {
+		gem::Vector<float, 3> expected = q.rotate(axes[i]);
+		for (int k = 0; k < 3; ++k) {
+			EXPECT_NEAR(columns[i][k], expected[k], 1e-6f);
+			EXPECT_NEAR(scaled_columns[i][k], expected[k], 1e-6f);
+		}
+	}
+
+	EXPECT_NEAR(basis.right.dot(basis.up), 0.0f, 1e-6f);
+	EXPECT_NEAR(basis.right.cross(basis.up).dot(basis.forward), 1.0f, 1e-6f);
 }
\ No newline at end of file
@@ -0,0 +1,144 @@
+#include "../../gem/vector.hpp"
+#include "../../gem/quaternion.hpp"
+#include "../../gem/axis_angle.hpp"
+#include "../../gem/spline.hpp"
+#include "gem_test_helpers.hpp"
+#include <gtest/gtest.h>
+#include <cmath>
+
+using Vec3 = gem::Vector<float, 3>;
+using Quat = gem::Quaternion<float>;
+
+static const std::vector<Vec3> PATH = {
+	{ 0.0f, 0.0f, 0.0f }, { 1.0f, 2.0f, 0.0f }, { 3.0f, 2.0f, 1.0f }, { 4.0f, 0.0f, 3.0f }, { 6.0f, -1.0f, 3.0f }
+};
+
+constexpr auto CX_SEGMENT = gem::CubicSegment<float, 3>::bezier({ 0.0f, 0.0f, 0.0f }, { 1.0f, 0.0f, 0.0f }, { 2.0f, 0.0f, 0.0f }, { 3.0f, 0.0f, 0.0f });
+static_assert(CX_SEGMENT.evaluate(0.5f)[0] == 1.5f);
+
+// Segments in the power basis against the textbook Bezier, Hermite and Catmull-Rom forms
+TEST(gem_spline_test_suite, sp_segment_test) {
+	Vec3 p0{ 0.0f, 0.0f, 0.0f }, p1{ 1.0f, 3.0f, 0.0f }, p2{ 3.0f, 3.0f, 1.0f }, p3{ 4.0f, 0.0f, 2.0f };
+
+	auto bezier = gem::CubicSegment<float, 3>::bezier(p0, p1, p2, p3);
+	for (float t : { 0.0f, 0.3f, 0.5f, 1.0f }) {
+		float s = 1.0f - t;
+		Vec3 expected = p0 * (s * s * s) + p1 * (3 * s * s * t) + p2 * (3 * s * t * t) + p3 * (t * t * t);
+		expectNear(bezier.evaluate(t), expected, 1e-5f);
+	}
+	expectNear(bezier.derivative(0.0f), (p1 - p0) * 3.0f, 1e-5f);
+
+	auto hermite = gem::CubicSegment<float, 3>::hermite(p0, p1, p3, p2);
+	expectNear(hermite.evaluate(1.0f), p3, 1e-5f);
+	expectNear(hermite.derivative(0.0f), p1, 1e-5f);
+	expectNear(hermite.derivative(1.0f), p2, 1e-5f);
+
+	// Catmull-Rom passes through the inner points with the central difference as tangent
+	auto catmull = gem::CubicSegment<float, 3>::catmullRom(p0, p1, p2, p3);
+	expectNear(catmull.evaluate(0.0f), p1, 1e-5f);
+	expectNear(catmull.evaluate(1.0f), p2, 1e-5f);
+	expectNear(catmull.derivative(0.0f), (p2 - p0) * 0.5f, 1e-5f);
+}
+
+// Forward differencing reproduces the direct evaluation
+TEST(gem_spline_test_suite, sp_forward_difference_test) {
+	auto spline = gem::CubicSpline<float, 3>::catmullRom(PATH);
+	ASSERT_EQ(spline.segmentCount(), 4u);
+
+	std::vector<Vec3> points, tangents;
+	spline.tessellate(64, points);
+	spline.tessellateDerivatives(64, tangents);
+	ASSERT_EQ(points.size(), 4u * 64u + 1u);
+	ASSERT_EQ(tangents.size(), points.size());
+
+	for (size_t i = 0; i < points.size(); ++i) {
+		float u = static_cast<float>(i) / (points.size() - 1);
+		expectNear(points[i], spline.evaluate(u), 1e-4f);
+		expectNear(tangents[i], spline.derivative(u), 1e-3f);
+	}
+
+	// The curve passes through every control point
+	for (size_t i = 0; i < PATH.size(); ++i) expectNear(points[i * 64], PATH[i], 1e-4f);
+}
+
+// Construction of open, closed, Bezier and Hermite splines
+TEST(gem_spline_test_suite, sp_spline_test) {
+	auto closed = gem::CubicSpline<float, 3>::catmullRom(PATH, true);
+	EXPECT_EQ(closed.segmentCount(), PATH.size());
+	expectNear(closed.evaluate(1.0f), PATH[0], 1e-5f);
+	expectNear(closed.derivative(0.0f), closed.derivative(1.0f), 1e-4f);
+
+	std::vector<Vec3> controls = { PATH[0], PATH[1], PATH[2], PATH[3] };
+	auto bezier = gem::CubicSpline<float, 3>::bezier(controls);
+	expectNear(bezier.evaluate(0.5f), bezier.segment(0).evaluate(0.5f), 1e-6f);
+
+	auto hermite = gem::CubicSpline<float, 3>::hermite({ PATH[0], PATH[1] }, { PATH[2], PATH[3] });
+	expectNear(hermite.evaluate(1.0f), PATH[1], 1e-5f);
+
+	using Spline = gem::CubicSpline<float, 3>;
+	Spline empty;
+	EXPECT_THROW(Spline::catmullRom({ PATH[0] }), std::runtime_error);
+	EXPECT_THROW(Spline::bezier(PATH), std::runtime_error);
+	EXPECT_THROW(Spline::hermite(PATH, { PATH[0] }), std::runtime_error);
+	EXPECT_THROW(empty.evaluate(0.5f), std::runtime_error);
+
+	std::vector<Vec3> points;
+	EXPECT_THROW(empty.tessellate(8, points), std::runtime_error);
+	EXPECT_THROW(closed.tessellate(0, points), std::runtime_error);
+}
+
+// The arc length table spaces points evenly along the curve
+TEST(gem_spline_test_suite, sp_arc_length_test) {
+	// A straight line with uneven speed: all the length is in the x component
+	auto line = gem::CubicSpline<float, 3>::bezier({ { 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f }, { 9.0f, 0.0f, 0.0f } });
+	gem::ArcLengthTable<float> line_table(line, 256);
+	EXPECT_NEAR(line_table.length(), 9.0f, 1e-3f);
+	EXPECT_NEAR(line.evaluate(line_table.parameter(4.5f))[0], 4.5f, 1e-2f);
+	EXPECT_FLOAT_EQ(line_table.parameter(-1.0f), 0.0f);
+	EXPECT_FLOAT_EQ(line_table.parameter(100.0f), 1.0f);
+
+	auto spline = gem::CubicSpline<float, 3>::catmullRom(PATH);
+	gem::ArcLengthTable<float> table(spline, 64);
+
+	std::vector<float> parameters;
+	table.parameters(41, parameters);
+	ASSERT_EQ(parameters.size(), 41u);
+	EXPECT_FLOAT_EQ(parameters.front(), 0.0f);
+	EXPECT_FLOAT_EQ(parameters.back(), 1.0f);
+
+	float spacing = table.length() / 40.0f;
+	for (size_t i = 1; i < parameters.size(); ++i) {
+		EXPECT_NEAR(parameters[i], table.parameter(spacing * i), 1e-5f);
+		float chord = Vec3(spline.evaluate(parameters[i]) - spline.evaluate(parameters[i - 1])).magnitude();
+		EXPECT_NEAR(chord, spacing, 0.02f * spacing);
+	}
+}
+
+// Squad passes through the keys and agrees with slerp when the keys lie on one great arc
+TEST(gem_spline_test_suite, sp_squad_test) {
+	std::vector<Quat> keys;
+	for (int i = 0; i < 4; ++i) keys.push_back(gem::AxisAngle<float>(0.5f * i, 0.0f, 1.0f, 0.0f).toQuaternion());
+
+	gem::QuaternionSpline<float> arc(keys);
+	EXPECT_EQ(arc.segmentCount(), 3u);
+	for (float u : { 0.0f, 0.1f, 0.5f, 0.8f, 1.0f }) {
+		Quat expected = gem::AxisAngle<float>(1.5f * u, 0.0f, 1.0f, 0.0f).toQuaternion();
+		EXPECT_NEAR(std::fabs(arc.evaluate(u).dot(expected)), 1.0f, 1e-5f);
+	}
+
+	// Keys on different axes, one of them in the other hemisphere
+	keys = {
+		gem::AxisAngle<float>(0.3f, 1.0f, 0.0f, 0.0f).toQuaternion(),
+		-gem::AxisAngle<float>(1.2f, 0.0f, 1.0f, 0.0f).toQuaternion(),
+		gem::AxisAngle<float>(0.8f, 0.0f, 0.0f, 1.0f).toQuaternion()
+	};
+	gem::QuaternionSpline<float> curve(keys);
+	EXPECT_NEAR(std::fabs(curve.evaluate(0.5f).dot(keys[1])), 1.0f, 1e-5f);
+	EXPECT_NEAR(std::fabs(curve.evaluate(1.0f).dot(keys[2])), 1.0f, 1e-5f);
+
+	// Smooth across the middle key: equal steps on both sides turn by about the same angle
+	Quat before = curve.evaluate(0.49f), at = curve.evaluate(0.5f), after = curve.evaluate(0.51f);
+	EXPECT_NEAR(std::fabs(before.dot(at)), std::fabs(at.dot(after)), 1e-4f);
+
+	EXPECT_THROW(gem::QuaternionSpline<float>({ keys[0] }), std::runtime_error);
+}
\ No newline at end of file
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "../../gem/vector.hpp"
+#include "../../gem/matrix.hpp"
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <type_traits>
+
+// Shared by the gem tests
+
+// Element count of the batch tests: nine full packets plus a partial one, so every kernel
+// also runs its scalar tail
+inline constexpr size_t BATCH_COUNT = 37;
+
+// Deduced from the first argument only, the expected value may be an expression or a braced list
+template<typename T, size_t N>
+void expectNear(const gem::Vector<T, N>& a, const std::type_identity_t<gem::Vector<T, N>>& b, std::type_identity_t<T> tolerance) {
+	for (size_t k = 0; k < N; ++k) {
+		EXPECT_NEAR(a[k], b[k], tolerance);
+	}
+}
+
+template<typename T, size_t R, size_t C>
+void expectNear(const gem::Matrix<T, R, C>& a, const std::type_identity_t<gem::Matrix<T, R, C>>& b, std::type_identity_t<T> tolerance) {
+	for (size_t i = 0; i < R; ++i) {
+		for (size_t j = 0; j < C; ++j) {
+			EXPECT_NEAR(a(static_cast<int>(i), static_cast<int>(j)), b(static_cast<int>(i), static_cast<int>(j)), tolerance);
+		}
+	}
+}
\ No newline at end of file
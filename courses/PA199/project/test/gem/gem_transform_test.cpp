@@ -0,0 +1,131 @@
+#include "../../gem/vector.hpp"
+#include "../../gem/matrix.hpp"
+#include "../../gem/axis_angle.hpp"
+#include "../../gem/quaternion.hpp"
+#include "../../gem/interpolation.hpp"
+#include "../../gem/transform.hpp"
+#include <gtest/gtest.h>
+#include <cmath>
+
+static gem::Matrix4<float> trsMatrix(const gem::Vector<float, 3>& p, const gem::Quaternion<float>& r, const gem::Vector<float, 3>& s) {
+	return gem::Matrix4<float>::translation(p) * gem::Matrix4<float>::rotation(r) * gem::Matrix4<float>::scale(s);
+}
+
+// Basic tests for gem::Transform
+TEST(gem_transform_test_suite, t_basic_test) {
+	gem::Transform<float> t;
+
+	for (int i = 0; i < 3; ++i) {
+		EXPECT_FLOAT_EQ(t.position[i], 0.0f);
+		EXPECT_FLOAT_EQ(t.scale[i], 1.0f);
+	}
+	EXPECT_FLOAT_EQ(t.rotation.w(), 1.0f);
+
+	gem::Matrix4<float> m = t.toMatrix();
+	for (int i = 0; i < 4; ++i) {
+		for (int j = 0; j < 4; ++j) {
+			EXPECT_FLOAT_EQ(m[i][j], i == j ? 1.0f : 0.0f);
+		}
+	}
+}
+
+// toMatrix should match the translation * rotation * scale product
+TEST(gem_transform_test_suite, t_to_matrix_test) {
+	gem::Vector<float, 3> position = { 1.0f, -2.0f, 3.0f };
+	gem::Quaternion<float> rotation = gem::AxisAngle<float>(0.75f, 1.0f, 2.0f, -0.5f).toQuaternion();
+	gem::Vector<float, 3> scale = { 2.0f, 0.5f, 3.0f };
+
+	gem::Matrix4<float> expected = trsMatrix(position, rotation, scale);
+	gem::Matrix4<float> m = gem::Transform<float>(position, rotation, scale).toMatrix();
+
+	for (int i = 0; i < 4; ++i) {
+		for (int j = 0; j < 4; ++j) {
+			EXPECT_NEAR(m[i][j], expected[i][j], 1e-5) << "Mismatch at element [" << i << "][" << j << "]";
+		}
+	}
+}
+
+// Composition and point transformation should agree with the matrix path
+TEST(gem_transform_test_suite, t_compose_test) {
+	gem::Transform<float> parent({ 4.0f, 0.0f, -1.0f }, gem::AxisAngle<float>(1.2f, 0.0f, 1.0f, 0.0f).toQuaternion(), { 2.0f, 2.0f, 2.0f });
+	gem::Transform<float> child({ 0.5f, 1.0f, 2.0f }, gem::AxisAngle<float>(-0.4f, 1.0f, 1.0f, 0.0f).toQuaternion(), { 1.0f, 3.0f, 0.5f });
+
+	gem::Matrix4<float> expected = parent.toMatrix() * child.toMatrix();
+	gem::Matrix4<float> composed = (parent * child).toMatrix();
+
+	for (int i = 0; i < 4; ++i) {
+		for (int j = 0; j < 4; ++j) {
+			EXPECT_NEAR(composed[i][j], expected[i][j], 1e-4) << "Mismatch at element [" << i << "][" << j << "]";
+		}
+	}
+
+	gem::Vector<float, 3> p = { 1.0f, -1.0f, 0.5f };
+	gem::Vector<float, 4> expectedPoint = expected * gem::Vector<float, 4>{ p[0], p[1], p[2], 1.0f };
+	gem::Vector<float, 3> point = parent.transformPoint(child.transformPoint(p));
+	gem::Vector<float, 3> vec = (parent * child).transformVector(p);
+	gem::Vector<float, 4> expectedVec = expected * gem::Vector<float, 4>{ p[0], p[1], p[2], 0.0f };
+
+	for (int i = 0; i < 3; ++i) {
+		EXPECT_NEAR(point[i], expectedPoint[i], 1e-4);
+		EXPECT_NEAR(vec[i], expectedVec[i], 1e-4);
+	}
+}
+
+// Inverse tests for gem::Transform
+TEST(gem_transform_test_suite, t_inverse_test) {
+	gem::Transform<float> t({ 1.0f, -2.0f, 3.0f }, gem::AxisAngle<float>(0.75f, 1.0f, 2.0f, -0.5f).toQuaternion(), { 2.0f, 2.0f, 2.0f });
+	gem::Transform<float> identity = t * t.inverse();
+
+	for (int i = 0; i < 3; ++i) {
+		EXPECT_NEAR(identity.position[i], 0.0f, 1e-5);
+		EXPECT_NEAR(identity.scale[i], 1.0f, 1e-5);
+	}
+	EXPECT_NEAR(std::abs(identity.rotation.w()), 1.0f, 1e-5);
+
+	gem::Transform<float> n({ 1.0f, -2.0f, 3.0f }, t.rotation, { 2.0f, 0.5f, 3.0f });
+	gem::Vector<float, 3> p = { 0.3f, 4.0f, -1.5f };
+	gem::Vector<float, 3> back = n.inverseTransformPoint(n.transformPoint(p));
+
+	for (int i = 0; i < 3; ++i) {
+		EXPECT_NEAR(back[i], p[i], 1e-5);
+	}
+
+	EXPECT_ANY_THROW(gem::Transform<float>({ 0.0f, 0.0f, 0.0f }, t.rotation, { 1.0f, 0.0f, 1.0f }).inverse());
+}
+
+// A non-uniform scale has no TRS inverse, the matrix one still undoes toMatrix()
+TEST(gem_transform_test_suite, t_inverse_non_uniform_test) {
+	gem::Transform<float> n({ 1.0f, -2.0f, 3.0f }, gem::AxisAngle<float>(0.75f, 1.0f, 2.0f, -0.5f).toQuaternion(), { 2.0f, 0.5f, 3.0f });
+	EXPECT_THROW(n.inverse(), std::runtime_error);
+
+	gem::Matrix4<float> identity = n.inverseMatrix() * n.toMatrix();
+	for (int i = 0; i < 4; ++i) {
+		for (int j = 0; j < 4; ++j) {
+			EXPECT_NEAR(identity[i][j], i == j ? 1.0f : 0.0f, 1e-5);
+		}
+	}
+
+	gem::Vector<float, 3> p = { 0.3f, 4.0f, -1.5f };
+	gem::Vector<float, 4> back = n.inverseMatrix() * gem::Vector<float, 4>{ p[0], p[1], p[2], 1.0f };
+	gem::Vector<float, 3> expected = n.inverseTransformPoint(p);
+	for (int i = 0; i < 3; ++i) {
+		EXPECT_NEAR(back[i], expected[i], 1e-5);
+	}
+}
+
+// Interpolation tests for gem::Transform
+TEST(gem_transform_test_suite, t_interpolate_test) {
+	gem::Transform<float> a({ 0.0f, 0.0f, 0.0f }, gem::Quaternion<float>(), { 1.0f, 1.0f, 1.0f });
+	gem::Transform<float> b({ 2.0f, 4.0f, -6.0f }, gem::AxisAngle<float>(static_cast<float>(M_PI) / 2.0f, 0.0f, 0.0f, 1.0f).toQuaternion(), { 3.0f, 3.0f, 3.0f });
+
+	gem::Transform<float> mid = gem::interpolate(a, b, 0.5f);
+	gem::Quaternion<float> expected = gem::AxisAngle<float>(static_cast<float>(M_PI) / 4.0f, 0.0f, 0.0f, 1.0f).toQuaternion();
+
+	EXPECT_NEAR(mid.position[0], 1.0f, 1e-5);
+	EXPECT_NEAR(mid.position[1], 2.0f, 1e-5);
+	EXPECT_NEAR(mid.position[2], -3.0f, 1e-5);
+	EXPECT_NEAR(mid.scale[0], 2.0f, 1e-5);
+	for (int i = 0; i < 4; ++i) {
+		EXPECT_NEAR(mid.rotation[i], expected[i], 1e-5);
+	}
+}
\ No newline at end of file
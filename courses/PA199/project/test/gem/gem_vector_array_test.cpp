@@ -0,0 +1,171 @@
+#include "../../gem/vector.hpp"
+#include "../../gem/matrix.hpp"
+#include "../../gem/axis_angle.hpp"
+#include "../../gem/quaternion.hpp"
+#include "../../gem/coordinates.hpp"
+#include "../../gem/vector_array.hpp"
+#include "gem_test_helpers.hpp"
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdint>
+
+template<typename T, size_t N>
+static gem::VectorArray<T, N> makeArray(size_t count, T offset) {
+	gem::VectorArray<T, N> result;
+	for (size_t i = 0; i < count; ++i) {
+		gem::Vector<T, N> v;
+		for (size_t k = 0; k < N; ++k) {
+			v[k] = static_cast<T>(std::sin(0.7 * i + 1.3 * k) * 5.0) + offset;
+		}
+		result.push_back(v);
+	}
+	return result;
+}
+
+// Storage, element access and alignment
+TEST(gem_vector_array_test_suite, va_basic_test) {
+	gem::VectorArray<float, 3> a;
+	EXPECT_TRUE(a.empty());
+
+	a.push_back({ 1.0f, 2.0f, 3.0f });
+	a.push_back({ 4.0f, 5.0f, 6.0f });
+	EXPECT_EQ(a.size(), 2u);
+	EXPECT_FLOAT_EQ(a.get(1)[0], 4.0f);
+	EXPECT_FLOAT_EQ(a.component(2)[0], 3.0f);
+
+	a.set(0, { 7.0f, 8.0f, 9.0f });
+	EXPECT_FLOAT_EQ(a.get(0)[1], 8.0f);
+
+	a.resize(100);
+	const size_t alignment = gem::VectorArray<float, 3>::ALIGNMENT;
+	for (size_t k = 0; k < 3; ++k) {
+		EXPECT_EQ(reinterpret_cast<uintptr_t>(a.component(k)) % alignment, 0u);
+	}
+
+	gem::VectorArray<float, 3> b(5);
+	EXPECT_THROW(gem::add(a, b, b), std::runtime_error);
+}
+
+// add, sub, mul and fma against the per-element operators
+TEST(gem_vector_array_test_suite, va_element_wise_test) {
+	auto a = makeArray<float, 3>(BATCH_COUNT, 0.0f);
+	auto b = makeArray<float, 3>(BATCH_COUNT, 1.0f);
+	auto c = makeArray<float, 3>(BATCH_COUNT, -2.0f);
+	gem::VectorArray<float, 3> out;
+
+	gem::add(a, b, out);
+	for (size_t i = 0; i < BATCH_COUNT; ++i) expectNear<float, 3>(out.get(i), a.get(i) + b.get(i), 1e-6f);
+
+	gem::sub(a, b, out);
+	for (size_t i = 0; i < BATCH_COUNT; ++i) expectNear<float, 3>(out.get(i), a.get(i) - b.get(i), 1e-6f);
+
+	gem::mul(a, 0.5f, out);
+	for (size_t i = 0; i < BATCH_COUNT; ++i) expectNear<float, 3>(out.get(i), a.get(i) * 0.5f, 1e-6f);
+
+	gem::fma(a, 0.25f, c, out);
+	for (size_t i = 0; i < BATCH_COUNT; ++i) expectNear<float, 3>(out.get(i), a.get(i) * 0.25f + c.get(i), 1e-5f);
+
+	gem::mul(a, b, out);
+	gem::fma(a, b, c, c);
+	for (size_t i = 0; i < BATCH_COUNT; ++i) {
+		for (size_t k = 0; k < 3; ++k) {
+			EXPECT_NEAR(out.get(i)[k], a.get(i)[k] * b.get(i)[k], 1e-5f);
+		}
+	}
+
+	// In place: c was overwritten with a * b + c
+	auto original = makeArray<float, 3>(BATCH_COUNT, -2.0f);
+	for (size_t i = 0; i < BATCH_COUNT; ++i) {
+		for (size_t k = 0; k < 3; ++k) {
+			EXPECT_NEAR(c.get(i)[k], a.get(i)[k] * b.get(i)[k] + original.get(i)[k], 1e-5f);
+		}
+	}
+}
+
+// dot, normalize and cross against Vector
+TEST(gem_vector_array_test_suite, va_geometric_test) {
+	auto a = makeArray<float, 3>(BATCH_COUNT, 0.0f);
+	auto b = makeArray<float, 3>(BATCH_COUNT, 1.0f);
+	a.set(3, { 0.0f, 0.0f, 0.0f });
+
+	std::vector<float> dots;
+	gem::dot(a, b, dots);
+	ASSERT_EQ(dots.size(), BATCH_COUNT);
+	for (size_t i = 0; i < BATCH_COUNT; ++i) EXPECT_NEAR(dots[i], a.get(i).dot(b.get(i)), 1e-4f);
+
+	gem::VectorArray<float, 3> out;
+	gem::normalize(a, out);
+	for (size_t i = 0; i < BATCH_COUNT; ++i) expectNear<float, 3>(out.get(i), a.get(i).normalize(), 1e-6f);
+
+	gem::cross(a, b, out);
+	for (size_t i = 0; i < BATCH_COUNT; ++i) expectNear<float, 3>(out.get(i), a.get(i).cross(b.get(i)), 1e-4f);
+
+	// The scalar path for other types
+	auto ad = makeArray<double, 3>(BATCH_COUNT, 0.0);
+	gem::VectorArray<double, 3> outd;
+	gem::normalize(ad, outd);
+	for (size_t i = 0; i < BATCH_COUNT; ++i) expectNear<double, 3>(outd.get(i), ad.get(i).normalize(), 1e-12);
+}
+
+// Matrix and quaternion transforms against the single-vector versions
+TEST(gem_vector_array_test_suite, va_transform_test) {
+	gem::Quaternion<float> q = gem::AxisAngle<float>(1.1f, 0.3f, -1.0f, 0.5f).toQuaternion().normalize();
+	gem::Matrix4<float> m = gem::Matrix4<float>::translation({ 1.0f, -2.0f, 0.5f })
+		* gem::Matrix4<float>::rotation(q)
+		* gem::Matrix4<float>::scale({ 2.0f, 1.0f, 0.5f });
+
+	auto points = makeArray<float, 3>(BATCH_COUNT, 0.0f);
+	gem::VectorArray<float, 3> out;
+
+	gem::transformPoints(m, points, out);
+	for (size_t i = 0; i < BATCH_COUNT; ++i) {
+		gem::Vector<float, 3> p = points.get(i);
+		gem::Vector<float, 4> expected = m * gem::Vector<float, 4>{ p[0], p[1], p[2], 1.0f };
+		expectNear<float, 3>(out.get(i), { expected[0], expected[1], expected[2] }, 1e-4f);
+	}
+
+	auto homogeneous = makeArray<float, 4>(BATCH_COUNT, 0.0f);
+	gem::VectorArray<float, 4> out4;
+	gem::transform(m, homogeneous, out4);
+	for (size_t i = 0; i < BATCH_COUNT; ++i) expectNear<float, 4>(out4.get(i), m * homogeneous.get(i), 1e-4f);
+
+	gem::rotate(q, points, out);
+	for (size_t i = 0; i < BATCH_COUNT; ++i) expectNear<float, 3>(out.get(i), q.rotate(points.get(i)), 1e-4f);
+
+	auto pointsd = makeArray<double, 3>(BATCH_COUNT, 0.0);
+	gem::Quaternion<double> qd(q.w(), q.x(), q.y(), q.z());
+	gem::VectorArray<double, 3> outd;
+	gem::rotate(qd, pointsd, outd);
+	for (size_t i = 0; i < BATCH_COUNT; ++i) expectNear<double, 3>(outd.get(i), qd.rotate(pointsd.get(i)), 1e-6);
+}
+
+// Cartesian <-> polar against gem::Polar, covering every quadrant and both axes
+TEST(gem_vector_array_test_suite, va_polar_test) {
+	gem::VectorArray<float, 2> cartesian = makeArray<float, 2>(BATCH_COUNT, 0.0f);
+	cartesian.push_back({ 0.0f, 2.0f });
+	cartesian.push_back({ 0.0f, -2.0f });
+	cartesian.push_back({ -3.0f, 0.0f });
+	cartesian.push_back({ 3.0f, 0.0f });
+	cartesian.push_back({ 0.0f, 0.0f });
+
+	gem::VectorArray<float, 2> polar;
+	gem::toPolar(cartesian, polar);
+	for (size_t i = 0; i < cartesian.size(); ++i) {
+		gem::Polar<float> expected = gem::Polar<float>::fromCartesian(cartesian.get(i));
+		EXPECT_NEAR(polar.get(i)[0], expected.r(), 1e-5f);
+		EXPECT_NEAR(polar.get(i)[1], expected.theta(), 1e-5f);
+	}
+
+	gem::VectorArray<float, 2> back;
+	gem::toCartesian(polar, back);
+	for (size_t i = 0; i < cartesian.size(); ++i) expectNear<float, 2>(back.get(i), cartesian.get(i), 1e-5f);
+
+	// Angles well outside [0, 2 * PI) still reduce correctly
+	gem::VectorArray<float, 2> wide;
+	for (int i = -20; i <= 20; ++i) wide.push_back({ 1.5f, 0.37f * static_cast<float>(i) });
+	gem::toCartesian(wide, back);
+	for (size_t i = 0; i < wide.size(); ++i) {
+		gem::Polar<float> p(wide.get(i)[0], wide.get(i)[1]);
+		expectNear<float, 2>(back.get(i), p.toCartesian(), 1e-5f);
+	}
+}
\ No newline at end of file
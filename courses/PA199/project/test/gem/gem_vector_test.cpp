@@ -513,4 +513,85 @@ TEST(gem_vector_test_suite, v_lerp_test) {
     EXPECT_FLOAT_EQ(4.0f, result_05[0]);
     EXPECT_FLOAT_EQ(2.0f, result_05[1]);
 	EXPECT_FLOAT_EQ(0.0f, result_05[2]);
+}
+
+// Vector<float, 4> goes through gem::simd, check it against the generic Vector<double, 4> path
+TEST(gem_vector_test_suite, v4_simd_test) {
+    gem::Vector<float, 4> v1{ 1.5f, -2.0f, 3.25f, 4.0f };
+    gem::Vector<float, 4> v2{ -0.5f, 8.0f, 2.0f, 0.25f };
+    float s = 3.0f;
+
+    gem::Vector<double, 4> d1{ 1.5, -2.0, 3.25, 4.0 };
+    gem::Vector<double, 4> d2{ -0.5, 8.0, 2.0, 0.25 };
+    double ds = 3.0;
+
+    auto check = [](const gem::Vector<float, 4>& result, const gem::Vector<double, 4>& expected) {
+        for (size_t i = 0; i < 4; ++i) {
+            EXPECT_FLOAT_EQ(result[i], static_cast<float>(expected[i])) << "Mismatch at element " << i;
+        }
+    };
+
+    check(v1 + v2, d1 + d2);
+    check(v1 - v2, d1 - d2);
+    check(v1 * v2, d1 * d2);
+    check(v1 / v2, d1 / d2);
+
+    check(v1 + s, d1 + ds);
+    check(v1 - s, d1 - ds);
+    check(s - v1, ds - d1);
+    check(v1 * s, d1 * ds);
+    check(v1 / s, d1 / ds);
+    check(s / v1, ds / d1);
+
+    check(-v1, -d1);
+    EXPECT_FLOAT_EQ(v1.dot(v2), static_cast<float>(d1.dot(d2)));
+}
+
+
+// Operators build lazy expressions that are evaluated in one pass on assignment
+TEST(gem_vector_test_suite, v_expression_test) {
+    gem::Vector<float, 3> a{ 1.0f, 2.0f, 3.0f };
+    gem::Vector<float, 3> b{ -4.0f, 0.5f, 2.0f };
+
+    auto expr = a + b * 2.0f - 1.0f;
+    static_assert(!std::is_same_v<decltype(expr), gem::Vector<float, 3>>);
+    EXPECT_EQ(expr.size(), 3);
+    EXPECT_FLOAT_EQ(expr[0], -8.0f);
+
+    gem::Vector<float, 3> result = expr;
+    EXPECT_FLOAT_EQ(result[0], -8.0f);
+    EXPECT_FLOAT_EQ(result[1], 2.0f);
+    EXPECT_FLOAT_EQ(result[2], 6.0f);
+
+    // Expressions forward the usual vector functions
+    EXPECT_FLOAT_EQ((a - a + b).magnitude(), b.magnitude());
+    EXPECT_FLOAT_EQ((a * 1.0f).dot(b), a.dot(b));
+    EXPECT_FLOAT_EQ(a.dot(b + 0.0f), a.dot(b));
+    EXPECT_FLOAT_EQ((a + 0.0f).cross(b)[0], a.cross(b)[0]);
+    EXPECT_FLOAT_EQ((b * 2.0f).normalize()[1], b.normalize()[1]);
+
+    // The target may appear on the right-hand side
+    gem::Vector<float, 3> c = a;
+    c = b - c * 2.0f;
+    EXPECT_FLOAT_EQ(c[0], -6.0f);
+    EXPECT_FLOAT_EQ(c[1], -3.5f);
+    EXPECT_FLOAT_EQ(c[2], -4.0f);
+
+    // Compound assignment
+    gem::Vector<float, 3> p{ 0.0f, 0.0f, 0.0f };
+    p += b * 0.5f;
+    p -= 1.0f;
+    p *= 2.0f;
+    p /= gem::Vector<float, 3>{ 1.0f, 2.0f, 4.0f };
+    EXPECT_FLOAT_EQ(p[0], -6.0f);
+    EXPECT_FLOAT_EQ(p[1], -0.75f);
+    EXPECT_FLOAT_EQ(p[2], 0.0f);
+
+    // Temporaries are captured by value, so the expression outlives them
+    auto makeVector = [](float x) { return gem::Vector<float, 4>{ x, x, x, x }; };
+    auto held = makeVector(2.0f) * makeVector(3.0f) + 1.0f;
+    gem::Vector<float, 4> evaluated = held;
+    for (size_t i = 0; i < 4; ++i) {
+        EXPECT_FLOAT_EQ(evaluated[i], 7.0f);
+    }
 }
\ No newline at end of file
@@ -51,6 +51,12 @@ class IApplication {
     /** The current FPS measured on CPU. */
     float fps_cpu;
 
+    /**
+     * How far the rendered frame lies between the last two simulation steps, from 0 (the previous step) to 1 (the
+     * last step). Always 1 unless the application manager runs the updates in fixed steps.
+     */
+    float interpolation_alpha = 1.0f;
+
     /** The absolute path to framework's folder. Loaded from {@link configuration} if a configuration file is available. */
     std::filesystem::path framework_folder_path;
 
@@ -177,6 +183,13 @@ class IApplication {
     /** Returns the default path for the framework folder. */
     std::filesystem::path get_framework_folder_path() const;
 
+    /**
+     * Sets how far the next rendered frame lies between the last two simulation steps.
+     *
+     * @param 	alpha	The blend factor from the previous to the last step, in [0, 1].
+     */
+    void set_interpolation_alpha(float alpha);
+
     /**
      * Sets a new GLFW window corresponding to this application.
      *
@@ -32,6 +32,15 @@ public:
     /** The last measured time step (in milliseconds). The value is used to determine time elapsed between two frames. */
     double last_glfw_time = 0;
 
+    /** The length of one simulation step (in milliseconds), or 0 to update once per frame with the frame time. */
+    double fixed_step = 0;
+
+    /** The most simulation steps taken in one frame. Time beyond them is dropped so a slow frame cannot snowball. */
+    int max_steps_per_frame = 8;
+
+    /** The time measured but not yet simulated (in milliseconds), always less than one step after a frame. */
+    double accumulated_time = 0;
+
     /** The flag determining if the creation of the OpenGL window failed. */
     bool fail = false;
 
@@ -72,6 +81,22 @@ public:
      */
     void set_multisampling_per_pixel(int samples);
 
+    /**
+     * Makes the application update in fixed steps instead of once per frame. Every frame runs as many steps as the
+     * elapsed time covers and renders with {@link IApplication::interpolation_alpha} set to the fraction of a step
+     * that is left over.
+     *
+     * @param 	rate	The number of simulation steps per second, or 0 to update once per frame again.
+     */
+    void set_fixed_update_rate(double rate);
+
+    /**
+     * Sets how many simulation steps a single frame may take at most.
+     *
+     * @param 	steps	The maximum number of steps per frame.
+     */
+    void set_max_steps_per_frame(int steps);
+
   protected:
     /** This method is invoked right before the infinite render loop is executed. */
     virtual void pre_render_loop(IApplication& application);
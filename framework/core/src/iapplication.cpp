@@ -71,4 +71,6 @@ size_t IApplication::get_height() const { return this->height; }
 
 std::filesystem::path IApplication::get_framework_folder_path() const { return this->framework_folder_path; }
 
+void IApplication::set_interpolation_alpha(float alpha) { this->interpolation_alpha = alpha; }
+
 void IApplication::set_window(GLFWwindow* window) { this->window = window; }
@@ -8,6 +8,8 @@
 #include "manager.h"
 #include "GLFW/glfw3.h"
 #include "glad/glad.h"
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 #include <ostream>
 
@@ -112,8 +114,26 @@ void ApplicationManager::run(IApplication& application) {
         // The preprocess hook.
         this->pre_frame_render();
 
+        // Application update
+        if (fixed_step > 0) {
+            accumulated_time += elapsed_time;
+            int steps = 0;
+            while (accumulated_time >= fixed_step && steps < max_steps_per_frame) {
+                application.update(static_cast<float>(fixed_step));
+                accumulated_time -= fixed_step;
+                steps++;
+            }
+            // Drops what the budget did not cover instead of carrying it into the next frame.
+            if (accumulated_time >= fixed_step) {
+                accumulated_time = std::fmod(accumulated_time, fixed_step);
+            }
+            application.set_interpolation_alpha(static_cast<float>(accumulated_time / fixed_step));
+        } else {
+            application.update(static_cast<float>(elapsed_time));
+            application.set_interpolation_alpha(1.0f);
+        }
+
         // Application render
-        application.update(static_cast<float>(elapsed_time));
         application.render();
         application.render_ui();
 
@@ -136,6 +156,13 @@ void ApplicationManager::disable_resize() const { glfwSetWindowAttrib(window, GL
 
 void ApplicationManager::set_multisampling_per_pixel(int samples) { samples_per_pixel = samples; }
 
+void ApplicationManager::set_fixed_update_rate(double rate) {
+    fixed_step = rate > 0 ? 1000.0 / rate : 0;
+    accumulated_time = 0;
+}
+
+void ApplicationManager::set_max_steps_per_frame(int steps) { max_steps_per_frame = std::max(1, steps); }
+
 void ApplicationManager::pre_render_loop(IApplication& application) {
 }
 